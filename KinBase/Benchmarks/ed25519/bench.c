@@ -0,0 +1,451 @@
+/*
+    Micro-benchmarks for the vendored ed25519 library.
+
+        make && ./bench [-n samples] [-o results.json]
+
+    Every benchmark takes a fixed number of samples after a warm-up. A sample
+    times a run of calls that is long enough to be measured reliably, and
+    reports per-call time. Inputs come from fixed seeds, so runs are
+    comparable across builds; pin the process to one core (taskset -c 2)
+    and disable frequency scaling for stable numbers. Cases ending in _64
+    time a call over 64 entries; verify_loop_64 is the baseline for
+    verify_batch_64, and sign_batch_64_pool only gains when not pinned.
+
+    Cycles are read from the time stamp counter on x86-64 and the virtual
+    counter on aarch64 (which ticks at a fixed rate, not at the core clock).
+    Results go to stderr as a table and as JSON to stdout or the -o file.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "kined25519.h"
+#include "sha512.h"
+#include "fe.h"
+#include "ge.h"
+
+#define DEFAULT_SAMPLES 2000
+#define WARMUP_SAMPLES 50
+#define SAMPLE_NS 2000.0 /* target length of a timed run */
+#define MAX_MESSAGE (64 * 1024)
+#define KEYPAIR_BATCH 64
+#define BATCH_MESSAGE 64 /* bytes signed per entry of the batch benchmarks */
+#define MAX_RESULTS 64
+
+typedef struct {
+    const char *name;
+    size_t bytes;
+    int samples;
+    int calls;
+    double cycles;
+    double ops_per_sec;
+    double p50_ns;
+    double p99_ns;
+} result;
+
+typedef void (*bench_fn)(void *state);
+
+typedef struct {
+    unsigned char seed[32];
+    unsigned char public_key[32];
+    unsigned char private_key[64];
+    unsigned char other_public_key[32];
+    unsigned char scalar[32];
+    unsigned char signature[64];
+    unsigned char out[64];
+    unsigned char batch_public_keys[KEYPAIR_BATCH * 32];
+    unsigned char batch_private_keys[KEYPAIR_BATCH * 64];
+    unsigned char batch_secrets[KEYPAIR_BATCH * 32];
+    unsigned char batch_signatures[KEYPAIR_BATCH * 64];
+    unsigned char shared_signatures[KEYPAIR_BATCH * 64];
+    unsigned char job_signatures[KEYPAIR_BATCH * 64];
+    const unsigned char *signature_ptrs[KEYPAIR_BATCH];
+    const unsigned char *shared_signature_ptrs[KEYPAIR_BATCH];
+    const unsigned char *message_ptrs[KEYPAIR_BATCH];
+    const unsigned char *public_key_ptrs[KEYPAIR_BATCH];
+    const unsigned char *shared_public_key_ptrs[KEYPAIR_BATCH];
+    size_t message_lens[KEYPAIR_BATCH];
+    int batch_results[KEYPAIR_BATCH];
+    ed25519_sign_job jobs[KEYPAIR_BATCH];
+    unsigned char *message;
+    size_t message_len;
+    ed25519_signer *signer;
+    ed25519_pubkey_ctx *pubkey;
+    ed25519_pool *pool;
+    fe f;
+    fe g;
+    ge_p3 point;
+} bench_state;
+
+static result results[MAX_RESULTS];
+static int result_count = 0;
+
+static unsigned long long cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    unsigned long long t;
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(t));
+    return t;
+#else
+    return 0;
+#endif
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double *) a;
+    double y = *(const double *) b;
+    return (x > y) - (x < y);
+}
+
+/* deterministic filler, so every run hashes and signs the same bytes */
+static void fill(unsigned char *out, size_t len, unsigned int seed) {
+    size_t i;
+
+    for (i = 0; i < len; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        out[i] = (unsigned char) (seed >> 16);
+    }
+}
+
+static void run(const char *name, size_t bytes, bench_fn fn, bench_state *state, int samples) {
+    result *r;
+    double *times;
+    unsigned long long c0, total_cycles = 0;
+    double t0, t, total_ns = 0;
+    int calls = 1;
+    int i, j;
+
+    if (result_count == MAX_RESULTS) {
+        fprintf(stderr, "more than %d benchmarks, raise MAX_RESULTS\n", MAX_RESULTS);
+        exit(1);
+    }
+
+    r = &results[result_count++];
+    times = malloc(sizeof(double) * samples);
+
+    /* grow the run until it's long enough to time */
+    for (;;) {
+        t0 = now_ns();
+
+        for (j = 0; j < calls; ++j) {
+            fn(state);
+        }
+
+        if (now_ns() - t0 >= SAMPLE_NS || calls >= (1 << 20)) {
+            break;
+        }
+
+        calls *= 2;
+    }
+
+    for (i = 0; i < WARMUP_SAMPLES; ++i) {
+        for (j = 0; j < calls; ++j) {
+            fn(state);
+        }
+    }
+
+    for (i = 0; i < samples; ++i) {
+        t0 = now_ns();
+        c0 = cycles();
+
+        for (j = 0; j < calls; ++j) {
+            fn(state);
+        }
+
+        total_cycles += cycles() - c0;
+        t = now_ns() - t0;
+        total_ns += t;
+        times[i] = t / calls;
+    }
+
+    qsort(times, samples, sizeof(double), compare_double);
+
+    r->name = name;
+    r->bytes = bytes;
+    r->samples = samples;
+    r->calls = calls;
+    r->cycles = (double) total_cycles / ((double) samples * calls);
+    r->ops_per_sec = 1e9 * samples * calls / total_ns;
+    r->p50_ns = times[samples / 2];
+    r->p99_ns = times[(int) ((samples - 1) * 0.99)];
+
+    fprintf(stderr, "%-26s %8lu B %12.0f cycles %12.0f ops/s  p50 %10.1f ns  p99 %10.1f ns\n",
+            r->name, (unsigned long) r->bytes, r->cycles, r->ops_per_sec, r->p50_ns, r->p99_ns);
+
+    free(times);
+}
+
+static void bench_create_keypair(void *p) {
+    bench_state *s = p;
+    ed25519_create_keypair(s->public_key, s->private_key, s->seed);
+    s->seed[0] ^= s->public_key[0];
+}
+
+/* 64 keys per call */
+static void bench_create_keypairs_batch(void *p) {
+    bench_state *s = p;
+    ed25519_create_keypairs_batch(KEYPAIR_BATCH, s->batch_public_keys, s->batch_private_keys, s->message);
+}
+
+static void bench_sign(void *p) {
+    bench_state *s = p;
+    ed25519_sign(s->signature, s->message, s->message_len, s->public_key, s->private_key);
+}
+
+static void bench_signer_sign(void *p) {
+    bench_state *s = p;
+    ed25519_signer_sign(s->signer, s->signature, s->message, s->message_len);
+}
+
+static void bench_verify(void *p) {
+    bench_state *s = p;
+
+    if (!ed25519_verify(s->signature, s->message, s->message_len, s->public_key)) {
+        fprintf(stderr, "verify failed\n");
+        exit(1);
+    }
+}
+
+static void bench_verify_prepared(void *p) {
+    bench_state *s = p;
+
+    if (!ed25519_verify_prepared(s->pubkey, s->signature, s->message, s->message_len)) {
+        fprintf(stderr, "verify_prepared failed\n");
+        exit(1);
+    }
+}
+
+/* 64 signatures under distinct keys per call, the baseline for the batch */
+static void bench_verify_loop(void *p) {
+    bench_state *s = p;
+    size_t i;
+
+    for (i = 0; i < KEYPAIR_BATCH; ++i) {
+        if (!ed25519_verify(s->signature_ptrs[i], s->message_ptrs[i], BATCH_MESSAGE, s->public_key_ptrs[i])) {
+            fprintf(stderr, "verify failed\n");
+            exit(1);
+        }
+    }
+}
+
+/* 64 signatures under distinct keys per call */
+static void bench_verify_batch(void *p) {
+    bench_state *s = p;
+
+    if (!ed25519_verify_batch(KEYPAIR_BATCH, s->signature_ptrs, s->message_ptrs, s->message_lens, s->public_key_ptrs, s->batch_results)) {
+        fprintf(stderr, "verify_batch failed\n");
+        exit(1);
+    }
+}
+
+/* 64 signatures under one key per call */
+static void bench_verify_batch_shared_key(void *p) {
+    bench_state *s = p;
+
+    if (!ed25519_verify_batch(KEYPAIR_BATCH, s->shared_signature_ptrs, s->message_ptrs, s->message_lens, s->shared_public_key_ptrs, s->batch_results)) {
+        fprintf(stderr, "verify_batch failed\n");
+        exit(1);
+    }
+}
+
+/* 64 signatures per call, on the calling thread */
+static void bench_sign_batch(void *p) {
+    bench_state *s = p;
+    ed25519_sign_batch(s->jobs, KEYPAIR_BATCH, NULL);
+}
+
+/* 64 signatures per call, spread over a pool with one thread per CPU */
+static void bench_sign_batch_pool(void *p) {
+    bench_state *s = p;
+    ed25519_sign_batch(s->jobs, KEYPAIR_BATCH, s->pool);
+}
+
+#ifndef ED25519_NO_SEED
+/* 64 seeds per call */
+static void bench_create_seeds(void *p) {
+    bench_state *s = p;
+
+    if (ed25519_create_seeds(KEYPAIR_BATCH, s->batch_secrets)) {
+        fprintf(stderr, "create_seeds failed\n");
+        exit(1);
+    }
+}
+#endif
+
+static void bench_key_exchange(void *p) {
+    bench_state *s = p;
+    ed25519_key_exchange(s->out, s->other_public_key, s->private_key);
+}
+
+/* 64 peers per call */
+static void bench_key_exchange_batch(void *p) {
+    bench_state *s = p;
+    ed25519_key_exchange_batch(KEYPAIR_BATCH, s->batch_secrets, s->batch_public_keys, s->private_key);
+}
+
+static void bench_add_scalar(void *p) {
+    bench_state *s = p;
+    ed25519_add_scalar(s->public_key, s->private_key, s->scalar);
+}
+
+static void bench_sha512(void *p) {
+    bench_state *s = p;
+    sha512(s->message, s->message_len, s->out);
+}
+
+static void bench_fe_mul(void *p) {
+    bench_state *s = p;
+    fe_mul(s->f, s->f, s->g);
+}
+
+static void bench_fe_invert(void *p) {
+    bench_state *s = p;
+    fe_invert(s->f, s->f);
+}
+
+static void bench_ge_scalarmult_base(void *p) {
+    bench_state *s = p;
+    ge_scalarmult_base(&s->point, s->scalar);
+    s->scalar[0] ^= (unsigned char) s->point.X[0];
+}
+
+static void write_json(FILE *out) {
+    ed25519_backends backends;
+    int i;
+
+    ed25519_get_backends(&backends);
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"backends\": {\"cpu_features\": %u, \"field\": \"%s\", \"sha512\": \"%s\", \"sha512x4\": \"%s\"},\n",
+            backends.cpu_features, backends.field, backends.sha512, backends.sha512x4);
+    fprintf(out, "  \"results\": [\n");
+
+    for (i = 0; i < result_count; ++i) {
+        const result *r = &results[i];
+        fprintf(out, "    {\"name\": \"%s\", \"bytes\": %lu, \"samples\": %d, \"calls_per_sample\": %d, "
+                     "\"cycles_per_op\": %.1f, \"ops_per_sec\": %.1f, \"p50_ns\": %.1f, \"p99_ns\": %.1f}%s\n",
+                r->name, (unsigned long) r->bytes, r->samples, r->calls,
+                r->cycles, r->ops_per_sec, r->p50_ns, r->p99_ns, i + 1 < result_count ? "," : "");
+    }
+
+    fprintf(out, "  ]\n");
+    fprintf(out, "}\n");
+}
+
+int main(int argc, char **argv) {
+    static const size_t sizes[] = { 64, 256, 1024, 4096, 16384, MAX_MESSAGE };
+    bench_state state;
+    const char *output = NULL;
+    int samples = DEFAULT_SAMPLES;
+    FILE *out = stdout;
+    size_t i;
+    int a;
+
+    for (a = 1; a < argc; ++a) {
+        if (!strcmp(argv[a], "-n") && a + 1 < argc) {
+            samples = atoi(argv[++a]);
+        } else if (!strcmp(argv[a], "-o") && a + 1 < argc) {
+            output = argv[++a];
+        } else {
+            fprintf(stderr, "usage: %s [-n samples] [-o results.json]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (samples < 1) {
+        samples = 1;
+    }
+
+    memset(&state, 0, sizeof(state));
+    state.message = malloc(MAX_MESSAGE);
+    fill(state.message, MAX_MESSAGE, 1);
+    fill(state.seed, 32, 2);
+    fill(state.scalar, 32, 3);
+    state.scalar[31] &= 127;
+    ed25519_create_keypair(state.other_public_key, state.private_key, state.seed);
+    fill(state.seed, 32, 4);
+    ed25519_create_keypair(state.public_key, state.private_key, state.seed);
+    fe_frombytes(state.f, state.seed);
+    fe_frombytes(state.g, state.scalar);
+
+    run("create_keypair", 0, bench_create_keypair, &state, samples);
+    run("create_keypairs_batch_64", 0, bench_create_keypairs_batch, &state, samples);
+    ed25519_create_keypair(state.public_key, state.private_key, state.seed);
+    state.signer = ed25519_signer_create(state.public_key, state.private_key);
+    state.pubkey = ed25519_pubkey_ctx_create(state.public_key);
+    state.pool = ed25519_pool_create(0);
+
+    /* the keys left by create_keypairs_batch sign the batch entries */
+    for (i = 0; i < KEYPAIR_BATCH; ++i) {
+        state.message_ptrs[i] = state.message + i * BATCH_MESSAGE;
+        state.message_lens[i] = BATCH_MESSAGE;
+        state.public_key_ptrs[i] = state.batch_public_keys + i * 32;
+        state.shared_public_key_ptrs[i] = state.public_key;
+        state.signature_ptrs[i] = state.batch_signatures + i * 64;
+        state.shared_signature_ptrs[i] = state.shared_signatures + i * 64;
+        ed25519_sign(state.batch_signatures + i * 64, state.message_ptrs[i], BATCH_MESSAGE,
+                     state.public_key_ptrs[i], state.batch_private_keys + i * 64);
+        ed25519_signer_sign(state.signer, state.shared_signatures + i * 64, state.message_ptrs[i], BATCH_MESSAGE);
+
+        state.jobs[i].signature = state.job_signatures + i * 64;
+        state.jobs[i].message = state.message_ptrs[i];
+        state.jobs[i].message_len = BATCH_MESSAGE;
+        state.jobs[i].signer = NULL;
+        state.jobs[i].public_key = state.public_key_ptrs[i];
+        state.jobs[i].private_key = state.batch_private_keys + i * 64;
+    }
+
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        state.message_len = sizes[i];
+        run("sign", sizes[i], bench_sign, &state, samples);
+        run("signer_sign", sizes[i], bench_signer_sign, &state, samples);
+        run("verify", sizes[i], bench_verify, &state, samples);
+        run("verify_prepared", sizes[i], bench_verify_prepared, &state, samples);
+        run("sha512", sizes[i], bench_sha512, &state, samples);
+    }
+
+    run("verify_loop_64", BATCH_MESSAGE, bench_verify_loop, &state, samples);
+    run("verify_batch_64", BATCH_MESSAGE, bench_verify_batch, &state, samples);
+    run("verify_batch_64_shared_key", BATCH_MESSAGE, bench_verify_batch_shared_key, &state, samples);
+    run("sign_batch_64", BATCH_MESSAGE, bench_sign_batch, &state, samples);
+    run("sign_batch_64_pool", BATCH_MESSAGE, bench_sign_batch_pool, &state, samples);
+#ifndef ED25519_NO_SEED
+    run("create_seeds_64", 0, bench_create_seeds, &state, samples);
+#endif
+    run("key_exchange", 0, bench_key_exchange, &state, samples);
+    run("key_exchange_batch_64", 0, bench_key_exchange_batch, &state, samples);
+    run("add_scalar", 0, bench_add_scalar, &state, samples);
+    run("fe_mul", 0, bench_fe_mul, &state, samples);
+    run("fe_invert", 0, bench_fe_invert, &state, samples);
+    run("ge_scalarmult_base", 0, bench_ge_scalarmult_base, &state, samples);
+
+    if (output && !(out = fopen(output, "w"))) {
+        perror(output);
+        return 1;
+    }
+
+    write_json(out);
+
+    if (out != stdout) {
+        fclose(out);
+    }
+
+    ed25519_pool_destroy(state.pool);
+    ed25519_pubkey_ctx_destroy(state.pubkey);
+    ed25519_signer_destroy(state.signer);
+    free(state.message);
+    return 0;
+}
@@ -41,3 +41,5 @@ FOUNDATION_EXPORT const unsigned char KinBaseVersionString[];
 #import <KinBase/Validate.pbobjc.h>
 
 #import "kined25519.h"
+#import "solana_codec.h"
+#import "solana_compiler.h"
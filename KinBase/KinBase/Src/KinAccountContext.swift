@@ -111,9 +111,26 @@ public protocol KinPaymentWriteOperations {
      */
     func sendKinPayments(_ payments: [KinPaymentItem], memo: KinMemo, sourceAccountSpec: AccountSpec, destinationAccountSpec: AccountSpec) -> Promise<[KinPayment]>
 
+    /**
+     Sends payments in as few `KinTransaction`s as fit under Solana's transaction size limit, so a payout to many accounts doesn't need to be split by hand.
+     - Note: Payments carrying invoices are sent in a single transaction, as with `sendKinPayments`, since the memo references the whole invoice list.
+     - Note: Transactions are sent one after the other. If one fails after others were sent, the error is `KinAccountContext.Errors.partiallySent` with the payments already sent and the failure.
+     - Parameter payments: array of `KinPaymentItem`s to be sent
+     - Parameter memo: a memo included in every transaction. If no memo is desired, then set it to `KinMemo.none`
+     - Returns: a `Promise` with the blockchain confirmed `KinPayment`s of every transaction, in the order they were sent, or an error
+     */
+    func sendPackedKinPayments(_ payments: [KinPaymentItem], memo: KinMemo) -> Promise<[KinPayment]>
+
     func payInvoice(processingAppIdx: AppIndex, destinationAccount: PublicKey, invoice: Invoice, type: KinBinaryMemo.TransferType) -> Promise<KinPayment>
 }
 
+public extension KinPaymentWriteOperations {
+    /// Conformers that don't pack payments send them all in one transaction.
+    func sendPackedKinPayments(_ payments: [KinPaymentItem], memo: KinMemo) -> Promise<[KinPayment]> {
+        return sendKinPayments(payments, memo: memo, sourceAccountSpec: .preferred, destinationAccountSpec: .preferred)
+    }
+}
+
 /**
  Instantiate a `KinAccountContext` to operate on a `KinAccount` when you have a private key.
 
@@ -125,6 +142,9 @@ public protocol KinPaymentWriteOperations {
 public class KinAccountContext {
     public enum Errors: Error {
         case unknown
+        /// Some of the transactions of a packed send went through before one
+        /// failed with `error`; `payments` are those already sent.
+        case partiallySent(payments: [KinPayment], error: Error)
     }
 
     /// Provides different ways to build a `KinAccountContext`. Initialize the `Builder` with a `KinEnvironment` to start.
@@ -558,6 +578,45 @@ extension KinAccountContext: KinPaymentWriteOperations {
         return attempt()
     }
 
+    public func sendPackedKinPayments(_ payments: [KinPaymentItem], memo: KinMemo) -> Promise<[KinPayment]> {
+        log.info(msg: #function)
+        guard payments.allSatisfy({ $0.invoice == nil }) else {
+            return sendKinPayments(payments, memo: memo)
+        }
+        
+        func send(_ packs: ArraySlice<[KinPaymentItem]>, sent: [KinPayment]) -> Promise<[KinPayment]> {
+            guard let pack = packs.first else {
+                return Promise(sent)
+            }
+            
+            return sendKinPayments(pack, memo: memo)
+                .recover(on: dispatchQueue) { error -> Promise<[KinPayment]> in
+                    guard !sent.isEmpty else {
+                        return Promise(error)
+                    }
+                    
+                    return Promise(Errors.partiallySent(payments: sent, error: error))
+                }
+                .then(on: dispatchQueue) { packPayments -> Promise<[KinPayment]> in
+                    send(packs.dropFirst(), sent: sent + packPayments)
+                }
+        }
+        
+        // Size with the token account a retry would send from
+        return all(getAccount(), service.resolveTokenAccounts(account: accountPublicKey))
+            .then(on: dispatchQueue) { account, tokenAccounts -> Promise<[[KinPaymentItem]]> in
+                self.service.packPayments(
+                    ownerKey: account.publicKey,
+                    sourceKey: tokenAccounts.first?.publicKey ?? account.tokenAccounts.first?.publicKey ?? account.publicKey,
+                    paymentItems: payments,
+                    memo: memo
+                )
+            }
+            .then(on: dispatchQueue) { packs -> Promise<[KinPayment]> in
+                send(packs[...], sent: [])
+            }
+    }
+    
     public func payInvoice(processingAppIdx: AppIndex, destinationAccount: PublicKey, invoice: Invoice, type: KinBinaryMemo.TransferType = .spend) -> Promise<KinPayment> {
         log.info(msg: #function)
         do {
@@ -11,7 +11,7 @@ import Foundation
 extension CreateAccountRequestV4 {
     var protoRequest: APBAccountV4CreateAccountRequest {
         let t = APBCommonV4Transaction()
-        t.value = transaction.encode()
+        t.value = encodedTransaction
 
         let request = APBAccountV4CreateAccountRequest()
         request.transaction = t
@@ -88,7 +88,7 @@ extension SignTransactionRequestV4 {
     var protoRequest: APBTransactionV4SignTransactionRequest {
         let request = APBTransactionV4SignTransactionRequest()
         request.transaction = APBCommonV4Transaction()
-        request.transaction.value = transaction.encode()
+        request.transaction.value = encodedTransaction
         request.invoiceList = invoiceList?.proto
 
         return request
@@ -99,7 +99,7 @@ extension SubmitTransactionRequestV4 {
     var protoRequest: APBTransactionV4SubmitTransactionRequest {
         let request = APBTransactionV4SubmitTransactionRequest()
         request.transaction = APBCommonV4Transaction()
-        request.transaction.value = transaction.encode()
+        request.transaction.value = encodedTransaction
         request.invoiceList = invoiceList?.proto
         request.commitment = APBCommonV4Commitment.recent
         
@@ -56,9 +56,17 @@ public protocol KinAccountCreationApiV4 {
 // MARK: - Request & Response
 public struct CreateAccountRequestV4 {
     public let transaction: Transaction
+    
+    /// The wire encoding of `transaction`.
+    let encodedTransaction: Data
 
     public init(transaction: Transaction) {
+        self.init(transaction: transaction, encodedTransaction: transaction.encode())
+    }
+    
+    init(transaction: Transaction, encodedTransaction: Data) {
         self.transaction = transaction
+        self.encodedTransaction = encodedTransaction
     }
 }
 
@@ -200,10 +200,18 @@ public struct GetMinFeeForTransactionResponseV4 {
 public struct SignTransactionRequestV4 {
     public let transaction: Transaction
     public let invoiceList: InvoiceList?
+    
+    /// The wire encoding of `transaction`.
+    let encodedTransaction: Data
 
     public init(transaction: Transaction,
                 invoiceList: InvoiceList? = nil) {
+        self.init(transaction: transaction, encodedTransaction: transaction.encode(), invoiceList: invoiceList)
+    }
+    
+    init(transaction: Transaction, encodedTransaction: Data, invoiceList: InvoiceList? = nil) {
         self.transaction = transaction
+        self.encodedTransaction = encodedTransaction
         self.invoiceList = invoiceList
     }
 }
@@ -232,10 +240,18 @@ public struct SignTransactionResponseV4 {
 public struct SubmitTransactionRequestV4 {
     public let transaction: Transaction
     public let invoiceList: InvoiceList?
+    
+    /// The wire encoding of `transaction`.
+    let encodedTransaction: Data
 
     public init(transaction: Transaction,
                 invoiceList: InvoiceList? = nil) {
+        self.init(transaction: transaction, encodedTransaction: transaction.encode(), invoiceList: invoiceList)
+    }
+    
+    init(transaction: Transaction, encodedTransaction: Data, invoiceList: InvoiceList? = nil) {
         self.transaction = transaction
+        self.encodedTransaction = encodedTransaction
         self.invoiceList = invoiceList
     }
 }
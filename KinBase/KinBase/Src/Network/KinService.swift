@@ -39,6 +39,8 @@ public protocol KinServiceType {
 
     func buildAndSignTransaction(ownerKey: KeyPair, sourceKey: PublicKey, nonce: Int64, paymentItems: [KinPaymentItem], memo: KinMemo, fee: Quark, createAccountInstructions: [Instruction], additionalSigners: [KeyPair]) -> Promise<KinTransaction>
 
+    func packPayments(ownerKey: PublicKey, sourceKey: PublicKey, paymentItems: [KinPaymentItem], memo: KinMemo) -> Promise<[[KinPaymentItem]]>
+
     func submitTransaction(transaction: KinTransaction) -> Promise<KinTransaction>
     
     func buildSignAndSubmitTransaction(buildAndSignTransaction: @escaping () -> Promise<KinTransaction>) -> Promise<KinTransaction>
@@ -50,6 +52,13 @@ public protocol KinServiceType {
     func invalidateTokenAccountsCache(account: PublicKey)
 }
 
+public extension KinServiceType {
+    /// Services that don't size transactions send every payment in one.
+    func packPayments(ownerKey: PublicKey, sourceKey: PublicKey, paymentItems: [KinPaymentItem], memo: KinMemo) -> Promise<[[KinPaymentItem]]> {
+        return Promise([paymentItems])
+    }
+}
+
 public class KinServiceV4 {
     public enum Errors: Error, Equatable {
         case unknown
@@ -111,6 +120,16 @@ public class KinServiceV4 {
     }()
     private let cache = Cache<String>()
     
+    /// Payments retried after a stale blockhash rebuild the same
+    /// instructions, so the last compiled transaction is kept and only
+    /// re-targeted at the new blockhash. Promise callbacks run on different
+    /// queues, so it's only read and written on `templateQueue`.
+    private var lastTransactionTemplate: TransactionTemplate?
+    private let templateQueue = DispatchQueue(label: "KinBase.KinServiceV4.transactionTemplate")
+
+    /// How many destinations `packPayments` resolves at once.
+    private static let maxConcurrentResolutions = 8
+    
     private func warmCache() {
         let serviceConfigPromise: Promise<Any> = self.cache.warm(key: "serviceConfig") { _ in
             self.networkOperationHandler.queueWork { [weak self] respond in
@@ -238,6 +257,62 @@ extension KinServiceV4 : KinServiceType {
         }
     }
     
+    private func transactionTemplate(payer: PublicKey, instructions: [Instruction]) -> TransactionTemplate {
+        let lastTemplate = templateQueue.sync { lastTransactionTemplate }
+        if let template = lastTemplate, template.matches(payer: payer, instructions: instructions) {
+            return template
+        }
+        
+        // Compiled outside the queue so other payments aren't held up
+        let template = TransactionTemplate(payer: payer, instructions: instructions)
+        templateQueue.sync {
+            lastTransactionTemplate = template
+        }
+        
+        return template
+    }
+    
+    private func createTokenAccountInstructions(serviceConfig: GetServiceConfigResponseV4, lamports: UInt64, tokenAccount: PublicKey, owner: PublicKey) -> [Instruction] {
+        let subsidizer = serviceConfig.subsidizerAccount!
+        let programKey = serviceConfig.tokenProgram!
+        let mint = serviceConfig.token!
+        
+        return [
+            SystemProgram.createAccountInstruction(
+                subsidizer: subsidizer,
+                address: tokenAccount,
+                owner: programKey,
+                lamports: lamports,
+                size: TokenProgram.accountSize
+            ),
+            TokenProgram.initializeAccountInstruction(
+                account: tokenAccount,
+                mint: mint,
+                owner: tokenAccount,
+                programKey: programKey
+            ),
+            TokenProgram.setAuthority(account: tokenAccount, currentAuthority: tokenAccount, newAuthority: subsidizer, authorityType: .authorityCloseAccount, programKey: programKey),
+            TokenProgram.setAuthority(account: tokenAccount, currentAuthority: tokenAccount, newAuthority: owner, authorityType: .authorityAccountHolder, programKey: programKey)
+        ]
+    }
+    
+    private func memoInstructions(_ memo: KinMemo) -> [Instruction] {
+        guard memo != .none else {
+            return []
+        }
+        
+        switch memo.type {
+        case .bytes:
+            if let agoraMemo = memo.agoraMemo {
+                return [MemoProgram.memoInsutruction(with: agoraMemo.encode().base64EncodedData())]
+            }
+            return []
+            
+        case .text:
+            return [MemoProgram.memoInsutruction(with: memo.bytes.data)]
+        }
+    }
+    
     private func cachedMinRentExemption() -> Promise<GetMinimumBalanceForRentExemptionResponseV4> {
         return self.cache.resolve(key: "minRentExemption", timeoutOverride: 1000*60*20 /* 30 Minutes */) { _ in
             self.networkOperationHandler.queueWork { [weak self] respond in
@@ -343,12 +418,12 @@ extension KinServiceV4 : KinServiceType {
                     if instructions.isEmpty {
                         respond.onSuccess(())
                     } else {
-                        let transaction = try! Transaction(payer: subsidizer, instructions: instructions)
+                        let (_, envelope) = try! Transaction(payer: subsidizer, instructions: instructions)
                             .updatingBlockhash(recentBlockHash.blockHash!)
-                            .signing(using: signer)
+                            .signingAndEncoding(using: [signer])
                         
                         let kinTransaction = try! KinTransaction(
-                            envelopeXdrBytes: transaction.encode().bytes,
+                            envelopeXdrBytes: envelope.bytes,
                             record: .inFlight(ts: Date().timeIntervalSince1970),
                             network: self.network
                         )
@@ -413,14 +488,14 @@ extension KinServiceV4 : KinServiceType {
                     )
                 }
                 
-                let transaction = try! Transaction(
+                let (transaction, envelope) = try! Transaction(
                     payer: subsidizer,
                     instructions: instructions
                 )
                 .updatingBlockhash(recentBlockHash.blockHash!)
-                .signing(using: signer)
+                .signingAndEncoding(using: [signer])
                 
-                let request = CreateAccountRequestV4(transaction: transaction)
+                let request = CreateAccountRequestV4(transaction: transaction, encodedTransaction: envelope)
                 self.requestPrint(request: request)
                 self.accountCreationApi.createAccount(request: request) { [weak self] response in
                     self?.responsePrint(response:response)
@@ -462,34 +537,18 @@ extension KinServiceV4 : KinServiceType {
                     return
                 }
 
-                let subsidizer = serviceConfig.subsidizerAccount!
-                let programKey = serviceConfig.tokenProgram!
-                let mint = serviceConfig.token!
-
                 guard let ephemeralKeypair = KeyPair.generate()
                 else {
                     respond.onError?(Errors.unknown)
                     return
                 }
-                let pub = ephemeralKeypair.asPublicKey()
 
-                let instructions: [Instruction] = [
-                    SystemProgram.createAccountInstruction(
-                        subsidizer: subsidizer,
-                        address: pub,
-                        owner: programKey,
-                        lamports: minRentExemption.lamports,
-                        size: TokenProgram.accountSize
-                    ),
-                    TokenProgram.initializeAccountInstruction(
-                        account: pub,
-                        mint: mint,
-                        owner: pub,
-                        programKey: programKey
-                    ),
-                    TokenProgram.setAuthority(account: pub, currentAuthority: pub, newAuthority: subsidizer, authorityType: .authorityCloseAccount, programKey: programKey),
-                    TokenProgram.setAuthority(account: pub, currentAuthority: pub, newAuthority: account, authorityType: .authorityAccountHolder, programKey: programKey)
-                ]
+                let instructions = self.createTokenAccountInstructions(
+                    serviceConfig: serviceConfig,
+                    lamports: minRentExemption.lamports,
+                    tokenAccount: ephemeralKeypair.asPublicKey(),
+                    owner: account
+                )
 
                 respond.onSuccess((instructions, ephemeralKeypair))
             }
@@ -719,23 +778,7 @@ extension KinServiceV4 : KinServiceType {
                 self.log.debug(msg: "sourceKey: \(sourceKey)")
                 self.log.debug(msg: "paymentItems: \(paymentItems)")
                 
-                var instructions: [Instruction] = []
-                
-                if memo != .none {
-                    switch memo.type {
-                    case .bytes:
-                        if memo.agoraMemo != nil {
-                            instructions.append(
-                                MemoProgram.memoInsutruction(with: memo.agoraMemo!.encode().base64EncodedData())
-                            )
-                        }
-                        
-                    case .text:
-                        instructions.append(
-                            MemoProgram.memoInsutruction(with: memo.bytes.data)
-                        )
-                    }
-                }
+                var instructions = self.memoInstructions(memo)
 
                 instructions.append(contentsOf: createAccountInstructions)
                 
@@ -751,22 +794,21 @@ extension KinServiceV4 : KinServiceType {
 
                 var signers = additionalSigners
                 signers.insert(signer, at: 0)
-                let transaction = try! Transaction(
+                let (transaction, envelope) = try! self.transactionTemplate(
                     payer: subsidizer,
                     instructions: instructions
                 )
-                .updatingBlockhash(recentBlockHash.blockHash!)
-                .signing(using: signers)
+                .signingAndEncoding(blockhash: recentBlockHash.blockHash!, using: signers)
                 
                 print(transaction)
                 
                 let kinTransaction = try! KinTransaction(
-                    envelopeXdrBytes: transaction.encode().bytes,
+                    envelopeXdrBytes: envelope.bytes,
                     record: .inFlight(ts: Date().timeIntervalSince1970),
                     network: self.network
                 )
 
-                let request = SignTransactionRequestV4(transaction: transaction, invoiceList: kinTransaction.invoiceList)
+                let request = SignTransactionRequestV4(transaction: transaction, encodedTransaction: envelope, invoiceList: kinTransaction.invoiceList)
                 self.requestPrint(request: request)
                 self.transactionApi.signTransaction(request: request) { [weak self] response in
                     self?.responsePrint(response: response)
@@ -799,6 +841,101 @@ extension KinServiceV4 : KinServiceType {
         }
     }
     
+    /// Packs `paymentItems` into as few transactions as fit under Solana's
+    /// size limit, sized exactly as `buildAndSignTransaction` would build
+    /// them with `memo`.
+    ///
+    /// A pack rejected for an invalid account is retried with the
+    /// instructions creating each destination that has no token account, and
+    /// its new account as a signer, so those payments are sized with them.
+    /// Each destination is resolved once, a few at a time, and any failure
+    /// other than the account not existing fails the packing.
+    public func packPayments(ownerKey: PublicKey, sourceKey: PublicKey, paymentItems: [KinPaymentItem], memo: KinMemo) -> Promise<[[KinPaymentItem]]> {
+        var destinations = [PublicKey]()
+        var seen = Set<[Byte]>()
+        for paymentItem in paymentItems where seen.insert(paymentItem.destAccount.bytes).inserted {
+            destinations.append(paymentItem.destAccount)
+        }
+        
+        return all(cachedServiceConfig(), hasTokenAccounts(destinations[...], resolved: [:])).then { serviceConfig, resolved -> [[KinPaymentItem]] in
+            guard serviceConfig.result == GetServiceConfigResponseV4.Result.ok,
+                  let subsidizer = serviceConfig.subsidizerAccount,
+                  let programKey = serviceConfig.tokenProgram,
+                  serviceConfig.token != nil else {
+                throw Errors.unknown
+            }
+            
+            let groups = paymentItems.enumerated().map { index, paymentItem -> [Instruction] in
+                let transfer = TokenProgram.transferInstruction(
+                    source: sourceKey,
+                    destination: paymentItem.destAccount,
+                    owner: ownerKey,
+                    amount: paymentItem.amount,
+                    programKey: programKey
+                )
+                
+                guard resolved[paymentItem.destAccount.bytes] == false else {
+                    return [transfer]
+                }
+                
+                // Only a distinct key matters for the size, not which account
+                // it is, so each group gets a fixed key derived from its index
+                let createAccount = self.createTokenAccountInstructions(
+                    serviceConfig: serviceConfig,
+                    lamports: 0,
+                    tokenAccount: KinServiceV4.placeholderTokenAccount(index: index),
+                    owner: paymentItem.destAccount
+                )
+                
+                return createAccount + [transfer]
+            }
+            
+            let packer = TransactionPacker(payer: subsidizer, sharedInstructions: self.memoInstructions(memo))
+            let packs = try packer.pack(groups: groups)
+            
+            return packs.map { pack in pack.map { paymentItems[$0] } }
+        }
+    }
+    
+    /// Resolves whether each of `accounts` has a token account, at most
+    /// `maxConcurrentResolutions` at a time, accumulating into `resolved`.
+    private func hasTokenAccounts(_ accounts: ArraySlice<PublicKey>, resolved: [[Byte]: Bool]) -> Promise<[[Byte]: Bool]> {
+        guard !accounts.isEmpty else {
+            return Promise(resolved)
+        }
+        
+        let wave = accounts.prefix(KinServiceV4.maxConcurrentResolutions)
+        let resolutions = wave.map { account in
+            resolveTokenAccounts(account: account)
+                .then { !$0.isEmpty }
+                .recover { error -> Promise<Bool> in
+                    guard (error as? Errors) == Errors.itemNotFound else {
+                        return Promise(error)
+                    }
+                    
+                    return Promise(false)
+                }
+        }
+        
+        return all(resolutions).then { hasTokenAccount -> Promise<[[Byte]: Bool]> in
+            var resolved = resolved
+            for (account, hasTokenAccount) in zip(wave, hasTokenAccount) {
+                resolved[account.bytes] = hasTokenAccount
+            }
+            
+            return self.hasTokenAccounts(accounts.dropFirst(wave.count), resolved: resolved)
+        }
+    }
+    
+    /// A distinct, non-zero key for the `index`th payment's placeholder
+    /// token account. It never equals the all-zero system program key, which
+    /// would be shared with the instructions and undersize the pack.
+    private static func placeholderTokenAccount(index: Int) -> PublicKey {
+        var bytes = [Byte](repeating: 0xff, count: 32)
+        withUnsafeBytes(of: UInt64(index).littleEndian) { bytes.replaceSubrange(0..<8, with: $0) }
+        return PublicKey(bytes)!
+    }
+    
     public func submitTransaction(transaction: KinTransaction) -> Promise<KinTransaction> {
         return networkOperationHandler.queueWork { [weak self] respond in
             guard let self = self else {
@@ -806,8 +943,10 @@ extension KinServiceV4 : KinServiceType {
                 return
             }
 
+            let envelope = Data(transaction.envelopeXdrBytes)
             let request = SubmitTransactionRequestV4(
-                transaction: Transaction(data: Data(transaction.envelopeXdrBytes))!,
+                transaction: Transaction(data: envelope)!,
+                encodedTransaction: envelope,
                 invoiceList: transaction.invoiceList
             )
             self.requestPrint(request: request)
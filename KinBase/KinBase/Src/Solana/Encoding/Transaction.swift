@@ -57,50 +57,13 @@ public struct Transaction {
         )
     }
     
+    /// Compiles `instructions` into a message paid for by `payer`, with
+    /// the accounts ordered as `AccountMeta`'s `Comparable` conformance
+    /// describes: the payer first, then signers, then writable accounts,
+    /// with programs last.
     public init(payer: Key32, instructions: [Instruction]) {
-        var accounts: [AccountMeta] = []
-        
-        accounts.append(
-            AccountMeta.writable(publicKey: payer, signer: true, payer: true)
-        )
-        
-        // Extract all of the unique accounts from the instructions.
-        instructions.forEach {
-            accounts.append(
-                AccountMeta.program(publicKey: $0.program)
-            )
-            accounts.append(contentsOf: $0.accounts)
-        }
-        
-        // Sort the account meta's based on:
-        //   1. Payer is always the first account / signer.
-        //   1. All signers are before non-signers.
-        //   2. Writable accounts before read-only accounts.
-        //   3. Programs last
-        let uniqueAccounts = accounts.filterUniqueAccounts().sorted()
-        
-        let signers = uniqueAccounts.filter { $0.isSigner }
-        let readOnlySigned = uniqueAccounts.filter { !$0.isWritable && $0.isSigner }
-        let readOnly = uniqueAccounts.filter { !$0.isWritable && !$0.isSigner }
-        
-        let header = MessageHeader(
-            signatureCount: signers.count,
-            readOnlySignedCount: readOnlySigned.count,
-            readOnlyCount: readOnly.count
-        )
-        
-        let accountPublicKeys = uniqueAccounts.map { $0.publicKey }
-        let messageInstructions = instructions.map { $0.compile(using: accountPublicKeys) }
-        
-        let message = Message(
-            header: header,
-            accounts: accountPublicKeys,
-            recentBlockhash: Hash.zero,
-            instructions: messageInstructions
-        )
-        
         self.init(
-            message: message,
+            message: SolanaCodec.compile(payer: payer, instructions: instructions),
             signatures: []
         )
     }
@@ -124,31 +87,109 @@ public struct Transaction {
         // Swift does not support splatting, wrapping the function this way allows it to be called with an array or variadic
         return try signing(using: keyPairs)
     }
+    
+    /// Signs the natively encoded message, see `signingAndEncoding(using:)`.
     public func signing(using keyPairs: [KeyPair]) throws -> Transaction {
-        let requiredSignatureCount = message.header.signatureCount
-        if keyPairs.count > requiredSignatureCount {
-            throw SigningError.tooManySigners
+        try signingAndEncoding(using: keyPairs).transaction
+    }
+    
+    /// Signs with long-lived `Signer`s, which skip the per-signature key
+    /// setup that signing with a `KeyPair` does.
+    public func signing(using signers: [Signer]) throws -> Transaction {
+        try signingAndEncoding(using: signers).transaction
+    }
+    
+    /// Signs many transactions with one `Signer`, spreading the signatures
+    /// over the threads of `pool`. Transactions are returned in order.
+    public static func signing(_ transactions: [Transaction], using signer: Signer, pool: SigningPool) throws -> [Transaction] {
+        let slots = try transactions.map {
+            try $0.message.signatureSlot(for: signer.publicKey)
         }
         
-        let messageData = message.encode()
+        let signatures = signer.sign(
+            messages: transactions.map { $0.message.encode().bytes },
+            pool: pool
+        )
         
-        var signatures = [Signature](repeating: Signature.zero, count: requiredSignatureCount)
+        return zip(transactions, zip(slots, signatures)).map { transaction, signed in
+            let (slot, signature) = signed
+            
+            var signatures = transaction.requiredSignatures
+            signatures[slot] = Signature(signature)!
+            return Transaction(message: transaction.message, signatures: signatures)
+        }
+    }
+    
+    /// The signatures so far, followed by empty slots for the rest of the
+    /// signatures the message requires.
+    private var requiredSignatures: [Signature] {
+        var signatures = [Signature](repeating: Signature.zero, count: message.header.signatureCount)
         self.signatures.enumerated().forEach { index, signature in
             signatures[index] = signature
         }
         
-        for keyPair in keyPairs {
-            let key = Key32(keyPair.publicKey.bytes)!
-            
-            guard let signatureIndex = message.accounts.firstIndex(of: key) else {
-                throw SigningError.accountNotInAccountList("Account: \(key)")
-            }
-            
-            let signature = keyPair.sign(messageData.bytes)
-            signatures[signatureIndex] = Signature(signature)!
+        return signatures
+    }
+}
+
+// MARK: - Signing and Encoding -
+
+extension Transaction {
+    
+    /// Signs and encodes the transaction in one pass. The message is
+    /// encoded once, right behind its signature slots, and each key pair
+    /// signs it in place. `data` is what `signing(using:)` followed by
+    /// `encode()` would produce, without the second copy of the message.
+    public func signingAndEncoding(using keyPairs: [KeyPair]) throws -> (transaction: Transaction, data: Data) {
+        try signingAndEncoding(signers: keyPairs.map { keyPair in
+            (keyPair.publicKey, { keyPair.sign($0, into: $1) })
+        })
+    }
+    
+    /// Signs and encodes the transaction in one pass with long-lived
+    /// `Signer`s, see `signingAndEncoding(using:)`.
+    public func signingAndEncoding(using signers: [Signer]) throws -> (transaction: Transaction, data: Data) {
+        try signingAndEncoding(signers: signers.map { signer in
+            (signer.publicKey, { signer.sign($0, into: $1) })
+        })
+    }
+    
+    private func signingAndEncoding(signers: [(publicKey: PublicKey, sign: SolanaCodec.Sign)]) throws -> (transaction: Transaction, data: Data) {
+        let slots = try message.signatureSlots(for: signers)
+        let signatures = requiredSignatures
+        let data = SolanaCodec.encode(message, signatures: signatures, signers: slots)
+        
+        return (
+            Transaction(message: message, signatures: SolanaCodec.signatures(in: data, count: signatures.count)),
+            data
+        )
+    }
+}
+
+extension Message {
+    
+    /// Pairs each signer with its signature slot, which is the position of
+    /// its key among the accounts that sign.
+    func signatureSlots(for signers: [(publicKey: PublicKey, sign: SolanaCodec.Sign)]) throws -> [(index: Int, sign: SolanaCodec.Sign)] {
+        let requiredSignatureCount = header.signatureCount
+        if signers.count > requiredSignatureCount {
+            throw Transaction.SigningError.tooManySigners
+        }
+        
+        return try signers.map { signer in
+            (try signatureSlot(for: signer.publicKey), signer.sign)
+        }
+    }
+    
+    /// The position of `publicKey` among the accounts that sign.
+    func signatureSlot(for publicKey: PublicKey) throws -> Int {
+        let key = Key32(publicKey.bytes)!
+        
+        guard let signatureIndex = accounts.prefix(header.signatureCount).firstIndex(of: key) else {
+            throw Transaction.SigningError.accountNotInAccountList("Account: \(key)")
         }
         
-        return Transaction(message: message, signatures: signatures)
+        return signatureIndex
     }
 }
 
@@ -157,33 +198,16 @@ public struct Transaction {
 extension Transaction: SolanaCodable {
     
     public init?(data: Data) {
-        let (signatureCount, payload) = ShortVec.decodeLength(data)
-        
-        guard payload.count >= signatureCount * Signature.length else {
-            return nil // Mismatched data
-        }
-        
-        let signatures = payload.chunk(size: Signature.length, count: signatureCount) { Signature($0) }?.compactMap { $0 } ?? []
-        let messageData = payload.tail(from: signatureCount * Signature.length)
-        
-        guard let message = Message(data: messageData) else {
+        guard let decoded = SolanaCodec.decodeTransaction(data) else {
             return nil
         }
         
-        self.signatures = signatures
-        self.message = message
+        self.signatures = decoded.signatures
+        self.message = decoded.message
     }
     
     public func encode() -> Data {
-        var data = Data()
-        
-        data.append(
-            ShortVec.encode(signatures.map { $0.data })
-        )
-        
-        data.append(message.encode())
-        
-        return data
+        SolanaCodec.encode(message, signatures: signatures)
     }
 }
 
@@ -194,45 +218,3 @@ extension Transaction {
         case invalidKey
     }
 }
-
-/**
- * Provide a unique set by publicKey of AccountMeta with the highest write permission
- */
-extension Array where Element == AccountMeta {
-    
-    func filterUniqueAccounts() -> [AccountMeta] {
-        var container: [AccountMeta] = []
-        for account in self {
-            var found = false
-            
-            for (index, existingAccount) in container.enumerated() {
-                if account.publicKey == existingAccount.publicKey {
-                    var updatedAccount = existingAccount
-                    
-                    // Promote the existing account to writable if applicable
-                    if account.isSigner {
-                        updatedAccount.isSigner = true
-                    }
-                    
-                    if account.isWritable {
-                        updatedAccount.isWritable = true
-                    }
-                    
-                    if account.isPayer {
-                        updatedAccount.isPayer = true
-                    }
-                    
-                    container[index] = updatedAccount
-                    found = true
-                    break
-                }
-            }
-            
-            if !found {
-                container.append(account)
-            }
-        }
-        
-        return container
-    }
-}
@@ -0,0 +1,194 @@
+//
+//  TransactionPacker.swift
+//  KinBase
+//
+//  Created by Kik Interactive Inc.
+//  Copyright © 2021 Kin Foundation. All rights reserved.
+//
+
+import Foundation
+
+/// Packs instructions into as few transactions as fit under Solana's
+/// packet limit, each paid for by `payer` and led by the same shared
+/// instructions, such as a memo.
+///
+/// The encoded size of a signed transaction only depends on which keys and
+/// signers it has, not on their order, so sizes are tracked exactly as
+/// instructions are added, without compiling or encoding a candidate:
+///
+///     short_vec(signers) + 64 * signers + 3 + short_vec(keys) + 32 * keys
+///         + 32 + short_vec(instructions) + sum of the instruction sizes
+///
+/// Instructions are placed first fit, largest first, which for items as
+/// alike as payments leaves at most one transaction partly empty.
+public struct TransactionPacker {
+    public enum Errors: Error, Equatable {
+        /// The instruction (or group) at `index` doesn't fit in a transaction
+        /// on its own
+        case instructionTooLarge(index: Int)
+    }
+    
+    /// The largest transaction Solana accepts, an IPv6 MTU less headers.
+    public static let transactionSizeLimit = 1232
+    
+    public let payer: Key32
+    public let sharedInstructions: [Instruction]
+    public let sizeLimit: Int
+    
+    // MARK: - Init -
+    
+    public init(payer: Key32, sharedInstructions: [Instruction] = [], sizeLimit: Int = TransactionPacker.transactionSizeLimit) {
+        self.payer = payer
+        self.sharedInstructions = sharedInstructions
+        self.sizeLimit = sizeLimit
+    }
+    
+    // MARK: - Packing -
+    
+    /// The encoded size of the signed transaction of the shared instructions
+    /// followed by `instructions`.
+    public func size(of instructions: [Instruction]) -> Int {
+        var bin = emptyBin()
+        bin.add(instructions)
+        return bin.size
+    }
+    
+    /// Groups the indices of `instructions` by transaction. Each group is in
+    /// ascending order, and groups are ordered by their first index.
+    public func pack(_ instructions: [Instruction]) throws -> [[Int]] {
+        try pack(groups: instructions.map { [$0] })
+    }
+    
+    /// Like `pack(_:)`, for items of several instructions that have to go in
+    /// the same transaction, such as a transfer and the instructions that
+    /// create its destination.
+    public func pack(groups: [[Instruction]]) throws -> [[Int]] {
+        let empty = emptyBin()
+        let costs = groups.map { empty.size(adding: $0) }
+        
+        // Largest first, ties in input order
+        let order = groups.indices.sorted {
+            costs[$0] != costs[$1] ? costs[$0] > costs[$1] : $0 < $1
+        }
+        
+        var bins: [Bin] = []
+        
+        for index in order {
+            let group = groups[index]
+            
+            if let fit = bins.firstIndex(where: { $0.size(adding: group) <= sizeLimit }) {
+                bins[fit].add(group, index: index)
+                continue
+            }
+            
+            guard costs[index] <= sizeLimit else {
+                throw Errors.instructionTooLarge(index: index)
+            }
+            
+            var bin = empty
+            bin.add(group, index: index)
+            bins.append(bin)
+        }
+        
+        return bins
+            .map { $0.members.sorted() }
+            .sorted { $0[0] < $1[0] }
+    }
+    
+    private func emptyBin() -> Bin {
+        var bin = Bin(payer: payer)
+        bin.add(sharedInstructions)
+        return bin
+    }
+}
+
+// MARK: - Bin -
+
+extension TransactionPacker {
+    private struct Bin {
+        private var keys: Set<[Byte]>
+        private var signers: Set<[Byte]>
+        private var instructionCount = 0
+        private var instructionBytes = 0
+        
+        private(set) var members: [Int] = []
+        
+        init(payer: Key32) {
+            keys = [payer.bytes]
+            signers = [payer.bytes]
+        }
+        
+        var size: Int {
+            encodedSize(keys: keys.count, signers: signers.count, instructionCount: instructionCount, instructionBytes: instructionBytes)
+        }
+        
+        /// The size after adding `instructions`, without adding them.
+        func size(adding instructions: [Instruction]) -> Int {
+            var newKeys: Set<[Byte]> = []
+            var newSigners: Set<[Byte]> = []
+            var newBytes = 0
+            
+            for instruction in instructions {
+                if !keys.contains(instruction.program.bytes) {
+                    newKeys.insert(instruction.program.bytes)
+                }
+                
+                for account in instruction.accounts {
+                    if !keys.contains(account.publicKey.bytes) {
+                        newKeys.insert(account.publicKey.bytes)
+                    }
+                    
+                    if account.isSigner && !signers.contains(account.publicKey.bytes) {
+                        newSigners.insert(account.publicKey.bytes)
+                    }
+                }
+                
+                newBytes += Bin.encodedSize(of: instruction)
+            }
+            
+            return encodedSize(
+                keys: keys.count + newKeys.count,
+                signers: signers.count + newSigners.count,
+                instructionCount: instructionCount + instructions.count,
+                instructionBytes: instructionBytes + newBytes
+            )
+        }
+        
+        mutating func add(_ instructions: [Instruction], index: Int? = nil) {
+            for instruction in instructions {
+                keys.insert(instruction.program.bytes)
+                
+                for account in instruction.accounts {
+                    keys.insert(account.publicKey.bytes)
+                    
+                    if account.isSigner {
+                        signers.insert(account.publicKey.bytes)
+                    }
+                }
+                
+                instructionCount += 1
+                instructionBytes += Bin.encodedSize(of: instruction)
+            }
+            
+            if let index = index {
+                members.append(index)
+            }
+        }
+        
+        private func encodedSize(keys: Int, signers: Int, instructionCount: Int, instructionBytes: Int) -> Int {
+            solana_short_vec_size(signers) + signers * Signature.length
+                + MessageHeader.length
+                + solana_short_vec_size(keys) + keys * Key32.length
+                + Hash.length
+                + solana_short_vec_size(instructionCount) + instructionBytes
+        }
+        
+        /// A compiled instruction: its program index, then its account
+        /// indices and data as short_vecs.
+        private static func encodedSize(of instruction: Instruction) -> Int {
+            1
+                + solana_short_vec_size(instruction.accounts.count) + instruction.accounts.count
+                + solana_short_vec_size(instruction.data.count) + instruction.data.count
+        }
+    }
+}
@@ -0,0 +1,87 @@
+//
+//  TransactionTemplate.swift
+//  KinBase
+//
+//  Created by Kik Interactive Inc.
+//  Copyright © 2021 Kin Foundation. All rights reserved.
+//
+
+import Foundation
+
+/// A transaction compiled and encoded once, ready to be signed against any
+/// recent blockhash. Retries of the same payment only differ in blockhash
+/// and signatures, so re-targeting a template patches the 32 blockhash
+/// bytes in a copy of its encoding and signs that copy in place, without
+/// sorting accounts, compiling instructions or encoding the message again.
+public struct TransactionTemplate {
+    
+    public let payer: Key32
+    public let instructions: [Instruction]
+    
+    /// The compiled message, with a zero blockhash.
+    public let message: Message
+    
+    /// The wire transaction, with empty signature slots and a zero blockhash.
+    public let data: Data
+    
+    /// The offset of the blockhash in `data`.
+    public let blockhashOffset: Int
+    
+    // MARK: - Init -
+    
+    public init(payer: Key32, instructions: [Instruction]) {
+        let message = Transaction(payer: payer, instructions: instructions).message
+        let signatureCount = message.header.signatureCount
+        
+        self.payer = payer
+        self.instructions = instructions
+        self.message = message
+        self.data = SolanaCodec.encode(
+            message,
+            signatures: [Signature](repeating: Signature.zero, count: signatureCount)
+        )
+        self.blockhashOffset = solana_transaction_message_offset(signatureCount) + solana_message_blockhash_offset(message.accounts.count)
+    }
+    
+    /// Whether the template was compiled from `payer` and `instructions`.
+    public func matches(payer: Key32, instructions: [Instruction]) -> Bool {
+        self.payer == payer && self.instructions == instructions
+    }
+    
+    // MARK: - Signing -
+    
+    /// Targets `blockhash` and signs, returning the signed transaction and
+    /// its wire encoding, as `Transaction.signingAndEncoding(using:)` would.
+    public func signingAndEncoding(blockhash: Hash, using keyPairs: [KeyPair]) throws -> (transaction: Transaction, data: Data) {
+        try signingAndEncoding(blockhash: blockhash, signers: keyPairs.map { keyPair in
+            (keyPair.publicKey, { keyPair.sign($0, into: $1) })
+        })
+    }
+    
+    /// Targets `blockhash` and signs with long-lived `Signer`s, see
+    /// `signingAndEncoding(blockhash:using:)`.
+    public func signingAndEncoding(blockhash: Hash, using signers: [Signer]) throws -> (transaction: Transaction, data: Data) {
+        try signingAndEncoding(blockhash: blockhash, signers: signers.map { signer in
+            (signer.publicKey, { signer.sign($0, into: $1) })
+        })
+    }
+    
+    private func signingAndEncoding(blockhash: Hash, signers: [(publicKey: PublicKey, sign: SolanaCodec.Sign)]) throws -> (transaction: Transaction, data: Data) {
+        let slots = try message.signatureSlots(for: signers)
+        let signatureCount = message.header.signatureCount
+        
+        var data = self.data
+        data.replaceSubrange(blockhashOffset..<blockhashOffset + Hash.length, with: blockhash.bytes)
+        data.withUnsafeMutableBytes {
+            SolanaCodec.sign($0.bindMemory(to: Byte.self), signatureCount: signatureCount, signers: slots)
+        }
+        
+        var message = self.message
+        message.recentBlockhash = blockhash
+        
+        return (
+            Transaction(message: message, signatures: SolanaCodec.signatures(in: data, count: signatureCount)),
+            data
+        )
+    }
+}
@@ -0,0 +1,91 @@
+//
+//  KeyDerivation.swift
+//  KinBase
+//
+//  Created by Kik Interactive Inc.
+//  Copyright © 2021 Kin Foundation. All rights reserved.
+//
+
+import Foundation
+
+/// SLIP-0010 hierarchical key derivation from a single seed, for paths
+/// like `m/44'/501'/0'/0'`. ed25519 only has hardened children, so every
+/// path component must be marked with `'`, `h` or `H`. Recently derived
+/// nodes are cached, so sibling paths only derive what they don't share.
+/// A `KeyDerivation` is not thread safe.
+public final class KeyDerivation {
+    
+    private let cache: OpaquePointer
+    
+    // MARK: - Init -
+    
+    public init?(seed: [Byte], cacheCapacity: Int = 64) {
+        let cache = seed.withUnsafeBufferPointer {
+            ed25519_hd_cache_create($0.baseAddress, $0.count, max(cacheCapacity, 1))
+        }
+        
+        guard let ctx = cache else {
+            return nil
+        }
+        
+        self.cache = ctx
+    }
+    
+    deinit {
+        ed25519_hd_cache_destroy(cache)
+    }
+    
+    // MARK: - Derivation -
+    
+    /// The key pair at `path`, or nil if the path is malformed.
+    public func keyPair(path: String) -> KeyPair? {
+        guard let node = node(path: path) else {
+            return nil
+        }
+        
+        return KeyPair(seed: Seed(node.key)!)
+    }
+    
+    /// Public keys of the children `path/start'` through
+    /// `path/(start + count - 1)'`, in order. Children are derived in
+    /// chunks spread over the threads of `pool`.
+    public func publicKeys(path: String, start: UInt32, count: Int, pool: SigningPool? = nil) -> [PublicKey]? {
+        guard count >= 0, var parent = node(path: path) else {
+            return nil
+        }
+        
+        var publicKeys = [Byte].zeroed(with: PublicKey.length * count)
+        let result = publicKeys.withUnsafeMutableBufferPointer {
+            ed25519_hd_derive_range($0.baseAddress, &parent.node, start, count, pool?.pool)
+        }
+        
+        guard result == 0 else {
+            return nil
+        }
+        
+        return (0..<count).map {
+            PublicKey(Array(publicKeys[($0 * PublicKey.length)..<(($0 + 1) * PublicKey.length)]))!
+        }
+    }
+    
+    // MARK: - Nodes -
+    
+    private struct Node {
+        var node = ed25519_hd_node()
+        
+        var key: [Byte] {
+            withUnsafeBytes(of: node.key) { Array($0) }
+        }
+    }
+    
+    private func node(path: String) -> Node? {
+        var node = Node()
+        let result = ed25519_hd_cache_derive(cache, &node.node, path)
+        
+        guard result == 0 else {
+            return nil
+        }
+        
+        return node
+    }
+}
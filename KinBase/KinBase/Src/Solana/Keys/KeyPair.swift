@@ -50,6 +50,49 @@ public struct KeyPair: Equatable {
         self.privateKey = PrivateKey(privateBytes)!
     }
     
+    private init(publicKey: PublicKey, privateKey: PrivateKey, seed: Seed) {
+        self.publicKey = publicKey
+        self.privateKey = privateKey
+        self.seed = seed
+    }
+    
+    /// Derives key pairs for many seeds at once, in the order given. The
+    /// public keys are encoded together and share one field inversion, so
+    /// bulk provisioning is faster than calling `init(seed:)` per seed.
+    public static func create(seeds: [Seed]) -> [KeyPair] {
+        guard !seeds.isEmpty else {
+            return []
+        }
+        
+        let seedBytes = seeds.flatMap { $0.bytes }
+        var publicBytes  = [Byte].zeroed(with: Key32.length * seeds.count)
+        var privateBytes = [Byte].zeroed(with: PrivateKey.length * seeds.count)
+        
+        privateBytes.withUnsafeMutableBufferPointer { `private` in
+            publicBytes.withUnsafeMutableBufferPointer { `public` in
+                seedBytes.withUnsafeBufferPointer { seed in
+                    ed25519_create_keypairs_batch(
+                        seeds.count,
+                        `public`.baseAddress,
+                        `private`.baseAddress,
+                        seed.baseAddress
+                    )
+                }
+            }
+        }
+        
+        return seeds.enumerated().map { index, seed in
+            let publicKey = publicBytes[(index * Key32.length)..<((index + 1) * Key32.length)]
+            let privateKey = privateBytes[(index * PrivateKey.length)..<((index + 1) * PrivateKey.length)]
+            
+            return KeyPair(
+                publicKey: PublicKey(Array(publicKey))!,
+                privateKey: PrivateKey(Array(privateKey))!,
+                seed: seed
+            )
+        }
+    }
+    
     // MARK: - Signing -
     
     public func sign(_ data: Data) -> Data {
@@ -59,14 +102,44 @@ public struct KeyPair: Equatable {
     public func sign(_ bytes: [Byte]) -> [Byte] {
         var signature = [Byte].zeroed(with: Signature.length)
         
+        signature.withUnsafeMutableBufferPointer { signature in
+            bytes.withUnsafeBufferPointer { msg in
+                sign(msg, into: signature.baseAddress!)
+            }
+        }
+        
+        return signature
+    }
+    
+    /// Writes the signature of `message` to the `Signature.length` bytes
+    /// at `signature`, which may share a buffer with `message` as long as
+    /// the two don't overlap.
+    func sign(_ message: UnsafeBufferPointer<Byte>, into signature: UnsafeMutablePointer<Byte>) {
+        privateKey.bytes.withUnsafeBufferPointer { `private` in
+            publicKey.bytes.withUnsafeBufferPointer { `public` in
+                ed25519_sign(
+                    signature,
+                    message.baseAddress,
+                    message.count,
+                    `public`.baseAddress,
+                    `private`.baseAddress
+                )
+            }
+        }
+    }
+    
+    /// Signs the concatenation of `segments` without joining them first.
+    public func sign(segments: [[Byte]]) -> [Byte] {
+        var signature = [Byte].zeroed(with: Signature.length)
+        
         signature.withUnsafeMutableBufferPointer { signature in
             privateKey.bytes.withUnsafeBufferPointer { `private` in
                 publicKey.bytes.withUnsafeBufferPointer { `public` in
-                    bytes.withUnsafeBufferPointer { msg in
-                        ed25519_sign(
+                    segments.withIOVecs { iov in
+                        ed25519_sign_iov(
                             signature.baseAddress,
-                            msg.baseAddress,
-                            bytes.count,
+                            iov,
+                            iov.count,
                             `public`.baseAddress,
                             `private`.baseAddress
                         )
@@ -115,6 +188,113 @@ extension PublicKey {
             }
         }
     }
+    
+    /// Verifies with the cofactored equation `8(sB - hA - R) == 0`, which
+    /// also accepts signatures whose key or `R` has a small-order component.
+    /// Honest signers never produce those, so for them the result is the
+    /// same as `verify(signature:bytes:)`.
+    public func verifyCofactored(signature: Signature, bytes: [Byte]) -> Bool {
+        signature.bytes.withUnsafeBufferPointer { signature in
+            bytes.withUnsafeBufferPointer { message in
+                self.bytes.withUnsafeBufferPointer { `public` in
+                    ed25519_verify_cofactored(
+                        signature.baseAddress,
+                        message.baseAddress,
+                        message.count,
+                        `public`.baseAddress
+                    ) == 1
+                }
+            }
+        }
+    }
+    
+    /// Verifies a signature over the concatenation of `segments`.
+    public func verify(signature: Signature, segments: [[Byte]]) -> Bool {
+        signature.bytes.withUnsafeBufferPointer { signature in
+            self.bytes.withUnsafeBufferPointer { `public` in
+                segments.withIOVecs { iov in
+                    ed25519_verify_iov(
+                        signature.baseAddress,
+                        iov,
+                        iov.count,
+                        `public`.baseAddress
+                    ) == 1
+                }
+            }
+        }
+    }
+    
+    /// Verifies many signatures at once using a randomized batch check,
+    /// returning a result for every entry in the order given. The check is
+    /// cofactored, so every result matches `verifyCofactored(signature:bytes:)`
+    /// rather than `verify(signature:bytes:)`.
+    public static func verify(batch: [(publicKey: PublicKey, signature: Signature, bytes: [Byte])]) -> [Bool] {
+        guard !batch.isEmpty else {
+            return []
+        }
+        
+        let publicKeys = batch.flatMap { $0.publicKey.bytes }
+        let signatures = batch.flatMap { $0.signature.bytes }
+        let messages   = batch.flatMap { $0.bytes }
+        let lengths    = batch.map { $0.bytes.count }
+        
+        var results = [Int32](repeating: 0, count: batch.count)
+        
+        publicKeys.withUnsafeBufferPointer { publicKeys in
+            signatures.withUnsafeBufferPointer { signatures in
+                messages.withUnsafeBufferPointer { messages in
+                    var offset = 0
+                    let messagePointers: [UnsafePointer<Byte>?] = lengths.map { length in
+                        defer { offset += length }
+                        return messages.baseAddress?.advanced(by: offset)
+                    }
+                    
+                    let publicKeyPointers: [UnsafePointer<Byte>?] = (0..<batch.count).map {
+                        publicKeys.baseAddress?.advanced(by: $0 * PublicKey.length)
+                    }
+                    
+                    let signaturePointers: [UnsafePointer<Byte>?] = (0..<batch.count).map {
+                        signatures.baseAddress?.advanced(by: $0 * Signature.length)
+                    }
+                    
+                    _ = ed25519_verify_batch(
+                        batch.count,
+                        signaturePointers,
+                        messagePointers,
+                        lengths,
+                        publicKeyPointers,
+                        &results
+                    )
+                }
+            }
+        }
+        
+        return results.map { $0 == 1 }
+    }
+}
+
+// MARK: - Segments -
+
+extension Array where Element == [Byte] {
+    
+    /// Calls `body` with one `ed25519_iovec` per segment, each pointing
+    /// into that segment's own storage for the duration of the call.
+    func withIOVecs<R>(_ body: ([ed25519_iovec]) -> R) -> R {
+        var iov: [ed25519_iovec] = []
+        iov.reserveCapacity(count)
+        return withIOVecs(from: startIndex, appendingTo: &iov, body)
+    }
+    
+    private func withIOVecs<R>(from index: Int, appendingTo iov: inout [ed25519_iovec], _ body: ([ed25519_iovec]) -> R) -> R {
+        guard index < endIndex else {
+            return body(iov)
+        }
+        
+        return self[index].withUnsafeBufferPointer { segment in
+            iov.append(ed25519_iovec(data: segment.baseAddress, len: segment.count))
+            return withIOVecs(from: index + 1, appendingTo: &iov, body)
+        }
+    }
 }
 
 // MARK: - Seed -
@@ -133,4 +313,25 @@ extension Seed {
         
         return Seed(bytes)
     }
+    
+    /// Generates `count` seeds with one call into the native generator,
+    /// which is much cheaper per seed than calling `generate()` in a loop.
+    public static func generate(count: Int) -> [Seed]? {
+        guard count > 0 else {
+            return []
+        }
+        
+        var bytes = [Byte].zeroed(with: Seed.length * count)
+        let result = bytes.withUnsafeMutableBufferPointer {
+            ed25519_create_seeds(count, $0.baseAddress)
+        }
+        
+        guard result == 0 else {
+            return nil
+        }
+        
+        return (0..<count).map {
+            Seed(Array(bytes[($0 * Seed.length)..<(($0 + 1) * Seed.length)]))!
+        }
+    }
 }
@@ -0,0 +1,57 @@
+//
+//  PublicKeyVerifier.swift
+//  KinBase
+//
+//  Created by Kik Interactive Inc.
+//  Copyright © 2021 Kin Foundation. All rights reserved.
+//
+
+import Foundation
+
+/// Verifies signatures made by a single public key. The key is decompressed
+/// and its multiples are precomputed once, so keep a verifier around for keys
+/// that verify many signatures, like subsidizer or app accounts.
+public final class PublicKeyVerifier {
+    
+    public let publicKey: PublicKey
+    
+    private let context: OpaquePointer
+    
+    // MARK: - Init -
+    
+    public init?(publicKey: PublicKey) {
+        let context = publicKey.bytes.withUnsafeBufferPointer {
+            ed25519_pubkey_ctx_create($0.baseAddress)
+        }
+        
+        guard let ctx = context else {
+            return nil
+        }
+        
+        self.publicKey = publicKey
+        self.context = ctx
+    }
+    
+    deinit {
+        ed25519_pubkey_ctx_destroy(context)
+    }
+    
+    // MARK: - Verification -
+    
+    public func verify(signature: Signature, data: Data) -> Bool {
+        verify(signature: signature, bytes: data.bytes)
+    }
+    
+    public func verify(signature: Signature, bytes: [Byte]) -> Bool {
+        signature.bytes.withUnsafeBufferPointer { signature in
+            bytes.withUnsafeBufferPointer { message in
+                ed25519_verify_prepared(
+                    context,
+                    signature.baseAddress,
+                    message.baseAddress,
+                    message.count
+                ) == 1
+            }
+        }
+    }
+}
@@ -0,0 +1,122 @@
+//
+//  Signer.swift
+//  KinBase
+//
+//  Created by Kik Interactive Inc.
+//  Copyright © 2021 Kin Foundation. All rights reserved.
+//
+
+import Foundation
+
+/// Signs messages with a single key pair. The key is copied into native
+/// memory once, along with the hash state for its nonce prefix, so keep a
+/// signer around for keys that sign many transactions, like a subsidizer.
+public final class Signer {
+    
+    public let publicKey: PublicKey
+    
+    private let context: OpaquePointer
+    
+    // MARK: - Init -
+    
+    public init?(keyPair: KeyPair) {
+        let context = keyPair.privateKey.bytes.withUnsafeBufferPointer { `private` in
+            keyPair.publicKey.bytes.withUnsafeBufferPointer { `public` in
+                ed25519_signer_create(`public`.baseAddress, `private`.baseAddress)
+            }
+        }
+        
+        guard let ctx = context else {
+            return nil
+        }
+        
+        self.publicKey = keyPair.publicKey
+        self.context = ctx
+    }
+    
+    deinit {
+        ed25519_signer_destroy(context)
+    }
+    
+    // MARK: - Signing -
+    
+    public func sign(_ data: Data) -> Data {
+        sign(data.bytes).data
+    }
+    
+    public func sign(_ bytes: [Byte]) -> [Byte] {
+        var signature = [Byte].zeroed(with: Signature.length)
+        
+        signature.withUnsafeMutableBufferPointer { signature in
+            bytes.withUnsafeBufferPointer { message in
+                sign(message, into: signature.baseAddress!)
+            }
+        }
+        
+        return signature
+    }
+    
+    /// Writes the signature of `message` to the `Signature.length` bytes
+    /// at `signature`, which may share a buffer with `message` as long as
+    /// the two don't overlap.
+    func sign(_ message: UnsafeBufferPointer<Byte>, into signature: UnsafeMutablePointer<Byte>) {
+        ed25519_signer_sign(
+            context,
+            signature,
+            message.baseAddress,
+            message.count
+        )
+    }
+    
+    /// Signs the concatenation of `segments` without joining them first.
+    public func sign(segments: [[Byte]]) -> [Byte] {
+        var signature = [Byte].zeroed(with: Signature.length)
+        
+        signature.withUnsafeMutableBufferPointer { signature in
+            segments.withIOVecs { iov in
+                ed25519_signer_sign_iov(
+                    context,
+                    signature.baseAddress,
+                    iov,
+                    iov.count
+                )
+            }
+        }
+        
+        return signature
+    }
+    
+    /// Signs every message, spreading the work over the threads of `pool`.
+    /// Signatures are returned in the order of `messages`.
+    public func sign(messages: [[Byte]], pool: SigningPool) -> [[Byte]] {
+        guard !messages.isEmpty else {
+            return []
+        }
+        
+        let joined = messages.flatMap { $0 }
+        var signatures = [Byte].zeroed(with: Signature.length * messages.count)
+        
+        signatures.withUnsafeMutableBufferPointer { signatures in
+            joined.withUnsafeBufferPointer { joined in
+                var offset = 0
+                let jobs: [ed25519_sign_job] = messages.enumerated().map { index, message in
+                    defer { offset += message.count }
+                    return ed25519_sign_job(
+                        signature: signatures.baseAddress?.advanced(by: index * Signature.length),
+                        message: joined.baseAddress?.advanced(by: offset),
+                        message_len: message.count,
+                        signer: context,
+                        public_key: nil,
+                        private_key: nil
+                    )
+                }
+                
+                pool.sign(jobs: jobs)
+            }
+        }
+        
+        return (0..<messages.count).map {
+            Array(signatures[($0 * Signature.length)..<(($0 + 1) * Signature.length)])
+        }
+    }
+}
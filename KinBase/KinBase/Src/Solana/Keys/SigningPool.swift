@@ -0,0 +1,37 @@
+//
+//  SigningPool.swift
+//  KinBase
+//
+//  Created by Kik Interactive Inc.
+//  Copyright © 2021 Kin Foundation. All rights reserved.
+//
+
+import Foundation
+
+/// Worker threads that share out the signatures of a batch, see
+/// `Signer.sign(messages:pool:)`. Threads are started once and sleep
+/// between batches, so create one pool and reuse it.
+public final class SigningPool {
+    
+    let pool: OpaquePointer?
+    
+    // MARK: - Init -
+    
+    /// A `threadCount` of 0 uses one thread per online CPU. The calling
+    /// thread counts as one of them while a batch is being signed.
+    public init(threadCount: Int = 0) {
+        self.pool = ed25519_pool_create(max(threadCount, 0))
+    }
+    
+    deinit {
+        ed25519_pool_destroy(pool)
+    }
+    
+    // MARK: - Signing -
+    
+    func sign(jobs: [ed25519_sign_job]) {
+        jobs.withUnsafeBufferPointer {
+            ed25519_sign_batch($0.baseAddress, $0.count, pool)
+        }
+    }
+}
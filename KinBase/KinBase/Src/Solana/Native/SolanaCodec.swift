@@ -0,0 +1,435 @@
+//
+//  SolanaCodec.swift
+//  KinBase
+//
+//  Created by Kik Interactive Inc.
+//  Copyright © 2021 Kin Foundation. All rights reserved.
+//
+
+import Foundation
+
+/// Bridges `Message` and `Transaction` to the native codec in
+/// solana_codec.c. Decoding walks the input once, recording offsets, and
+/// copies each field out of it exactly once. Encoding sizes the output
+/// up front and writes it into a single buffer.
+enum SolanaCodec {
+    
+    /// Instructions decoded before falling back to a second, exactly sized pass.
+    private static let instructionCapacity = 16
+    
+    // MARK: - Decoding -
+    
+    static func decodeMessage(_ data: Data) -> Message? {
+        data.withUnsafeBytes { raw -> Message? in
+            let bytes = raw.bindMemory(to: Byte.self)
+            
+            return decode { (view: inout solana_message_view, instructions, capacity) in
+                solana_message_decode(&view, instructions, capacity, bytes.baseAddress, bytes.count)
+            }
+            .map { view, instructions in
+                message(view, instructions: instructions, bytes: bytes)
+            }
+        }
+    }
+    
+    static func decodeTransaction(_ data: Data) -> (signatures: [Signature], message: Message)? {
+        data.withUnsafeBytes { raw -> (signatures: [Signature], message: Message)? in
+            let bytes = raw.bindMemory(to: Byte.self)
+            
+            return decode { (view: inout solana_transaction_view, instructions, capacity) in
+                solana_transaction_decode(&view, instructions, capacity, bytes.baseAddress, bytes.count)
+            }
+            .map { view, instructions in
+                let signatures = (0..<view.signature_count).map {
+                    Signature(slice(bytes, view.signatures_offset + $0 * Signature.length, Signature.length))!
+                }
+                
+                return (signatures, message(view.message, instructions: instructions, bytes: bytes))
+            }
+        }
+    }
+    
+    /// Runs `decoder`, retrying with room for every instruction when the
+    /// first pass finds more than `instructionCapacity`.
+    private static func decode<View: SolanaView>(decoder: (inout View, UnsafeMutablePointer<solana_instruction_view>?, Int) -> Int32) -> (View, [solana_instruction_view])? {
+        var view = View()
+        var instructions = [solana_instruction_view](repeating: solana_instruction_view(), count: instructionCapacity)
+        
+        guard instructions.withUnsafeMutableBufferPointer({ decoder(&view, $0.baseAddress, $0.count) }) == SOLANA_OK else {
+            return nil
+        }
+        
+        let count = view.instructionCount
+        if count > instructions.count {
+            instructions = [solana_instruction_view](repeating: solana_instruction_view(), count: count)
+            
+            guard instructions.withUnsafeMutableBufferPointer({ decoder(&view, $0.baseAddress, $0.count) }) == SOLANA_OK else {
+                return nil
+            }
+        }
+        
+        return (view, Array(instructions.prefix(count)))
+    }
+    
+    private static func message(_ view: solana_message_view, instructions: [solana_instruction_view], bytes: UnsafeBufferPointer<Byte>) -> Message {
+        Message(
+            header: MessageHeader(
+                signatureCount: Int(view.signature_count),
+                readOnlySignedCount: Int(view.readonly_signed_count),
+                readOnlyCount: Int(view.readonly_count)
+            ),
+            accounts: (0..<view.account_count).map {
+                Key32(slice(bytes, view.account_keys_offset + $0 * Key32.length, Key32.length))!
+            },
+            recentBlockhash: Hash(slice(bytes, view.blockhash_offset, Hash.length))!,
+            instructions: instructions.map { instruction in
+                CompiledInstruction(
+                    programIndex: instruction.program_index,
+                    accountIndexes: slice(bytes, instruction.accounts.offset, instruction.accounts.length),
+                    data: Data(UnsafeBufferPointer(rebasing: bytes[instruction.data.offset..<instruction.data.offset + instruction.data.length]))
+                )
+            }
+        )
+    }
+    
+    private static func slice(_ bytes: UnsafeBufferPointer<Byte>, _ offset: Int, _ length: Int) -> [Byte] {
+        Array(bytes[offset..<offset + length])
+    }
+    
+    // MARK: - Encoding -
+    
+    static func encode(_ message: Message) -> Data {
+        withNativeMessage(message) { native, _ in
+            write(size: solana_message_size(native)) { out, capacity in
+                solana_message_encode(out, capacity, native)
+            }
+        }
+    }
+    
+    /// Splits the encoding of `message` at its keys, blockhash and account
+    /// indexes, which are passed on as they're stored. Only the lengths,
+    /// header and instruction data are written into new segments, with
+    /// lengths from the native short_vec encoder.
+    static func encodeSegments(_ message: Message) -> [[Byte]] {
+        var segments: [[Byte]] = []
+        segments.reserveCapacity(message.accounts.count + 3 * message.instructions.count + 3)
+        
+        let header = [
+            Byte(message.header.signatureCount),
+            Byte(message.header.readOnlySignedCount),
+            Byte(message.header.readOnlyCount),
+        ]
+        
+        segments.append(shortVec(message.accounts.count, after: header))
+        segments.append(contentsOf: message.accounts.map { $0.bytes })
+        segments.append(message.recentBlockhash.bytes)
+        segments.append(shortVec(message.instructions.count))
+        
+        for instruction in message.instructions {
+            segments.append(shortVec(instruction.accountIndexes.count, after: [instruction.programIndex]))
+            segments.append(instruction.accountIndexes)
+            
+            var data = shortVec(instruction.data.count)
+            data.append(contentsOf: instruction.data)
+            segments.append(data)
+        }
+        
+        return segments
+    }
+    
+    /// `prefix` followed by `value` as a short_vec length.
+    private static func shortVec(_ value: Int, after prefix: [Byte] = []) -> [Byte] {
+        precondition(value <= Int(SOLANA_SHORT_VEC_MAX), "Message lists must fit in a short_vec")
+        
+        var bytes = prefix
+        bytes.append(contentsOf: [Byte](repeating: 0, count: solana_short_vec_size(value)))
+        bytes.withUnsafeMutableBufferPointer {
+            _ = solana_short_vec_encode($0.baseAddress! + prefix.count, value)
+        }
+        
+        return bytes
+    }
+    
+    static func encode(_ message: Message, signatures: [Signature]) -> Data {
+        encode(message, signatures: signatures, signers: [])
+    }
+    
+    /// Signs the message for a signature slot, writing the signature to
+    /// the pointer it's given.
+    typealias Sign = (UnsafeBufferPointer<Byte>, UnsafeMutablePointer<Byte>) -> Void
+    
+    /// Encodes the transaction once, with `signatures` in their slots, then
+    /// has each of `signers` sign the encoded message in place, writing
+    /// its signature straight into the slot at its index.
+    static func encode(_ message: Message, signatures: [Signature], signers: [(index: Int, sign: Sign)]) -> Data {
+        withNativeMessage(message, signatures: signatures) { native, signaturePointers in
+            write(size: solana_transaction_size(signatures.count, native)) { out, capacity in
+                let written = solana_transaction_encode(out, capacity, signaturePointers, signatures.count, native)
+                
+                if let out = out, written > 0 {
+                    sign(UnsafeMutableBufferPointer(start: out, count: written), signatureCount: signatures.count, signers: signers)
+                }
+                
+                return written
+            }
+        }
+    }
+    
+    /// Has each of `signers` sign the message of the encoded `transaction`
+    /// and write its signature into the slot at its index.
+    static func sign(_ transaction: UnsafeMutableBufferPointer<Byte>, signatureCount: Int, signers: [(index: Int, sign: Sign)]) {
+        guard let base = transaction.baseAddress else {
+            return
+        }
+        
+        let messageOffset = solana_transaction_message_offset(signatureCount)
+        let message = UnsafeBufferPointer(start: UnsafePointer(base + messageOffset), count: transaction.count - messageOffset)
+        
+        for signer in signers {
+            precondition(signer.index < signatureCount, "Signers must have a signature slot")
+            signer.sign(message, base + solana_transaction_signature_offset(signatureCount, signer.index))
+        }
+    }
+    
+    /// Reads the `count` signatures back out of an encoded transaction.
+    static func signatures(in transaction: Data, count: Int) -> [Signature] {
+        (0..<count).map { index in
+            let offset = transaction.startIndex + solana_transaction_signature_offset(count, index)
+            return Signature([Byte](transaction[offset..<offset + Signature.length]))!
+        }
+    }
+    
+    private static func write(size: Int, encoder: (UnsafeMutablePointer<Byte>?, Int) -> Int) -> Data {
+        // A size of zero means a list is too long for the wire format,
+        // which the Swift encoder this replaces trapped on as well.
+        precondition(size > 0, "Message lists must fit in a short_vec")
+        
+        var data = Data(count: size)
+        let written = data.withUnsafeMutableBytes {
+            encoder($0.bindMemory(to: Byte.self).baseAddress, size)
+        }
+        
+        assert(written == size)
+        return data
+    }
+    
+    // MARK: - Compiling -
+    
+    /// Compiles with solana_compiler.c, which dedups accounts in a hash
+    /// table and resolves instruction indices without searching the keys.
+    static func compile(payer: Key32, instructions: [Instruction]) -> Message {
+        let metaCount = instructions.reduce(0) { $0 + 1 + $1.accounts.count }
+        
+        // The payer, then each program followed by its accounts
+        var keys: [Byte] = []
+        keys.reserveCapacity((1 + metaCount) * Key32.length)
+        keys.append(contentsOf: payer.bytes)
+        
+        var flags: [Byte] = []
+        flags.reserveCapacity(metaCount)
+        
+        for instruction in instructions {
+            keys.append(contentsOf: instruction.program.bytes)
+            
+            for account in instruction.accounts {
+                keys.append(contentsOf: account.publicKey.bytes)
+                flags.append(account.flags)
+            }
+        }
+        
+        return keys.withUnsafeBufferPointer { keys in
+            var key = keys.baseAddress! + Key32.length
+            var metas: [solana_account_meta] = []
+            var programs: [UnsafePointer<Byte>] = []
+            
+            metas.reserveCapacity(flags.count)
+            programs.reserveCapacity(instructions.count)
+            
+            for instruction in instructions {
+                programs.append(key)
+                key += Key32.length
+                
+                for _ in instruction.accounts {
+                    metas.append(solana_account_meta(key: key, flags: flags[metas.count]))
+                    key += Key32.length
+                }
+            }
+            
+            return metas.withUnsafeBufferPointer { metas in
+                var offset = 0
+                let specs = zip(instructions, programs).map { instruction, program -> solana_instruction_spec in
+                    defer { offset += instruction.accounts.count }
+                    
+                    return solana_instruction_spec(
+                        program: program,
+                        accounts: metas.baseAddress.map { $0 + offset },
+                        account_count: instruction.accounts.count,
+                        data: nil,
+                        data_len: 0
+                    )
+                }
+                
+                return specs.withUnsafeBufferPointer { specs in
+                    let size = solana_message_compile_arena_size(specs.baseAddress, specs.count)
+                    let arena = UnsafeMutableRawPointer.allocate(byteCount: size, alignment: MemoryLayout<UnsafeRawPointer>.alignment)
+                    defer { arena.deallocate() }
+                    
+                    var native = solana_message()
+                    let result = solana_message_compile(&native, arena, size, keys.baseAddress, specs.baseAddress, specs.count)
+                    
+                    // An index byte addresses 256 accounts at most, which
+                    // the Swift compiler this replaces trapped on as well.
+                    precondition(result == SOLANA_OK, "Messages can't have more than 256 accounts")
+                    
+                    return message(native, instructions: instructions)
+                }
+            }
+        }
+    }
+    
+    /// Copies a compiled message out of the arena and the keys it points
+    /// to, taking instruction data from `instructions` rather than the
+    /// native message.
+    private static func message(_ native: solana_message, instructions: [Instruction]) -> Message {
+        let keys = UnsafeBufferPointer(start: native.account_keys, count: native.account_count)
+        let compiled = UnsafeBufferPointer(start: native.instructions, count: native.instruction_count)
+        
+        return Message(
+            header: MessageHeader(
+                signatureCount: Int(native.signature_count),
+                readOnlySignedCount: Int(native.readonly_signed_count),
+                readOnlyCount: Int(native.readonly_count)
+            ),
+            accounts: keys.map {
+                Key32(Array(UnsafeBufferPointer(start: $0, count: Key32.length)))!
+            },
+            recentBlockhash: Hash.zero,
+            instructions: zip(compiled, instructions).map { compiled, instruction in
+                CompiledInstruction(
+                    programIndex: compiled.program_index,
+                    accountIndexes: Array(UnsafeBufferPointer(start: compiled.accounts, count: compiled.account_count)),
+                    data: instruction.data
+                )
+            }
+        )
+    }
+    
+    /// Lays `message` out as a `solana_message`, and `signatures` as one
+    /// pointer each, valid for the duration of `body`. Keys, instruction
+    /// payloads and signatures are gathered into one scratch buffer in a
+    /// single pass, so an encode allocates it, the offsets and the
+    /// pointers once each, however many accounts and instructions it has.
+    private static func withNativeMessage<T>(_ message: Message, signatures: [Signature] = [], body: (UnsafePointer<solana_message>, UnsafePointer<UnsafePointer<Byte>?>?) -> T) -> T {
+        let accountCount = message.accounts.count
+        let instructionCount = message.instructions.count
+        let payloadSize = message.instructions.reduce(0) { $0 + $1.accountIndexes.count + $1.data.count }
+        
+        // The keys, each instruction's accounts and data, then the
+        // signatures, with the offset of every field
+        var scratch: [Byte] = []
+        scratch.reserveCapacity(accountCount * Key32.length + payloadSize + signatures.count * Signature.length)
+        
+        var offsets: [Int] = []
+        offsets.reserveCapacity(accountCount + 2 * instructionCount + signatures.count)
+        
+        for account in message.accounts {
+            offsets.append(scratch.count)
+            scratch.append(contentsOf: account.bytes)
+        }
+        
+        for instruction in message.instructions {
+            offsets.append(scratch.count)
+            scratch.append(contentsOf: instruction.accountIndexes)
+            offsets.append(scratch.count)
+            scratch.append(contentsOf: instruction.data)
+        }
+        
+        for signature in signatures {
+            offsets.append(scratch.count)
+            scratch.append(contentsOf: signature.bytes)
+        }
+        
+        return scratch.withUnsafeBufferPointer { scratch in
+            message.recentBlockhash.bytes.withUnsafeBufferPointer { blockhash in
+                let pointers = offsets.map { offset in
+                    scratch.baseAddress.map { $0 + offset }
+                }
+                
+                return pointers.withUnsafeBufferPointer { pointers in
+                    let keys = pointers.baseAddress
+                    let payloads = keys.map { $0 + accountCount }
+                    let instructions = message.instructions.enumerated().map { index, instruction -> solana_instruction in
+                        solana_instruction(
+                            program_index: instruction.programIndex,
+                            accounts: payloads?[2 * index],
+                            account_count: instruction.accountIndexes.count,
+                            data: payloads?[2 * index + 1],
+                            data_len: instruction.data.count
+                        )
+                    }
+                    
+                    return instructions.withUnsafeBufferPointer { instructions in
+                        var native = solana_message(
+                            signature_count: Byte(message.header.signatureCount),
+                            readonly_signed_count: Byte(message.header.readOnlySignedCount),
+                            readonly_count: Byte(message.header.readOnlyCount),
+                            account_keys: keys,
+                            account_count: accountCount,
+                            blockhash: blockhash.baseAddress,
+                            instructions: instructions.baseAddress,
+                            instruction_count: instructions.count
+                        )
+                        
+                        return body(&native, payloads.map { $0 + 2 * instructionCount })
+                    }
+                }
+            }
+        }
+    }
+}
+
+// MARK: - AccountMeta -
+
+private extension AccountMeta {
+    var flags: Byte {
+        var flags: Int32 = 0
+        
+        if isSigner {
+            flags |= SOLANA_ACCOUNT_SIGNER
+        }
+        
+        if isWritable {
+            flags |= SOLANA_ACCOUNT_WRITABLE
+        }
+        
+        if isPayer {
+            flags |= SOLANA_ACCOUNT_PAYER
+        }
+        
+        if isProgram {
+            flags |= SOLANA_ACCOUNT_PROGRAM
+        }
+        
+        return Byte(flags)
+    }
+}
+
+// MARK: - SolanaView -
+
+/// The decoded views that carry an instruction count.
+private protocol SolanaView {
+    init()
+    var instructionCount: Int { get }
+}
+
+extension solana_message_view: SolanaView {
+    fileprivate var instructionCount: Int {
+        instruction_count
+    }
+}
+
+extension solana_transaction_view: SolanaView {
+    fileprivate var instructionCount: Int {
+        message.instruction_count
+    }
+}
@@ -0,0 +1,318 @@
+#include <string.h>
+
+#include "solana_codec.h"
+
+/*
+    short_vec: a little-endian base 128 length of at most three bytes,
+    values up to 0xffff, with no redundant trailing zero byte.
+*/
+
+size_t solana_short_vec_size(size_t value) {
+    if (value < 0x80) {
+        return 1;
+    }
+
+    return value < 0x4000 ? 2 : 3;
+}
+
+/* value <= SOLANA_SHORT_VEC_MAX */
+size_t solana_short_vec_encode(uint8_t *out, size_t value) {
+    size_t n = 0;
+
+    while (value >= 0x80) {
+        out[n++] = (uint8_t) (value | 0x80);
+        value >>= 7;
+    }
+
+    out[n++] = (uint8_t) value;
+    return n;
+}
+
+int solana_short_vec_decode(size_t *value, const uint8_t *data, size_t len, size_t *offset) {
+    size_t v = 0;
+    size_t i;
+    uint8_t b;
+
+    for (i = 0; i < 3; ++i) {
+        if (*offset >= len) {
+            return SOLANA_ERROR_TRUNCATED;
+        }
+
+        b = data[(*offset)++];
+        v |= (size_t) (b & 0x7f) << (7 * i);
+
+        if (!(b & 0x80)) {
+            if ((i > 0 && b == 0) || v > SOLANA_SHORT_VEC_MAX) {
+                return SOLANA_ERROR_SHORT_VEC;
+            }
+
+            *value = v;
+            return SOLANA_OK;
+        }
+    }
+
+    return SOLANA_ERROR_SHORT_VEC;
+}
+
+/* reserves count items of size bytes at *offset */
+static int take(solana_span *span, size_t len, size_t *offset, size_t count, size_t size) {
+    if (count > (len - *offset) / size) {
+        return SOLANA_ERROR_TRUNCATED;
+    }
+
+    span->offset = *offset;
+    span->length = count * size;
+    *offset += span->length;
+    return SOLANA_OK;
+}
+
+static int decode_list(solana_span *span, size_t *count, const uint8_t *data, size_t len, size_t *offset, size_t size) {
+    int err = solana_short_vec_decode(count, data, len, offset);
+
+    if (err != SOLANA_OK) {
+        return err;
+    }
+
+    return take(span, len, offset, *count, size);
+}
+
+static int decode_instruction(solana_instruction_view *ix, const uint8_t *data, size_t len, size_t *offset) {
+    size_t count;
+    int err;
+
+    if (*offset >= len) {
+        return SOLANA_ERROR_TRUNCATED;
+    }
+
+    ix->program_index = data[(*offset)++];
+    err = decode_list(&ix->accounts, &count, data, len, offset, 1);
+
+    if (err != SOLANA_OK) {
+        return err;
+    }
+
+    return decode_list(&ix->data, &count, data, len, offset, 1);
+}
+
+static int decode_message(solana_message_view *view, solana_instruction_view *instructions, size_t capacity, const uint8_t *data, size_t len, size_t offset) {
+    solana_instruction_view ix;
+    solana_span span;
+    size_t i;
+    int err;
+
+    view->offset = offset;
+
+    if (len - offset < SOLANA_HEADER_LENGTH) {
+        return SOLANA_ERROR_TRUNCATED;
+    }
+
+    view->signature_count = data[offset];
+    view->readonly_signed_count = data[offset + 1];
+    view->readonly_count = data[offset + 2];
+    offset += SOLANA_HEADER_LENGTH;
+
+    err = decode_list(&span, &view->account_count, data, len, &offset, SOLANA_KEY_LENGTH);
+
+    if (err != SOLANA_OK) {
+        return err;
+    }
+
+    view->account_keys_offset = span.offset;
+
+    err = take(&span, len, &offset, 1, SOLANA_HASH_LENGTH);
+
+    if (err != SOLANA_OK) {
+        return err;
+    }
+
+    view->blockhash_offset = span.offset;
+
+    err = solana_short_vec_decode(&view->instruction_count, data, len, &offset);
+
+    if (err != SOLANA_OK) {
+        return err;
+    }
+
+    view->instructions.offset = offset;
+
+    for (i = 0; i < view->instruction_count; ++i) {
+        err = decode_instruction(&ix, data, len, &offset);
+
+        if (err != SOLANA_OK) {
+            return err;
+        }
+
+        if (ix.program_index >= view->account_count) {
+            return SOLANA_ERROR_PROGRAM_INDEX;
+        }
+
+        if (i < capacity) {
+            instructions[i] = ix;
+        }
+    }
+
+    view->instructions.length = offset - view->instructions.offset;
+    view->length = offset - view->offset;
+    return SOLANA_OK;
+}
+
+int solana_message_decode(solana_message_view *view, solana_instruction_view *instructions, size_t capacity, const uint8_t *data, size_t len) {
+    return decode_message(view, instructions, capacity, data, len, 0);
+}
+
+int solana_transaction_decode(solana_transaction_view *view, solana_instruction_view *instructions, size_t capacity, const uint8_t *data, size_t len) {
+    solana_span span;
+    size_t offset = 0;
+    int err;
+
+    err = decode_list(&span, &view->signature_count, data, len, &offset, SOLANA_SIGNATURE_LENGTH);
+
+    if (err != SOLANA_OK) {
+        return err;
+    }
+
+    view->signatures_offset = span.offset;
+    err = decode_message(&view->message, instructions, capacity, data, len, offset);
+
+    if (err != SOLANA_OK) {
+        return err;
+    }
+
+    view->length = offset + view->message.length;
+    return SOLANA_OK;
+}
+
+static size_t instruction_size(const solana_instruction *ix) {
+    if (ix->account_count > SOLANA_SHORT_VEC_MAX || ix->data_len > SOLANA_SHORT_VEC_MAX) {
+        return 0;
+    }
+
+    return 1 + solana_short_vec_size(ix->account_count) + ix->account_count + solana_short_vec_size(ix->data_len) + ix->data_len;
+}
+
+size_t solana_message_size(const solana_message *message) {
+    size_t size;
+    size_t ix;
+    size_t i;
+
+    if (message->account_count > SOLANA_SHORT_VEC_MAX || message->instruction_count > SOLANA_SHORT_VEC_MAX) {
+        return 0;
+    }
+
+    size = SOLANA_HEADER_LENGTH +
+           solana_short_vec_size(message->account_count) + message->account_count * SOLANA_KEY_LENGTH +
+           SOLANA_HASH_LENGTH +
+           solana_short_vec_size(message->instruction_count);
+
+    for (i = 0; i < message->instruction_count; ++i) {
+        ix = instruction_size(&message->instructions[i]);
+
+        if (ix == 0) {
+            return 0;
+        }
+
+        size += ix;
+    }
+
+    return size;
+}
+
+size_t solana_transaction_size(size_t signature_count, const solana_message *message) {
+    size_t size = solana_message_size(message);
+
+    if (size == 0 || signature_count > SOLANA_SHORT_VEC_MAX) {
+        return 0;
+    }
+
+    return solana_short_vec_size(signature_count) + signature_count * SOLANA_SIGNATURE_LENGTH + size;
+}
+
+/* out has room for the whole message */
+static size_t encode_message(uint8_t *out, const solana_message *message) {
+    const solana_instruction *ix;
+    uint8_t *p = out;
+    size_t i;
+
+    *p++ = message->signature_count;
+    *p++ = message->readonly_signed_count;
+    *p++ = message->readonly_count;
+
+    p += solana_short_vec_encode(p, message->account_count);
+
+    for (i = 0; i < message->account_count; ++i) {
+        memcpy(p, message->account_keys[i], SOLANA_KEY_LENGTH);
+        p += SOLANA_KEY_LENGTH;
+    }
+
+    memcpy(p, message->blockhash, SOLANA_HASH_LENGTH);
+    p += SOLANA_HASH_LENGTH;
+
+    p += solana_short_vec_encode(p, message->instruction_count);
+
+    for (i = 0; i < message->instruction_count; ++i) {
+        ix = &message->instructions[i];
+        *p++ = ix->program_index;
+
+        p += solana_short_vec_encode(p, ix->account_count);
+
+        if (ix->account_count > 0) {
+            memcpy(p, ix->accounts, ix->account_count);
+            p += ix->account_count;
+        }
+
+        p += solana_short_vec_encode(p, ix->data_len);
+
+        if (ix->data_len > 0) {
+            memcpy(p, ix->data, ix->data_len);
+            p += ix->data_len;
+        }
+    }
+
+    return (size_t) (p - out);
+}
+
+size_t solana_message_encode(uint8_t *out, size_t capacity, const solana_message *message) {
+    size_t size = solana_message_size(message);
+
+    if (size == 0 || size > capacity) {
+        return 0;
+    }
+
+    return encode_message(out, message);
+}
+
+size_t solana_transaction_encode(uint8_t *out, size_t capacity, const uint8_t *const *signatures, size_t signature_count, const solana_message *message) {
+    size_t size = solana_transaction_size(signature_count, message);
+    size_t n;
+    size_t i;
+
+    if (size == 0 || size > capacity) {
+        return 0;
+    }
+
+    n = solana_short_vec_encode(out, signature_count);
+
+    for (i = 0; i < signature_count; ++i) {
+        if (signatures != NULL && signatures[i] != NULL) {
+            memcpy(out + n, signatures[i], SOLANA_SIGNATURE_LENGTH);
+        } else {
+            memset(out + n, 0, SOLANA_SIGNATURE_LENGTH);
+        }
+
+        n += SOLANA_SIGNATURE_LENGTH;
+    }
+
+    return n + encode_message(out + n, message);
+}
+
+size_t solana_transaction_signature_offset(size_t signature_count, size_t index) {
+    return solana_short_vec_size(signature_count) + index * SOLANA_SIGNATURE_LENGTH;
+}
+
+size_t solana_transaction_message_offset(size_t signature_count) {
+    return solana_transaction_signature_offset(signature_count, signature_count);
+}
+
+size_t solana_message_blockhash_offset(size_t account_count) {
+    return SOLANA_HEADER_LENGTH + solana_short_vec_size(account_count) + account_count * SOLANA_KEY_LENGTH;
+}
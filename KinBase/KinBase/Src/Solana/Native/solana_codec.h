@@ -0,0 +1,129 @@
+#ifndef SOLANA_CODEC_H
+#define SOLANA_CODEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    Solana message and transaction wire format, see Transaction.swift.
+
+        transaction: short_vec<signature[64]> message
+        message:     header[3] short_vec<key[32]> blockhash[32] short_vec<instruction>
+        instruction: program_index short_vec<u8> short_vec<u8>
+
+    Decoding doesn't copy: views hold offsets into the decoded buffer, which
+    must outlive them. Encoding writes into a single caller buffer, sized
+    with solana_message_size or solana_transaction_size, reading keys,
+    signatures and instruction payloads from wherever they're stored.
+*/
+
+#define SOLANA_KEY_LENGTH 32
+#define SOLANA_HASH_LENGTH 32
+#define SOLANA_SIGNATURE_LENGTH 64
+#define SOLANA_HEADER_LENGTH 3
+#define SOLANA_SHORT_VEC_MAX 0xffff
+
+/* decode results */
+#define SOLANA_OK 0
+#define SOLANA_ERROR_TRUNCATED (-1)     /* the input ends inside a field */
+#define SOLANA_ERROR_SHORT_VEC (-2)     /* overlong or non-canonical length */
+#define SOLANA_ERROR_PROGRAM_INDEX (-3) /* program index past the account keys */
+
+typedef struct {
+    size_t offset;
+    size_t length;
+} solana_span;
+
+typedef struct {
+    uint8_t program_index;
+    solana_span accounts; /* one account index per byte */
+    solana_span data;
+} solana_instruction_view;
+
+/* offsets are from the start of the buffer given to the decoder */
+typedef struct {
+    uint8_t signature_count;
+    uint8_t readonly_signed_count;
+    uint8_t readonly_count;
+    size_t account_count;
+    size_t account_keys_offset; /* account_count keys back to back */
+    size_t blockhash_offset;
+    size_t instruction_count;
+    solana_span instructions;   /* the encoded instructions, without their count */
+    size_t offset;
+    size_t length;
+} solana_message_view;
+
+typedef struct {
+    size_t signature_count;
+    size_t signatures_offset; /* signature_count signatures back to back */
+    solana_message_view message;
+    size_t length;
+} solana_transaction_view;
+
+/*
+    Decode data into view and the first capacity instructions into
+    instructions (which may be NULL when capacity is 0). Every instruction
+    is validated either way, and view->instruction_count tells whether a
+    larger array is needed. Bytes after the message are ignored, its
+    length is in view->length.
+*/
+
+int solana_message_decode(solana_message_view *view, solana_instruction_view *instructions, size_t capacity, const uint8_t *data, size_t len);
+int solana_transaction_decode(solana_transaction_view *view, solana_instruction_view *instructions, size_t capacity, const uint8_t *data, size_t len);
+
+typedef struct {
+    uint8_t program_index;
+    const uint8_t *accounts;
+    size_t account_count;
+    const uint8_t *data;
+    size_t data_len;
+} solana_instruction;
+
+typedef struct {
+    uint8_t signature_count;
+    uint8_t readonly_signed_count;
+    uint8_t readonly_count;
+    const uint8_t *const *account_keys; /* account_count keys of SOLANA_KEY_LENGTH bytes */
+    size_t account_count;
+    const uint8_t *blockhash;
+    const solana_instruction *instructions;
+    size_t instruction_count;
+} solana_message;
+
+/* encoded sizes, 0 if a list is longer than a short_vec can count */
+size_t solana_message_size(const solana_message *message);
+size_t solana_transaction_size(size_t signature_count, const solana_message *message);
+
+/*
+    Return the number of bytes written, 0 if out is too small or the size
+    is 0. signatures holds signature_count pointers to SOLANA_SIGNATURE_LENGTH
+    bytes each. A NULL signatures, or a NULL entry, leaves zeroed slots in
+    front of the message, to be signed in place: the message, which is what
+    every signer signs, starts at solana_transaction_message_offset and
+    signature i at solana_transaction_signature_offset.
+*/
+
+size_t solana_message_encode(uint8_t *out, size_t capacity, const solana_message *message);
+size_t solana_transaction_encode(uint8_t *out, size_t capacity, const uint8_t *const *signatures, size_t signature_count, const solana_message *message);
+
+size_t solana_transaction_signature_offset(size_t signature_count, size_t index);
+size_t solana_transaction_message_offset(size_t signature_count);
+
+/* offset of the blockhash from the start of a message, for patching it in place */
+size_t solana_message_blockhash_offset(size_t account_count);
+
+/* short_vec helpers, exposed for the Swift wrappers and tests */
+size_t solana_short_vec_size(size_t value);
+size_t solana_short_vec_encode(uint8_t *out, size_t value);
+int solana_short_vec_decode(size_t *value, const uint8_t *data, size_t len, size_t *offset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
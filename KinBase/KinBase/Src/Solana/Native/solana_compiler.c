@@ -0,0 +1,256 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "solana_compiler.h"
+
+#define MAX_ACCOUNTS 256
+#define BASE58_LENGTH 45 /* 44 digits for a 32 byte key, and a NUL */
+
+typedef struct {
+    const uint8_t *key;
+    uint8_t flags;
+    uint8_t rank; /* sort class, lower first */
+    char base58[BASE58_LENGTH];
+} entry;
+
+/* the arena, from the most to the least aligned part */
+typedef struct {
+    solana_instruction *instructions;
+    entry *entries;
+    entry **order;
+    const uint8_t **keys;   /* the sorted keys, pointing into the specs */
+    uint32_t *table;        /* entry + 1, or 0 when empty */
+    uint32_t *meta_entries; /* the entry of every account meta, in input order */
+    uint8_t *positions;     /* the position of every entry in the sorted keys */
+    uint8_t *account_indices;
+} arena_layout;
+
+/* reserves size bytes at *offset, NULL when only sizing */
+static void *carve(uint8_t *base, size_t *offset, size_t size, size_t align) {
+    size_t start = (*offset + align - 1) & ~(align - 1);
+
+    *offset = start + size;
+    return base != NULL ? base + start : NULL;
+}
+
+/* with a NULL base, only returns the size */
+static size_t plan(arena_layout *layout, uint8_t *base, size_t instruction_count, size_t metas, size_t table_size, size_t index_count) {
+    size_t offset = 0;
+
+    layout->instructions = (solana_instruction *) carve(base, &offset, instruction_count * sizeof(solana_instruction), sizeof(void *));
+    layout->entries = (entry *) carve(base, &offset, metas * sizeof(entry), sizeof(void *));
+    layout->order = (entry **) carve(base, &offset, metas * sizeof(entry *), sizeof(void *));
+    layout->keys = (const uint8_t **) carve(base, &offset, metas * sizeof(uint8_t *), sizeof(void *));
+    layout->table = (uint32_t *) carve(base, &offset, table_size * sizeof(uint32_t), sizeof(uint32_t));
+    layout->meta_entries = (uint32_t *) carve(base, &offset, metas * sizeof(uint32_t), sizeof(uint32_t));
+    layout->positions = (uint8_t *) carve(base, &offset, metas, 1);
+    layout->account_indices = (uint8_t *) carve(base, &offset, index_count, 1);
+
+    return offset;
+}
+
+static void count_metas(size_t *metas, size_t *table_size, size_t *index_count, const solana_instruction_spec *instructions, size_t instruction_count) {
+    size_t i;
+
+    /* the payer, then each program and its accounts */
+    *metas = 1 + instruction_count;
+    *index_count = 0;
+
+    for (i = 0; i < instruction_count; ++i) {
+        *index_count += instructions[i].account_count;
+    }
+
+    *metas += *index_count;
+
+    /* at most half full */
+    *table_size = 2;
+
+    while (*table_size < 2 * *metas) {
+        *table_size *= 2;
+    }
+}
+
+size_t solana_message_compile_arena_size(const solana_instruction_spec *instructions, size_t instruction_count) {
+    arena_layout layout;
+    size_t metas, table_size, index_count;
+
+    count_metas(&metas, &table_size, &index_count, instructions, instruction_count);
+    return plan(&layout, NULL, instruction_count, metas, table_size, index_count);
+}
+
+/* FNV-1a */
+static uint64_t hash_key(const uint8_t *key) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    size_t i;
+
+    for (i = 0; i < SOLANA_KEY_LENGTH; ++i) {
+        h = (h ^ key[i]) * 0x100000001b3ULL;
+    }
+
+    return h;
+}
+
+/* the first meta of a key decides whether it's a program, the rest only promote it */
+static uint32_t insert(arena_layout *layout, size_t table_size, size_t *entry_count, const uint8_t *key, uint8_t flags) {
+    size_t slot = (size_t) hash_key(key) & (table_size - 1);
+    entry *e;
+
+    while (layout->table[slot] != 0) {
+        e = &layout->entries[layout->table[slot] - 1];
+
+        if (memcmp(e->key, key, SOLANA_KEY_LENGTH) == 0) {
+            e->flags |= flags & (SOLANA_ACCOUNT_SIGNER | SOLANA_ACCOUNT_WRITABLE | SOLANA_ACCOUNT_PAYER);
+            return layout->table[slot] - 1;
+        }
+
+        slot = (slot + 1) & (table_size - 1);
+    }
+
+    e = &layout->entries[*entry_count];
+    e->key = key;
+    e->flags = flags;
+    layout->table[slot] = (uint32_t) ++*entry_count;
+
+    return layout->table[slot] - 1;
+}
+
+static void base58_encode(char *out, const uint8_t *key) {
+    static const char alphabet[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+    uint8_t digits[BASE58_LENGTH];
+    size_t zeros = 0;
+    size_t n = 0;
+    size_t i, j;
+    unsigned carry;
+
+    while (zeros < SOLANA_KEY_LENGTH && key[zeros] == 0) {
+        out[zeros++] = '1';
+    }
+
+    /* little-endian base 58 digits */
+    for (i = zeros; i < SOLANA_KEY_LENGTH; ++i) {
+        carry = key[i];
+
+        for (j = 0; j < n; ++j) {
+            carry += (unsigned) digits[j] << 8;
+            digits[j] = (uint8_t) (carry % 58);
+            carry /= 58;
+        }
+
+        while (carry > 0) {
+            digits[n++] = (uint8_t) (carry % 58);
+            carry /= 58;
+        }
+    }
+
+    for (j = 0; j < n; ++j) {
+        out[zeros + j] = alphabet[digits[n - j - 1]];
+    }
+
+    out[zeros + n] = '\0';
+}
+
+static uint8_t rank_of(uint8_t flags) {
+    return (uint8_t) (((flags & SOLANA_ACCOUNT_PAYER) ? 0 : 8) |
+                      ((flags & SOLANA_ACCOUNT_PROGRAM) ? 4 : 0) |
+                      ((flags & SOLANA_ACCOUNT_SIGNER) ? 0 : 2) |
+                      ((flags & SOLANA_ACCOUNT_WRITABLE) ? 0 : 1));
+}
+
+/* keys are unique, so no two entries compare equal */
+static int compare(const void *a, const void *b) {
+    const entry *x = *(const entry *const *) a;
+    const entry *y = *(const entry *const *) b;
+
+    if (x->rank != y->rank) {
+        return x->rank < y->rank ? -1 : 1;
+    }
+
+    return strcmp(x->base58, y->base58);
+}
+
+int solana_message_compile(solana_message *message, void *arena, size_t arena_size, const uint8_t *payer, const solana_instruction_spec *instructions, size_t instruction_count) {
+    arena_layout layout;
+    const solana_instruction_spec *spec;
+    solana_instruction *ix;
+    size_t metas, table_size, index_count;
+    size_t entry_count = 0;
+    size_t signers = 0, readonly_signed = 0, readonly = 0;
+    size_t m = 0;
+    size_t offset = 0;
+    size_t i, j;
+    entry *e;
+
+    count_metas(&metas, &table_size, &index_count, instructions, instruction_count);
+
+    if (arena_size < plan(&layout, (uint8_t *) arena, instruction_count, metas, table_size, index_count)) {
+        return SOLANA_ERROR_ARENA;
+    }
+
+    memset(layout.table, 0, table_size * sizeof(uint32_t));
+
+    layout.meta_entries[m++] = insert(&layout, table_size, &entry_count, payer, SOLANA_ACCOUNT_PAYER | SOLANA_ACCOUNT_SIGNER | SOLANA_ACCOUNT_WRITABLE);
+
+    for (i = 0; i < instruction_count; ++i) {
+        spec = &instructions[i];
+        layout.meta_entries[m++] = insert(&layout, table_size, &entry_count, spec->program, SOLANA_ACCOUNT_PROGRAM);
+
+        for (j = 0; j < spec->account_count; ++j) {
+            layout.meta_entries[m++] = insert(&layout, table_size, &entry_count, spec->accounts[j].key, spec->accounts[j].flags);
+        }
+    }
+
+    if (entry_count > MAX_ACCOUNTS) {
+        return SOLANA_ERROR_TOO_MANY_ACCOUNTS;
+    }
+
+    for (i = 0; i < entry_count; ++i) {
+        e = &layout.entries[i];
+        e->rank = rank_of(e->flags);
+        base58_encode(e->base58, e->key);
+        layout.order[i] = e;
+
+        signers += (e->flags & SOLANA_ACCOUNT_SIGNER) != 0;
+        readonly_signed += (e->flags & (SOLANA_ACCOUNT_SIGNER | SOLANA_ACCOUNT_WRITABLE)) == SOLANA_ACCOUNT_SIGNER;
+        readonly += (e->flags & (SOLANA_ACCOUNT_SIGNER | SOLANA_ACCOUNT_WRITABLE)) == 0;
+    }
+
+    if (signers > UINT8_MAX || readonly > UINT8_MAX) {
+        return SOLANA_ERROR_TOO_MANY_ACCOUNTS;
+    }
+
+    qsort(layout.order, entry_count, sizeof(entry *), compare);
+
+    for (i = 0; i < entry_count; ++i) {
+        layout.positions[layout.order[i] - layout.entries] = (uint8_t) i;
+        layout.keys[i] = layout.order[i]->key;
+    }
+
+    /* past the payer, the metas are each program followed by its accounts */
+    m = 1;
+
+    for (i = 0; i < instruction_count; ++i) {
+        spec = &instructions[i];
+        ix = &layout.instructions[i];
+
+        ix->program_index = layout.positions[layout.meta_entries[m++]];
+        ix->accounts = layout.account_indices + offset;
+        ix->account_count = spec->account_count;
+        ix->data = spec->data;
+        ix->data_len = spec->data_len;
+
+        for (j = 0; j < spec->account_count; ++j) {
+            layout.account_indices[offset++] = layout.positions[layout.meta_entries[m++]];
+        }
+    }
+
+    message->signature_count = (uint8_t) signers;
+    message->readonly_signed_count = (uint8_t) readonly_signed;
+    message->readonly_count = (uint8_t) readonly;
+    message->account_keys = layout.keys;
+    message->account_count = entry_count;
+    message->blockhash = NULL;
+    message->instructions = layout.instructions;
+    message->instruction_count = instruction_count;
+
+    return SOLANA_OK;
+}
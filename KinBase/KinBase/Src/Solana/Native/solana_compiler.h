@@ -0,0 +1,65 @@
+#ifndef SOLANA_COMPILER_H
+#define SOLANA_COMPILER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "solana_codec.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    Compiles a payer and instructions into a solana_message, as
+    Transaction.init(payer:instructions:) does. Account keys are deduped
+    with a hash table, which keeps the first program flag seen for a key
+    and promotes the others, then ordered with one sort:
+
+        payer, then non-programs before programs, then signers before
+        non-signers, then writable before read-only, then by base58 key
+
+    Instruction indices are resolved from the table without searching
+    the key list. Everything the message points to, except the keys and
+    instruction data it takes from the input, is laid out in an arena
+    supplied by the caller.
+*/
+
+#define SOLANA_ACCOUNT_SIGNER 0x01
+#define SOLANA_ACCOUNT_WRITABLE 0x02
+#define SOLANA_ACCOUNT_PAYER 0x04
+#define SOLANA_ACCOUNT_PROGRAM 0x08
+
+/* compile results, along with SOLANA_OK */
+#define SOLANA_ERROR_TOO_MANY_ACCOUNTS (-4) /* more than 256 keys, which an index byte can't address */
+#define SOLANA_ERROR_ARENA (-5)             /* the arena is smaller than solana_message_compile_arena_size */
+
+typedef struct {
+    const uint8_t *key; /* SOLANA_KEY_LENGTH bytes */
+    uint8_t flags;
+} solana_account_meta;
+
+typedef struct {
+    const uint8_t *program;
+    const solana_account_meta *accounts;
+    size_t account_count;
+    const uint8_t *data;
+    size_t data_len;
+} solana_instruction_spec;
+
+/* bytes of arena needed to compile instructions, aligned for a pointer */
+size_t solana_message_compile_arena_size(const solana_instruction_spec *instructions, size_t instruction_count);
+
+/*
+    Fill message, which stays valid as long as arena, payer and the keys
+    and data of the specs do. The blockhash is left NULL for the caller to set before
+    encoding.
+*/
+
+int solana_message_compile(solana_message *message, void *arena, size_t arena_size, const uint8_t *payer, const solana_instruction_spec *instructions, size_t instruction_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
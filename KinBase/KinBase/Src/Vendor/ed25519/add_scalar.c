@@ -2,6 +2,7 @@
 #include "ge.h"
 #include "sc.h"
 #include "sha512.h"
+#include "stats.h"
 
 
 /* see http://crypto.stackexchange.com/a/6215/4697 */
@@ -20,6 +21,8 @@ void ed25519_add_scalar(unsigned char *public_key, unsigned char *private_key, c
 
     int i;
 
+    STATS_START(timer);
+
     /* copy the scalar and clear highest bit */
     for (i = 0; i < 31; ++i) {
         n[i] = scalar[i];
@@ -66,4 +69,6 @@ void ed25519_add_scalar(unsigned char *public_key, unsigned char *private_key, c
         /* pack public key */
         ge_p3_tobytes(public_key, &A);
     }
+
+    STATS_STOP(timer, ADD_SCALAR);
 }
@@ -0,0 +1,390 @@
+#include <string.h>
+
+#include "kined25519.h"
+#include "sha512.h"
+#include "ge.h"
+#include "sc.h"
+#include "stats.h"
+
+/*
+    Batch verification checks a random linear combination of the cofactored
+    verification equations of a group of signatures at once:
+
+        8 ((sum z_i s_i) B - sum (z_i h_i) A_i - sum z_i R_i) == 0
+
+    with independent 128-bit z_i. If the combined check fails the group is
+    bisected until every invalid signature is isolated, so callers still get
+    a valid/invalid result per signature.
+
+    Multiplying by the cofactor clears any small-order component of A and R,
+    so the weights can't cancel torsion terms across signatures and no
+    subgroup checks are needed. The answer for every signature is the one
+    ed25519_verify_cofactored gives, except with probability 2^-128. That
+    differs from ed25519_verify only for keys or R with a small-order
+    component, which honest signers never produce: ed25519_verify rejects
+    some of those signatures, the cofactored check accepts them.
+*/
+
+#define BATCH_MAX 64
+#define BATCH_POINTS (2 * BATCH_MAX + 1)
+#define BATCH_SCRATCH_SIZE (64 * 1024)
+#define BATCH_STRAUS_MAX 40 /* keeps the Straus tables within the scratch buffer */
+
+static const ge_msm_params msm_params = { 0, 0, BATCH_STRAUS_MAX };
+
+typedef struct {
+    const unsigned char *signature;
+    ge_p3 A; /* -A */
+    ge_p3 R; /* -R */
+    unsigned char h[32];
+    unsigned char z[32];
+    size_t index;
+} batch_entry;
+
+static const unsigned char base_point[32] = {
+    0x58, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66
+};
+
+/* p = 2^255 - 19, little endian */
+static const unsigned char field_order[32] = {
+    0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f
+};
+
+/*
+    ed25519_verify never accepts a non-canonical R since it compares against
+    a freshly encoded point, so the batch path must reject those up front.
+*/
+
+static int is_canonical_point(const unsigned char *s) {
+    unsigned char y[32];
+    int i;
+
+    for (i = 0; i < 32; ++i) {
+        y[i] = s[i];
+    }
+    y[31] &= 127;
+
+    for (i = 31; i >= 0; --i) {
+        if (y[i] != field_order[i]) {
+            return y[i] < field_order[i];
+        }
+    }
+
+    return 0;
+}
+
+/* [8]p */
+static void mul_by_cofactor(ge_p2 *r, const ge_p2 *p) {
+    ge_p1p1 t;
+
+    ge_p2_dbl(&t, p);
+    ge_p1p1_to_p2(r, &t);
+    ge_p2_dbl(&t, r);
+    ge_p1p1_to_p2(r, &t);
+    ge_p2_dbl(&t, r);
+    ge_p1p1_to_p2(r, &t);
+}
+
+static int is_identity(const ge_p2 *p) {
+    fe t;
+    fe_sub(t, p->Y, p->Z);
+    return !fe_isnonzero(p->X) && !fe_isnonzero(t);
+}
+
+/* X1 Z2 == X2 Z1 and Y1 Z2 == Y2 Z1 */
+static int is_equal(const ge_p2 *p, const ge_p2 *q) {
+    fe a;
+    fe b;
+
+    fe_mul(a, p->X, q->Z);
+    fe_mul(b, q->X, p->Z);
+    fe_sub(a, a, b);
+
+    if (fe_isnonzero(a)) {
+        return 0;
+    }
+
+    fe_mul(a, p->Y, q->Z);
+    fe_mul(b, q->Y, p->Z);
+    fe_sub(a, a, b);
+    return !fe_isnonzero(a);
+}
+
+/* rejects what ed25519_verify can never accept, and decodes -A and -R */
+static int decode_entry(batch_entry *e, const unsigned char *signature, const unsigned char *public_key) {
+    if ((signature[63] & 224) ||
+        !is_canonical_point(signature) ||
+        ge_frombytes_negate_vartime(&e->A, public_key) != 0 ||
+        ge_frombytes_negate_vartime(&e->R, signature) != 0 ||
+        (!fe_isnonzero(e->R.X) && (signature[31] & 128))) {
+        return 0;
+    }
+
+    e->signature = signature;
+    return 1;
+}
+
+/* 8 (sB - hA) == 8 R */
+static int check_single(const batch_entry *e) {
+    ge_p2 lhs;
+    ge_p2 rhs;
+
+    ge_double_scalarmult_vartime(&lhs, e->h, &e->A, e->signature + 32);
+    mul_by_cofactor(&lhs, &lhs);
+
+    ge_p3_to_p2(&rhs, &e->R);
+    fe_neg(rhs.X, rhs.X); /* -R back to R */
+    mul_by_cofactor(&rhs, &rhs);
+
+    return is_equal(&lhs, &rhs);
+}
+
+static int check_group(batch_entry **entries, size_t count, const ge_p3 *B) {
+    unsigned char scalars[BATCH_POINTS * 32];
+    ge_p3 points[BATCH_POINTS];
+    unsigned char scratch[BATCH_SCRATCH_SIZE];
+    unsigned char zero[32] = {0};
+    ge_p3 r;
+    ge_p2 sum;
+    size_t i;
+    int j;
+
+    if (count == 1) {
+        return check_single(entries[0]);
+    }
+
+    for (j = 0; j < 32; ++j) {
+        scalars[j] = 0;
+    }
+    points[0] = *B;
+
+    for (i = 0; i < count; ++i) {
+        sc_muladd(scalars, entries[i]->z, entries[i]->signature + 32, scalars);
+        sc_muladd(scalars + (2 * i + 1) * 32, entries[i]->z, entries[i]->h, zero);
+        points[2 * i + 1] = entries[i]->A;
+
+        /* z is below 2^128 and needs no reduction */
+        for (j = 0; j < 32; ++j) {
+            scalars[(2 * i + 2) * 32 + j] = entries[i]->z[j];
+        }
+        points[2 * i + 2] = entries[i]->R;
+    }
+
+    if (ge_multiscalarmult_vartime(&r, scalars, points, 2 * count + 1, scratch, sizeof(scratch), &msm_params) != 0) {
+        return 0;
+    }
+
+    ge_p3_to_p2(&sum, &r);
+    mul_by_cofactor(&sum, &sum);
+    return is_identity(&sum);
+}
+
+/* returns 1 if every entry is valid, clearing results[] for invalid ones */
+static int bisect(batch_entry **entries, size_t count, const ge_p3 *B, int *results) {
+    size_t half;
+    int left;
+    int right;
+
+    if (check_group(entries, count, B)) {
+        return 1;
+    }
+
+    if (count == 1) {
+        if (results) {
+            results[entries[0]->index] = 0;
+        }
+
+        return 0;
+    }
+
+    /* without a results array there is nothing to isolate */
+    if (!results) {
+        return 0;
+    }
+
+    half = count / 2;
+    left = bisect(entries, half, B, results);
+    right = bisect(entries + half, count - half, B, results);
+    return left && right;
+}
+
+/* h_i = SHA512(R_i || A_i || M_i) mod l, four signatures at a time */
+static void hash_entries(batch_entry *entries, size_t count, const unsigned char *const *messages, const size_t *message_lens, const unsigned char *const *public_keys) {
+    const unsigned char *r[SHA512_LANES];
+    const unsigned char *a[SHA512_LANES];
+    const unsigned char *m[SHA512_LANES];
+    unsigned char *out[SHA512_LANES];
+    unsigned char h[SHA512_LANES][64];
+    size_t point_lens[SHA512_LANES];
+    size_t m_lens[SHA512_LANES];
+    sha512x4_context hash;
+    size_t i;
+    int l;
+    int j;
+
+    for (i = 0; i < count; i += SHA512_LANES) {
+        for (l = 0; l < SHA512_LANES; ++l) {
+            if (i + l < count) {
+                const batch_entry *e = &entries[i + l];
+                r[l] = e->signature;
+                a[l] = public_keys[e->index];
+                m[l] = messages[e->index];
+                point_lens[l] = 32;
+                m_lens[l] = message_lens[e->index];
+                out[l] = h[l];
+            } else {
+                r[l] = a[l] = m[l] = NULL;
+                point_lens[l] = m_lens[l] = 0;
+                out[l] = NULL;
+            }
+        }
+
+        sha512x4_init(&hash);
+        sha512x4_update(&hash, r, point_lens);
+        sha512x4_update(&hash, a, point_lens);
+        sha512x4_update(&hash, m, m_lens);
+        sha512x4_final(&hash, out);
+
+        sc_reduce_n(h[0], count - i < SHA512_LANES ? count - i : SHA512_LANES);
+
+        for (l = 0; l < SHA512_LANES && i + l < count; ++l) {
+            for (j = 0; j < 32; ++j) {
+                entries[i + l].h[j] = h[l][j];
+            }
+        }
+    }
+}
+
+static void derive_weights(batch_entry *entries, size_t count) {
+    unsigned char entropy[32] = {0};
+    unsigned char transcript[64];
+    unsigned char block[68];
+    unsigned char out[64];
+    sha512_context hash;
+    size_t i;
+    int j;
+
+#ifndef ED25519_NO_SEED
+    ed25519_create_seed(entropy);
+#endif
+
+    /* bind the weights to the whole batch so they can't be predicted per signature */
+    sha512_init(&hash);
+    sha512_update(&hash, entropy, 32);
+
+    for (i = 0; i < count; ++i) {
+        sha512_update(&hash, entries[i].signature, 64);
+        sha512_update(&hash, entries[i].h, 32);
+    }
+
+    sha512_final(&hash, transcript);
+
+    for (j = 0; j < 64; ++j) {
+        block[j] = transcript[j];
+    }
+
+    for (i = 0; i < count; ++i) {
+        block[64] = (unsigned char) (i >> 0);
+        block[65] = (unsigned char) (i >> 8);
+        block[66] = (unsigned char) (i >> 16);
+        block[67] = (unsigned char) (i >> 24);
+        sha512(block, sizeof(block), out);
+
+        for (j = 0; j < 16; ++j) {
+            entries[i].z[j] = out[j];
+            entries[i].z[j + 16] = 0;
+        }
+
+        entries[i].z[0] |= 1;
+    }
+}
+
+int ed25519_verify_batch(size_t count, const unsigned char *const *signatures, const unsigned char *const *messages, const size_t *message_lens, const unsigned char *const *public_keys, int *results) {
+    batch_entry entries[BATCH_MAX];
+    batch_entry *group[BATCH_MAX];
+    ge_p3 B;
+    size_t offset;
+    size_t grouped;
+    size_t i;
+    int valid = 1;
+
+    STATS_START(timer);
+    ge_frombytes_negate_vartime(&B, base_point);
+    fe_neg(B.X, B.X); /* undo negate */
+    fe_neg(B.T, B.T);
+
+    for (offset = 0; offset < count; offset += BATCH_MAX) {
+        grouped = 0;
+
+        for (i = offset; i < count && i < offset + BATCH_MAX; ++i) {
+            const unsigned char *signature = signatures[i];
+            batch_entry *e = &entries[grouped];
+
+            if (results) {
+                results[i] = 1;
+            }
+
+            if (!decode_entry(e, signature, public_keys[i])) {
+                if (results) {
+                    results[i] = 0;
+                }
+
+                valid = 0;
+                continue;
+            }
+
+            e->index = i;
+            group[grouped] = e;
+            ++grouped;
+        }
+
+        if (!valid && !results) {
+            break;
+        }
+
+        if (grouped == 0) {
+            continue;
+        }
+
+        hash_entries(entries, grouped, messages, message_lens, public_keys);
+
+        derive_weights(entries, grouped);
+
+        if (!bisect(group, grouped, &B, results)) {
+            valid = 0;
+
+            if (!results) {
+                break;
+            }
+        }
+    }
+
+    STATS_STOP(timer, VERIFY_BATCH);
+    return valid;
+}
+
+int ed25519_verify_cofactored(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key) {
+    unsigned char h[64];
+    sha512_context hash;
+    batch_entry e;
+    int valid = 0;
+
+    STATS_START(timer);
+
+    if (decode_entry(&e, signature, public_key)) {
+        sha512_init(&hash);
+        sha512_update(&hash, signature, 32);
+        sha512_update(&hash, public_key, 32);
+        sha512_update(&hash, message, message_len);
+        sha512_final(&hash, h);
+        sc_reduce(h);
+        memcpy(e.h, h, 32);
+
+        valid = check_single(&e);
+    }
+
+    STATS_STOP(timer, VERIFY);
+    return valid;
+}
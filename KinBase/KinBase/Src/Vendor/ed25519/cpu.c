@@ -0,0 +1,96 @@
+#include "kined25519.h"
+#include "cpu.h"
+#include "fe.h"
+#include "sha512.h"
+
+#if defined(ED25519_DISPATCH_X86)
+#include <cpuid.h>
+#endif
+
+#define FEATURES_PROBED (1u << 31)
+
+static unsigned int features;
+
+#if defined(ED25519_DISPATCH_X86)
+
+/* the OS has to save the wider registers before AVX can be used */
+static unsigned int xgetbv0(void) {
+    unsigned int eax;
+    unsigned int edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return eax;
+}
+
+static unsigned int probe(void) {
+    unsigned int eax, ebx, ecx, edx;
+    unsigned int xcr0 = 0;
+    unsigned int found = 0;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return 0;
+    }
+
+    if ((ecx & bit_OSXSAVE) && (ecx & bit_AVX)) {
+        xcr0 = xgetbv0();
+    }
+
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return 0;
+    }
+
+    if (ebx & (1u << 8)) {
+        found |= ED25519_CPU_BMI2;
+    }
+
+    if (ebx & (1u << 19)) {
+        found |= ED25519_CPU_ADX;
+    }
+
+    /* XMM and YMM state */
+    if ((xcr0 & 0x06) == 0x06 && (ebx & (1u << 5))) {
+        found |= ED25519_CPU_AVX2;
+    }
+
+    /* plus opmask and ZMM state */
+    if ((xcr0 & 0xe6) == 0xe6 && (ebx & (1u << 16))) {
+        found |= ED25519_CPU_AVX512F;
+
+        if (ebx & (1u << 31)) {
+            found |= ED25519_CPU_AVX512VL;
+        }
+    }
+
+    return found;
+}
+
+#elif defined(__aarch64__)
+
+static unsigned int probe(void) {
+    return ED25519_CPU_NEON; /* baseline on aarch64 */
+}
+
+#else
+
+static unsigned int probe(void) {
+    return 0;
+}
+
+#endif
+
+unsigned int ed25519_cpu_features(void) {
+    unsigned int f = DISPATCH_LOAD(features);
+
+    if (!(f & FEATURES_PROBED)) {
+        f = probe() | FEATURES_PROBED;
+        DISPATCH_STORE(features, f);
+    }
+
+    return f & ~FEATURES_PROBED;
+}
+
+void ed25519_get_backends(ed25519_backends *backends) {
+    backends->cpu_features = ed25519_cpu_features();
+    backends->field = fe_backend();
+    backends->sha512 = sha512_backend();
+    backends->sha512x4 = sha512x4_backend();
+}
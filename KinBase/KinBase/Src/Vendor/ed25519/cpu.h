@@ -0,0 +1,30 @@
+#ifndef CPU_H
+#define CPU_H
+
+#include "kined25519.h"
+
+/*
+    Runtime CPU feature detection for the kernels with ISA-specific variants.
+    Define ED25519_NO_DISPATCH to build only the portable kernels.
+*/
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(ED25519_NO_DISPATCH)
+    #define ED25519_DISPATCH_X86
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define ED25519_INLINE static inline __attribute__((always_inline))
+    #define ED25519_TARGET(isa) __attribute__((target(isa)))
+
+    /* kernel pointers are resolved lazily, racing threads store the same value */
+    #define DISPATCH_LOAD(p) __atomic_load_n(&(p), __ATOMIC_RELAXED)
+    #define DISPATCH_STORE(p, v) __atomic_store_n(&(p), (v), __ATOMIC_RELAXED)
+#else
+    #define ED25519_INLINE static
+    #define DISPATCH_LOAD(p) (p)
+    #define DISPATCH_STORE(p, v) ((p) = (v))
+#endif
+
+unsigned int ed25519_cpu_features(void);
+
+#endif
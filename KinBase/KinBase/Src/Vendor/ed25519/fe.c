@@ -1,6 +1,8 @@
 #include "fixedint.h"
 #include "fe.h"
+#include "stats.h"
 
+#ifndef ED25519_FE51
 
 /*
     helper functions
@@ -360,6 +362,12 @@ void fe_frombytes(fe h, const unsigned char *s) {
 }
 
 
+#endif /* ED25519_FE51 */
+
+/*
+    fe_invert, fe_batch_invert and fe_pow22523 only use fe_sq, fe_mul and
+    fe_copy, so they are shared by both field backends (see fe51.c).
+*/
 
 void fe_invert(fe out, const fe z) {
     fe t0;
@@ -368,6 +376,7 @@ void fe_invert(fe out, const fe z) {
     fe t3;
     int i;
 
+    STATS_START(timer);
     fe_sq(t0, z);
 
     for (i = 1; i < 1; ++i) {
@@ -445,8 +454,46 @@ void fe_invert(fe out, const fe z) {
     }
 
     fe_mul(out, t1, t0);
+    STATS_STOP(timer, FE_INVERT);
+}
+
+
+
+/*
+    out[i] = 1 / in[i] for all count elements with a single inversion
+    (Montgomery's trick), at the cost of 3 multiplications per element.
+    scratch holds count elements, out may be in. No input may be zero.
+*/
+
+void fe_batch_invert(fe *out, const fe *in, size_t count, fe *scratch) {
+    fe inv;
+    fe t;
+    size_t i;
+
+    if (count == 0) {
+        return;
+    }
+
+    /* scratch[i] = in[0] * ... * in[i] */
+    fe_copy(scratch[0], in[0]);
+
+    for (i = 1; i < count; ++i) {
+        fe_mul(scratch[i], scratch[i - 1], in[i]);
+    }
+
+    fe_invert(inv, scratch[count - 1]);
+
+    for (i = count - 1; i > 0; --i) {
+        fe_mul(t, inv, scratch[i - 1]);
+        fe_mul(inv, inv, in[i]);
+        fe_copy(out[i], t);
+    }
+
+    fe_copy(out[0], inv);
 }
 
+#ifndef ED25519_FE51
+
 
 
 /*
@@ -554,6 +601,7 @@ int fe_isnonzero(const fe f) {
 */
 
 void fe_mul(fe h, const fe f, const fe g) {
+    STATS_START(timer);
     int32_t f0 = f[0];
     int32_t f1 = f[1];
     int32_t f2 = f[2];
@@ -762,6 +810,7 @@ void fe_mul(fe h, const fe f, const fe g) {
     h[7] = (int32_t) h7;
     h[8] = (int32_t) h8;
     h[9] = (int32_t) h9;
+    STATS_STOP(timer, FE_MUL);
 }
 
 
@@ -877,6 +926,7 @@ void fe_neg(fe h, const fe f) {
     h[9] = h9;
 }
 
+#endif /* ED25519_FE51 */
 
 void fe_pow22523(fe out, const fe z) {
     fe t0;
@@ -963,6 +1013,8 @@ void fe_pow22523(fe out, const fe z) {
     return;
 }
 
+#ifndef ED25519_FE51
+
 
 /*
 h = f * f
@@ -980,6 +1032,7 @@ See fe_mul.c for discussion of implementation strategy.
 */
 
 void fe_sq(fe h, const fe f) {
+    STATS_START(timer);
     int32_t f0 = f[0];
     int32_t f1 = f[1];
     int32_t f2 = f[2];
@@ -1124,6 +1177,7 @@ void fe_sq(fe h, const fe f) {
     h[7] = (int32_t) h7;
     h[8] = (int32_t) h8;
     h[9] = (int32_t) h9;
+    STATS_STOP(timer, FE_SQ);
 }
 
 
@@ -1143,6 +1197,7 @@ See fe_mul.c for discussion of implementation strategy.
 */
 
 void fe_sq2(fe h, const fe f) {
+    STATS_START(timer);
     int32_t f0 = f[0];
     int32_t f1 = f[1];
     int32_t f2 = f[2];
@@ -1297,6 +1352,7 @@ void fe_sq2(fe h, const fe f) {
     h[7] = (int32_t) h7;
     h[8] = (int32_t) h8;
     h[9] = (int32_t) h9;
+    STATS_STOP(timer, FE_SQ);
 }
 
 
@@ -1489,3 +1545,11 @@ void fe_tobytes(unsigned char *s, const fe h) {
     s[30] = (unsigned char) ((uint32_t) h9 >> 10);
     s[31] = (unsigned char) ((uint32_t) h9 >> 18);
 }
+
+
+
+const char *fe_backend(void) {
+    return "fe10";
+}
+
+#endif /* ED25519_FE51 */
@@ -1,9 +1,50 @@
 #ifndef FE_H
 #define FE_H
 
+#include <stddef.h>
+
 #include "fixedint.h"
 
 
+/*
+    Compilers with 128-bit integers get the radix 2^51 backend in fe51.c,
+    define ED25519_NO_FE51 to force the portable radix 2^25.5 one in fe.c.
+*/
+
+#if !defined(ED25519_FE51) && !defined(ED25519_NO_FE51) && defined(__SIZEOF_INT128__)
+    #define ED25519_FE51
+#endif
+
+
+#ifdef ED25519_FE51
+
+/*
+    fe means field element.
+    Here the field is \Z/(2^255-19).
+    An element t, entries t[0]...t[4], represents the integer
+    t[0]+2^51 t[1]+2^102 t[2]+2^153 t[3]+2^204 t[4].
+    Limbs are kept below 2^53 between operations.
+*/
+
+typedef uint64_t fe[5];
+
+/*
+    Constants are written in the radix 2^25.5 form below and folded into
+    51-bit limbs, adding 2p so signed inputs stay non-negative.
+*/
+
+#define FE51_CONST_LIMB(lo, hi, twop) ((uint64_t) ((int64_t) (twop) + (int64_t) (lo) + (int64_t) (hi) * 67108864))
+
+#define FE_CONST(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9) { \
+    FE51_CONST_LIMB(t0, t1, 0xfffffffffffdaLL), \
+    FE51_CONST_LIMB(t2, t3, 0xffffffffffffeLL), \
+    FE51_CONST_LIMB(t4, t5, 0xffffffffffffeLL), \
+    FE51_CONST_LIMB(t6, t7, 0xffffffffffffeLL), \
+    FE51_CONST_LIMB(t8, t9, 0xffffffffffffeLL)  \
+}
+
+#else
+
 /*
     fe means field element.
     Here the field is \Z/(2^255-19).
@@ -12,9 +53,12 @@
     Bounds on each t[i] vary depending on context.
 */
 
-
 typedef int32_t fe[10];
 
+#define FE_CONST(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9) { t0, t1, t2, t3, t4, t5, t6, t7, t8, t9 }
+
+#endif
+
 
 void fe_0(fe h);
 void fe_1(fe h);
@@ -31,6 +75,7 @@ void fe_cswap(fe f, fe g, unsigned int b);
 void fe_neg(fe h, const fe f);
 void fe_add(fe h, const fe f, const fe g);
 void fe_invert(fe out, const fe z);
+void fe_batch_invert(fe *out, const fe *in, size_t count, fe *scratch);
 void fe_sq(fe h, const fe f);
 void fe_sq2(fe h, const fe f);
 void fe_mul(fe h, const fe f, const fe g);
@@ -38,4 +83,7 @@ void fe_mul121666(fe h, fe f);
 void fe_pow22523(fe out, const fe z);
 void fe_sub(fe h, const fe f, const fe g);
 
+/* name of the field arithmetic kernel in use */
+const char *fe_backend(void);
+
 #endif
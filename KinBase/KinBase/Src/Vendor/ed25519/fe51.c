@@ -0,0 +1,512 @@
+#include "fixedint.h"
+#include "fe.h"
+#include "cpu.h"
+#include "stats.h"
+
+#ifdef ED25519_FE51
+
+/*
+    Radix 2^51 field arithmetic for 64-bit targets.
+
+    Every operation leaves its result weakly reduced (limbs below 2^51 plus a
+    small carry), so inputs are bounded by 2^53 including FE_CONST values.
+    Products are accumulated in 128-bit integers.
+*/
+
+typedef unsigned __int128 uint128_t;
+
+#define MASK51 ((uint64_t) 0x7ffffffffffff)
+
+/* 4p, added before subtracting to keep limbs non-negative */
+#define FOURP0 ((uint64_t) 0x1fffffffffffb4)
+#define FOURP1 ((uint64_t) 0x1ffffffffffffc)
+
+
+/*
+    helper functions
+*/
+static uint64_t load_8(const unsigned char *in) {
+    uint64_t result;
+
+    result = (uint64_t) in[0];
+    result |= ((uint64_t) in[1]) << 8;
+    result |= ((uint64_t) in[2]) << 16;
+    result |= ((uint64_t) in[3]) << 24;
+    result |= ((uint64_t) in[4]) << 32;
+    result |= ((uint64_t) in[5]) << 40;
+    result |= ((uint64_t) in[6]) << 48;
+    result |= ((uint64_t) in[7]) << 56;
+
+    return result;
+}
+
+static void store_8(unsigned char *out, uint64_t in) {
+    out[0] = (unsigned char) in;
+    out[1] = (unsigned char) (in >> 8);
+    out[2] = (unsigned char) (in >> 16);
+    out[3] = (unsigned char) (in >> 24);
+    out[4] = (unsigned char) (in >> 32);
+    out[5] = (unsigned char) (in >> 40);
+    out[6] = (unsigned char) (in >> 48);
+    out[7] = (unsigned char) (in >> 56);
+}
+
+static void fe_carry(fe h, uint64_t h0, uint64_t h1, uint64_t h2, uint64_t h3, uint64_t h4) {
+    h1 += h0 >> 51;
+    h0 &= MASK51;
+    h2 += h1 >> 51;
+    h1 &= MASK51;
+    h3 += h2 >> 51;
+    h2 &= MASK51;
+    h4 += h3 >> 51;
+    h3 &= MASK51;
+    h0 += 19 * (h4 >> 51);
+    h4 &= MASK51;
+
+    h[0] = h0;
+    h[1] = h1;
+    h[2] = h2;
+    h[3] = h3;
+    h[4] = h4;
+}
+
+/* folds 128-bit column sums into weakly reduced limbs */
+ED25519_INLINE void fe_carry_wide(fe h, uint128_t t0, uint128_t t1, uint128_t t2, uint128_t t3, uint128_t t4) {
+    uint64_t h0;
+    uint64_t h1;
+    uint64_t h2;
+    uint64_t h3;
+    uint64_t h4;
+
+    t1 += t0 >> 51;
+    h0 = (uint64_t) t0 & MASK51;
+    t2 += t1 >> 51;
+    h1 = (uint64_t) t1 & MASK51;
+    t3 += t2 >> 51;
+    h2 = (uint64_t) t2 & MASK51;
+    t4 += t3 >> 51;
+    h3 = (uint64_t) t3 & MASK51;
+    t0 = (uint128_t) h0 + (t4 >> 51) * 19;
+    h4 = (uint64_t) t4 & MASK51;
+    h0 = (uint64_t) t0 & MASK51;
+    h1 += (uint64_t) (t0 >> 51);
+
+    h[0] = h0;
+    h[1] = h1;
+    h[2] = h2;
+    h[3] = h3;
+    h[4] = h4;
+}
+
+
+
+/*
+    h = 0
+*/
+
+void fe_0(fe h) {
+    h[0] = 0;
+    h[1] = 0;
+    h[2] = 0;
+    h[3] = 0;
+    h[4] = 0;
+}
+
+
+
+/*
+    h = 1
+*/
+
+void fe_1(fe h) {
+    h[0] = 1;
+    h[1] = 0;
+    h[2] = 0;
+    h[3] = 0;
+    h[4] = 0;
+}
+
+
+
+/*
+    h = f + g
+    Can overlap h with f or g.
+*/
+
+void fe_add(fe h, const fe f, const fe g) {
+    fe_carry(h, f[0] + g[0], f[1] + g[1], f[2] + g[2], f[3] + g[3], f[4] + g[4]);
+}
+
+
+
+/*
+    Replace (f,g) with (g,g) if b == 1;
+    replace (f,g) with (f,g) if b == 0.
+
+    Preconditions: b in {0,1}.
+*/
+
+void fe_cmov(fe f, const fe g, unsigned int b) {
+    uint64_t mask = (uint64_t) 0 - (uint64_t) b;
+
+    f[0] ^= mask & (f[0] ^ g[0]);
+    f[1] ^= mask & (f[1] ^ g[1]);
+    f[2] ^= mask & (f[2] ^ g[2]);
+    f[3] ^= mask & (f[3] ^ g[3]);
+    f[4] ^= mask & (f[4] ^ g[4]);
+}
+
+
+
+/*
+    Replace (f,g) with (g,f) if b == 1;
+    replace (f,g) with (f,g) if b == 0.
+
+    Preconditions: b in {0,1}.
+*/
+
+void fe_cswap(fe f, fe g, unsigned int b) {
+    uint64_t mask = (uint64_t) 0 - (uint64_t) b;
+    uint64_t x;
+    int i;
+
+    for (i = 0; i < 5; ++i) {
+        x = mask & (f[i] ^ g[i]);
+        f[i] ^= x;
+        g[i] ^= x;
+    }
+}
+
+
+
+/*
+    h = f
+*/
+
+void fe_copy(fe h, const fe f) {
+    h[0] = f[0];
+    h[1] = f[1];
+    h[2] = f[2];
+    h[3] = f[3];
+    h[4] = f[4];
+}
+
+
+
+/*
+    Ignores top bit of s.
+*/
+
+void fe_frombytes(fe h, const unsigned char *s) {
+    h[0] = load_8(s) & MASK51;
+    h[1] = (load_8(s + 6) >> 3) & MASK51;
+    h[2] = (load_8(s + 12) >> 6) & MASK51;
+    h[3] = (load_8(s + 19) >> 1) & MASK51;
+    h[4] = (load_8(s + 24) >> 12) & MASK51;
+}
+
+
+
+/*
+    return 1 if f is in {1,3,5,...,q-2}
+    return 0 if f is in {0,2,4,...,q-1}
+*/
+
+int fe_isnegative(const fe f) {
+    unsigned char s[32];
+
+    fe_tobytes(s, f);
+
+    return s[0] & 1;
+}
+
+
+
+/*
+    return 1 if f == 0
+    return 0 if f != 0
+*/
+
+int fe_isnonzero(const fe f) {
+    unsigned char s[32];
+    unsigned char r = 0;
+    int i;
+
+    fe_tobytes(s, f);
+
+    for (i = 0; i < 32; ++i) {
+        r |= s[i];
+    }
+
+    return r != 0;
+}
+
+
+
+/*
+    h = f * g
+    Can overlap h with f or g.
+
+    Schoolbook multiplication, the wrap-around terms are folded in by
+    multiplying g by 19 up front.
+*/
+
+ED25519_INLINE void fe51_mul(fe h, const fe f, const fe g) {
+    uint64_t f0 = f[0];
+    uint64_t f1 = f[1];
+    uint64_t f2 = f[2];
+    uint64_t f3 = f[3];
+    uint64_t f4 = f[4];
+    uint64_t g0 = g[0];
+    uint64_t g1 = g[1];
+    uint64_t g2 = g[2];
+    uint64_t g3 = g[3];
+    uint64_t g4 = g[4];
+    uint64_t g1_19 = 19 * g1;
+    uint64_t g2_19 = 19 * g2;
+    uint64_t g3_19 = 19 * g3;
+    uint64_t g4_19 = 19 * g4;
+    uint128_t t0;
+    uint128_t t1;
+    uint128_t t2;
+    uint128_t t3;
+    uint128_t t4;
+
+    t0 = (uint128_t) f0 * g0 + (uint128_t) f1 * g4_19 + (uint128_t) f2 * g3_19 + (uint128_t) f3 * g2_19 + (uint128_t) f4 * g1_19;
+    t1 = (uint128_t) f0 * g1 + (uint128_t) f1 * g0 + (uint128_t) f2 * g4_19 + (uint128_t) f3 * g3_19 + (uint128_t) f4 * g2_19;
+    t2 = (uint128_t) f0 * g2 + (uint128_t) f1 * g1 + (uint128_t) f2 * g0 + (uint128_t) f3 * g4_19 + (uint128_t) f4 * g3_19;
+    t3 = (uint128_t) f0 * g3 + (uint128_t) f1 * g2 + (uint128_t) f2 * g1 + (uint128_t) f3 * g0 + (uint128_t) f4 * g4_19;
+    t4 = (uint128_t) f0 * g4 + (uint128_t) f1 * g3 + (uint128_t) f2 * g2 + (uint128_t) f3 * g1 + (uint128_t) f4 * g0;
+
+    fe_carry_wide(h, t0, t1, t2, t3, t4);
+}
+
+
+
+/*
+h = f * 121666
+Can overlap h with f.
+*/
+
+void fe_mul121666(fe h, fe f) {
+    fe_carry_wide(h,
+                  (uint128_t) f[0] * 121666,
+                  (uint128_t) f[1] * 121666,
+                  (uint128_t) f[2] * 121666,
+                  (uint128_t) f[3] * 121666,
+                  (uint128_t) f[4] * 121666);
+}
+
+
+
+/*
+h = -f
+*/
+
+void fe_neg(fe h, const fe f) {
+    fe_carry(h, FOURP0 - f[0], FOURP1 - f[1], FOURP1 - f[2], FOURP1 - f[3], FOURP1 - f[4]);
+}
+
+
+
+/*
+h = f * f
+Can overlap h with f.
+*/
+
+ED25519_INLINE void fe51_sq(fe h, const fe f) {
+    uint64_t f0 = f[0];
+    uint64_t f1 = f[1];
+    uint64_t f2 = f[2];
+    uint64_t f3 = f[3];
+    uint64_t f4 = f[4];
+    uint64_t f0_2 = 2 * f0;
+    uint64_t f1_2 = 2 * f1;
+    uint64_t f1_38 = 38 * f1;
+    uint64_t f2_38 = 38 * f2;
+    uint64_t f3_38 = 38 * f3;
+    uint64_t f3_19 = 19 * f3;
+    uint64_t f4_19 = 19 * f4;
+    uint128_t t0;
+    uint128_t t1;
+    uint128_t t2;
+    uint128_t t3;
+    uint128_t t4;
+
+    t0 = (uint128_t) f0 * f0 + (uint128_t) f1_38 * f4 + (uint128_t) f2_38 * f3;
+    t1 = (uint128_t) f0_2 * f1 + (uint128_t) f2_38 * f4 + (uint128_t) f3_19 * f3;
+    t2 = (uint128_t) f0_2 * f2 + (uint128_t) f1 * f1 + (uint128_t) f3_38 * f4;
+    t3 = (uint128_t) f0_2 * f3 + (uint128_t) f1_2 * f2 + (uint128_t) f4_19 * f4;
+    t4 = (uint128_t) f0_2 * f4 + (uint128_t) f1_2 * f3 + (uint128_t) f2 * f2;
+
+    fe_carry_wide(h, t0, t1, t2, t3, t4);
+}
+
+
+
+/*
+    On x86-64 fe_mul and fe_sq go through a kernel picked on first use: the
+    BMI2/ADX build lets the compiler use mulx for the 128-bit products.
+    Everywhere else they call the generic kernel directly.
+*/
+
+#ifdef ED25519_DISPATCH_X86
+
+typedef void (*fe_mul_fn)(fe h, const fe f, const fe g);
+typedef void (*fe_sq_fn)(fe h, const fe f);
+
+static void fe_mul_generic(fe h, const fe f, const fe g) {
+    fe51_mul(h, f, g);
+}
+
+static void fe_sq_generic(fe h, const fe f) {
+    fe51_sq(h, f);
+}
+
+ED25519_TARGET("bmi2,adx") static void fe_mul_bmi2(fe h, const fe f, const fe g) {
+    fe51_mul(h, f, g);
+}
+
+ED25519_TARGET("bmi2,adx") static void fe_sq_bmi2(fe h, const fe f) {
+    fe51_sq(h, f);
+}
+
+static void fe_mul_resolve(fe h, const fe f, const fe g);
+static void fe_sq_resolve(fe h, const fe f);
+
+static fe_mul_fn fe_mul_impl = fe_mul_resolve;
+static fe_sq_fn fe_sq_impl = fe_sq_resolve;
+
+static int use_bmi2(void) {
+    unsigned int bmi2_adx = ED25519_CPU_BMI2 | ED25519_CPU_ADX;
+    return (ed25519_cpu_features() & bmi2_adx) == bmi2_adx;
+}
+
+static void fe_resolve(void) {
+    if (use_bmi2()) {
+        DISPATCH_STORE(fe_mul_impl, fe_mul_bmi2);
+        DISPATCH_STORE(fe_sq_impl, fe_sq_bmi2);
+    } else {
+        DISPATCH_STORE(fe_mul_impl, fe_mul_generic);
+        DISPATCH_STORE(fe_sq_impl, fe_sq_generic);
+    }
+}
+
+static void fe_mul_resolve(fe h, const fe f, const fe g) {
+    fe_resolve();
+    fe_mul(h, f, g);
+}
+
+static void fe_sq_resolve(fe h, const fe f) {
+    fe_resolve();
+    fe_sq(h, f);
+}
+
+const char *fe_backend(void) {
+    return use_bmi2() ? "fe51-bmi2" : "fe51";
+}
+
+void fe_mul(fe h, const fe f, const fe g) {
+    STATS_START(timer);
+    DISPATCH_LOAD(fe_mul_impl)(h, f, g);
+    STATS_STOP(timer, FE_MUL);
+}
+
+void fe_sq(fe h, const fe f) {
+    STATS_START(timer);
+    DISPATCH_LOAD(fe_sq_impl)(h, f);
+    STATS_STOP(timer, FE_SQ);
+}
+
+#else
+
+const char *fe_backend(void) {
+    return "fe51";
+}
+
+void fe_mul(fe h, const fe f, const fe g) {
+    STATS_START(timer);
+    fe51_mul(h, f, g);
+    STATS_STOP(timer, FE_MUL);
+}
+
+void fe_sq(fe h, const fe f) {
+    STATS_START(timer);
+    fe51_sq(h, f);
+    STATS_STOP(timer, FE_SQ);
+}
+
+#endif
+
+
+
+/*
+h = 2 * f * f
+Can overlap h with f.
+*/
+
+void fe_sq2(fe h, const fe f) {
+    fe_sq(h, f);
+    fe_add(h, h, h);
+}
+
+
+
+/*
+h = f - g
+Can overlap h with f or g.
+*/
+
+void fe_sub(fe h, const fe f, const fe g) {
+    fe_carry(h, f[0] + FOURP0 - g[0], f[1] + FOURP1 - g[1], f[2] + FOURP1 - g[2], f[3] + FOURP1 - g[3], f[4] + FOURP1 - g[4]);
+}
+
+
+
+/*
+    Fully reduces h modulo p = 2^255-19 before encoding.
+*/
+
+void fe_tobytes(unsigned char *s, const fe h) {
+    uint64_t h0;
+    uint64_t h1;
+    uint64_t h2;
+    uint64_t h3;
+    uint64_t h4;
+    uint64_t q;
+    fe t;
+
+    /* two passes leave every limb below 2^51 */
+    fe_carry(t, h[0], h[1], h[2], h[3], h[4]);
+    fe_carry(t, t[0], t[1], t[2], t[3], t[4]);
+    h0 = t[0];
+    h1 = t[1];
+    h2 = t[2];
+    h3 = t[3];
+    h4 = t[4];
+
+    /* q = 1 iff h >= p */
+    q = (h0 + 19) >> 51;
+    q = (h1 + q) >> 51;
+    q = (h2 + q) >> 51;
+    q = (h3 + q) >> 51;
+    q = (h4 + q) >> 51;
+
+    h0 += 19 * q;
+    h1 += h0 >> 51;
+    h0 &= MASK51;
+    h2 += h1 >> 51;
+    h1 &= MASK51;
+    h3 += h2 >> 51;
+    h2 &= MASK51;
+    h4 += h3 >> 51;
+    h3 &= MASK51;
+    h4 &= MASK51;
+
+    store_8(s + 0, h0 | (h1 << 51));
+    store_8(s + 8, (h1 >> 13) | (h2 << 38));
+    store_8(s + 16, (h2 >> 26) | (h3 << 25));
+    store_8(s + 24, (h3 >> 39) | (h4 << 12));
+}
+
+#endif /* ED25519_FE51 */
@@ -1,6 +1,52 @@
+#include <string.h>
+
 #include "ge.h"
+#include "cpu.h"
+#include "stats.h"
+
+/*
+The fixed-base table used by ge_scalarmult_base is chosen at build time.
+Wider windows need fewer additions but every lookup scans more entries;
+a single pass trades table size for the doublings between passes.
+
+  default                     radix 2^4, 2 passes, 30 KiB
+  ED25519_BASE_TABLE_64K      radix 2^4, 1 pass,   60 KiB
+  ED25519_BASE_TABLE_128K     radix 2^5, 1 pass,  100 KiB
+
+The tables are generated by gen_base_table.py. A ge_precomp is 120 bytes,
+so with the table on a 64-byte boundary every row of 8 or 16 entries
+starts on a cache line and select() touches whole lines only.
+*/
+
+#if defined(__GNUC__) || defined(__clang__)
+#define BASE_TABLE_ALIGN __attribute__((aligned(64)))
+#else
+#define BASE_TABLE_ALIGN
+#endif
+
+#if defined(ED25519_BASE_TABLE_128K)
+#define BASE_WINDOW 5
+#define BASE_PASSES 1
+#define BASE_TABLE_EXTERNAL
+#include "precomp_base_128k.h"
+#elif defined(ED25519_BASE_TABLE_64K)
+#define BASE_WINDOW 4
+#define BASE_PASSES 1
+#define BASE_TABLE_EXTERNAL
+#include "precomp_base_64k.h"
+#else
+#define BASE_WINDOW 4
+#define BASE_PASSES 2
+#endif
+
 #include "precomp_data.h"
 
+/* Bi holds the 2^(BI_WINDOW-2) odd multiples of B */
+#define BI_WINDOW 8
+
+#define BASE_DIGITS ((256 + BASE_WINDOW - 1) / BASE_WINDOW)
+#define BASE_ENTRIES (1 << (BASE_WINDOW - 1))
+
 
 /*
 r = p + q
@@ -8,6 +54,7 @@ r = p + q
 
 void ge_add(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q) {
     fe t0;
+    STATS_START(timer);
     fe_add(r->X, p->Y, p->X);
     fe_sub(r->Y, p->Y, p->X);
     fe_mul(r->Z, r->X, q->YplusX);
@@ -19,10 +66,17 @@ void ge_add(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q) {
     fe_add(r->Y, r->Z, r->Y);
     fe_add(r->Z, t0, r->T);
     fe_sub(r->T, t0, r->T);
+    STATS_STOP(timer, GE_ADD);
 }
 
 
-static void slide(signed char *r, const unsigned char *a) {
+/*
+Signed sliding-window recoding of a:
+every nonzero r[i] is odd with |r[i]| < 2^(window-1).
+*/
+
+void ge_slide(signed char *r, const unsigned char *a, int window) {
+    int bound = (1 << (window - 1)) - 1;
     int i;
     int b;
     int k;
@@ -33,12 +87,12 @@ static void slide(signed char *r, const unsigned char *a) {
 
     for (i = 0; i < 256; ++i)
         if (r[i]) {
-            for (b = 1; b <= 6 && i + b < 256; ++b) {
+            for (b = 1; b <= window + 1 && i + b < 256; ++b) {
                 if (r[i + b]) {
-                    if (r[i] + (r[i + b] << b) <= 15) {
+                    if (r[i] + (r[i + b] << b) <= bound) {
                         r[i] += r[i + b] << b;
                         r[i + b] = 0;
-                    } else if (r[i] - (r[i + b] << b) >= -15) {
+                    } else if (r[i] - (r[i + b] << b) >= -bound) {
                         r[i] -= r[i + b] << b;
 
                         for (k = i + b; k < 256; ++k) {
@@ -57,6 +111,27 @@ static void slide(signed char *r, const unsigned char *a) {
         }
 }
 
+/*
+Ai = A,3A,5A,...,(2 count - 1)A
+*/
+
+void ge_p3_odd_multiples(ge_cached *Ai, const ge_p3 *A, int count) {
+    ge_p1p1 t;
+    ge_p3 u;
+    ge_p3 A2;
+    int i;
+
+    ge_p3_to_cached(&Ai[0], A);
+    ge_p3_dbl(&t, A);
+    ge_p1p1_to_p3(&A2, &t);
+
+    for (i = 1; i < count; ++i) {
+        ge_add(&t, &A2, &Ai[i - 1]);
+        ge_p1p1_to_p3(&u, &t);
+        ge_p3_to_cached(&Ai[i], &u);
+    }
+}
+
 /*
 r = a * A + b * B
 where a = a[0]+256*a[1]+...+256^31 a[31].
@@ -65,39 +140,26 @@ B is the Ed25519 base point (x,4/5) with x positive.
 */
 
 void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3 *A, const unsigned char *b) {
+    ge_cached Ai[8]; /* A,3A,5A,7A,9A,11A,13A,15A */
+    ge_p3_odd_multiples(Ai, A, 8);
+    ge_double_scalarmult_vartime_cached(r, a, Ai, 5, b);
+}
+
+/*
+Same as ge_double_scalarmult_vartime with a precomputed table
+Ai = A,3A,5A,...,(2^(awindow-1) - 1)A, see ge_p3_odd_multiples.
+b always uses the fixed Bi table with window BI_WINDOW.
+*/
+
+void ge_double_scalarmult_vartime_cached(ge_p2 *r, const unsigned char *a, const ge_cached *Ai, int awindow, const unsigned char *b) {
     signed char aslide[256];
     signed char bslide[256];
-    ge_cached Ai[8]; /* A,3A,5A,7A,9A,11A,13A,15A */
     ge_p1p1 t;
     ge_p3 u;
-    ge_p3 A2;
     int i;
-    slide(aslide, a);
-    slide(bslide, b);
-    ge_p3_to_cached(&Ai[0], A);
-    ge_p3_dbl(&t, A);
-    ge_p1p1_to_p3(&A2, &t);
-    ge_add(&t, &A2, &Ai[0]);
-    ge_p1p1_to_p3(&u, &t);
-    ge_p3_to_cached(&Ai[1], &u);
-    ge_add(&t, &A2, &Ai[1]);
-    ge_p1p1_to_p3(&u, &t);
-    ge_p3_to_cached(&Ai[2], &u);
-    ge_add(&t, &A2, &Ai[2]);
-    ge_p1p1_to_p3(&u, &t);
-    ge_p3_to_cached(&Ai[3], &u);
-    ge_add(&t, &A2, &Ai[3]);
-    ge_p1p1_to_p3(&u, &t);
-    ge_p3_to_cached(&Ai[4], &u);
-    ge_add(&t, &A2, &Ai[4]);
-    ge_p1p1_to_p3(&u, &t);
-    ge_p3_to_cached(&Ai[5], &u);
-    ge_add(&t, &A2, &Ai[5]);
-    ge_p1p1_to_p3(&u, &t);
-    ge_p3_to_cached(&Ai[6], &u);
-    ge_add(&t, &A2, &Ai[6]);
-    ge_p1p1_to_p3(&u, &t);
-    ge_p3_to_cached(&Ai[7], &u);
+    STATS_START(timer);
+    ge_slide(aslide, a, awindow);
+    ge_slide(bslide, b, BI_WINDOW);
     ge_p2_0(r);
 
     for (i = 255; i >= 0; --i) {
@@ -106,6 +168,7 @@ void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3
         }
     }
 
+    /* only additions read T, so the doubling chain stays in ge_p2 */
     for (; i >= 0; --i) {
         ge_p2_dbl(&t, r);
 
@@ -127,18 +190,16 @@ void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3
 
         ge_p1p1_to_p2(r, &t);
     }
+
+    STATS_STOP(timer, GE_DOUBLE_SCALARMULT);
 }
 
 
-static const fe d = {
-    -10913610, 13857413, -15372611, 6949391, 114729, -8787816, -6275908, -3247719, -18696448, -12055116
-};
+static const fe d = FE_CONST(-10913610, 13857413, -15372611, 6949391, 114729, -8787816, -6275908, -3247719, -18696448, -12055116);
 
-static const fe sqrtm1 = {
-    -32595792, -7943725, 9377950, 3500415, 12389472, -272473, -25146209, -2005654, 326686, 11406482
-};
+static const fe sqrtm1 = FE_CONST(-32595792, -7943725, 9377950, 3500415, 12389472, -272473, -25146209, -2005654, 326686, 11406482);
 
-int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s) {
+static int frombytes_negate_vartime(ge_p3 *h, const unsigned char *s) {
     fe u;
     fe v;
     fe v3;
@@ -180,6 +241,14 @@ int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s) {
     return 0;
 }
 
+int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s) {
+    int r;
+    STATS_START(timer);
+    r = frombytes_negate_vartime(h, s);
+    STATS_STOP(timer, GE_FROMBYTES);
+    return r;
+}
+
 
 /*
 r = p + q
@@ -187,6 +256,7 @@ r = p + q
 
 void ge_madd(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q) {
     fe t0;
+    STATS_START(timer);
     fe_add(r->X, p->Y, p->X);
     fe_sub(r->Y, p->Y, p->X);
     fe_mul(r->Z, r->X, q->yplusx);
@@ -197,6 +267,7 @@ void ge_madd(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q) {
     fe_add(r->Y, r->Z, r->Y);
     fe_add(r->Z, t0, r->T);
     fe_sub(r->T, t0, r->T);
+    STATS_STOP(timer, GE_MADD);
 }
 
 
@@ -207,6 +278,7 @@ r = p - q
 void ge_msub(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q) {
     fe t0;
 
+    STATS_START(timer);
     fe_add(r->X, p->Y, p->X);
     fe_sub(r->Y, p->Y, p->X);
     fe_mul(r->Z, r->X, q->yminusx);
@@ -217,6 +289,7 @@ void ge_msub(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q) {
     fe_add(r->Y, r->Z, r->Y);
     fe_sub(r->Z, t0, r->T);
     fe_add(r->T, t0, r->T);
+    STATS_STOP(timer, GE_MADD);
 }
 
 
@@ -259,6 +332,7 @@ r = 2 * p
 void ge_p2_dbl(ge_p1p1 *r, const ge_p2 *p) {
     fe t0;
 
+    STATS_START(timer);
     fe_sq(r->X, p->X);
     fe_sq(r->Z, p->Y);
     fe_sq2(r->T, p->Z);
@@ -268,6 +342,7 @@ void ge_p2_dbl(ge_p1p1 *r, const ge_p2 *p) {
     fe_sub(r->Z, r->Z, r->X);
     fe_sub(r->X, t0, r->Y);
     fe_sub(r->T, r->T, r->Z);
+    STATS_STOP(timer, GE_DBL);
 }
 
 
@@ -295,9 +370,7 @@ void ge_p3_dbl(ge_p1p1 *r, const ge_p3 *p) {
 r = p
 */
 
-static const fe d2 = {
-    -21827239, -5839606, -30745221, 13898782, 229458, 15978800, -12551817, -6495438, 29715968, 9444199
-};
+static const fe d2 = FE_CONST(-21827239, -5839606, -30745221, 13898782, 229458, 15978800, -12551817, -6495438, 29715968, 9444199);
 
 void ge_p3_to_cached(ge_cached *r, const ge_p3 *p) {
     fe_add(r->YplusX, p->Y, p->X);
@@ -330,6 +403,40 @@ void ge_p3_tobytes(unsigned char *s, const ge_p3 *h) {
 }
 
 
+#define TOBYTES_BATCH 64
+
+/*
+s[32 i .. 32 i + 31] = encoding of h[i], sharing one inversion between
+up to TOBYTES_BATCH points
+*/
+
+void ge_p3_batch_tobytes(unsigned char *s, const ge_p3 *h, size_t count) {
+    fe recip[TOBYTES_BATCH];
+    fe scratch[TOBYTES_BATCH];
+    fe x;
+    fe y;
+    size_t n;
+    size_t i;
+
+    for (; count > 0; count -= n, h += n, s += 32 * n) {
+        n = count < TOBYTES_BATCH ? count : TOBYTES_BATCH;
+
+        for (i = 0; i < n; ++i) {
+            fe_copy(recip[i], h[i].Z);
+        }
+
+        fe_batch_invert(recip, recip, n, scratch);
+
+        for (i = 0; i < n; ++i) {
+            fe_mul(x, h[i].X, recip[i]);
+            fe_mul(y, h[i].Y, recip[i]);
+            fe_tobytes(s + 32 * i, y);
+            s[32 * i + 31] ^= fe_isnegative(x) << 7;
+        }
+    }
+}
+
+
 static unsigned char equal(signed char b, signed char c) {
     unsigned char ub = b;
     unsigned char uc = c;
@@ -352,85 +459,170 @@ static void cmov(ge_precomp *t, const ge_precomp *u, unsigned char b) {
     fe_cmov(t->xy2d, u->xy2d, b);
 }
 
+/*
+    The lookup reads every entry of the row and keeps the wanted one with a
+    mask, so memory access doesn't depend on b. The masking runs over the
+    raw 64-bit words of the entries, in 128-bit vectors (SSE2 or NEON) where
+    the compiler supports them; define ED25519_NO_SELECT_SIMD for the
+    fe_cmov version.
+*/
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(ED25519_NO_SELECT_SIMD)
+
+typedef uint64_t select_vec __attribute__((vector_size(16)));
+
+#define SELECT_VECS (sizeof(ge_precomp) / sizeof(select_vec))
+#define SELECT_TAIL ((sizeof(ge_precomp) % sizeof(select_vec)) / sizeof(uint64_t))
+
+ED25519_INLINE void select_or(select_vec *acc, uint64_t *tail, const ge_precomp *entry, uint64_t mask) {
+    const unsigned char *p = (const unsigned char *) entry;
+    select_vec m = { mask, mask };
+    select_vec v;
+    uint64_t w;
+    size_t k;
+
+    for (k = 0; k < SELECT_VECS; ++k) {
+        memcpy(&v, p + k * sizeof(select_vec), sizeof(v));
+        acc[k] |= v & m;
+    }
+
+    for (k = 0; k < SELECT_TAIL; ++k) {
+        memcpy(&w, p + SELECT_VECS * sizeof(select_vec) + k * sizeof(w), sizeof(w));
+        tail[k] |= w & mask;
+    }
+}
+
+static void select(ge_precomp *t, int pos, signed char b) {
+    ge_precomp minust;
+    unsigned char bnegative = negative(b);
+    unsigned char babs = b - (((-bnegative) & b) * 2);
+    unsigned char *out = (unsigned char *) t;
+    select_vec acc[SELECT_VECS];
+    uint64_t tail[SELECT_TAIL + 1];
+    size_t k;
+    int i;
+
+    for (k = 0; k < SELECT_VECS; ++k) {
+        acc[k] = (select_vec) { 0, 0 };
+    }
+
+    for (k = 0; k < SELECT_TAIL; ++k) {
+        tail[k] = 0;
+    }
+
+    /* entry 0 is the neutral element (1, 1, 0) */
+    fe_1(minust.yplusx);
+    fe_1(minust.yminusx);
+    fe_0(minust.xy2d);
+    select_or(acc, tail, &minust, (uint64_t) 0 - equal(babs, 0));
+
+    for (i = 0; i < BASE_ENTRIES; ++i) {
+        select_or(acc, tail, &base[pos][i], (uint64_t) 0 - equal(babs, i + 1));
+    }
+
+    memcpy(out, acc, SELECT_VECS * sizeof(select_vec));
+    memcpy(out + SELECT_VECS * sizeof(select_vec), tail, SELECT_TAIL * sizeof(uint64_t));
+
+    fe_copy(minust.yplusx, t->yminusx);
+    fe_copy(minust.yminusx, t->yplusx);
+    fe_neg(minust.xy2d, t->xy2d);
+    cmov(t, &minust, bnegative);
+}
+
+#else
 
 static void select(ge_precomp *t, int pos, signed char b) {
     ge_precomp minust;
     unsigned char bnegative = negative(b);
     unsigned char babs = b - (((-bnegative) & b) * 2);
+    int i;
     fe_1(t->yplusx);
     fe_1(t->yminusx);
     fe_0(t->xy2d);
-    cmov(t, &base[pos][0], equal(babs, 1));
-    cmov(t, &base[pos][1], equal(babs, 2));
-    cmov(t, &base[pos][2], equal(babs, 3));
-    cmov(t, &base[pos][3], equal(babs, 4));
-    cmov(t, &base[pos][4], equal(babs, 5));
-    cmov(t, &base[pos][5], equal(babs, 6));
-    cmov(t, &base[pos][6], equal(babs, 7));
-    cmov(t, &base[pos][7], equal(babs, 8));
+
+    for (i = 0; i < BASE_ENTRIES; ++i) {
+        cmov(t, &base[pos][i], equal(babs, i + 1));
+    }
+
     fe_copy(minust.yplusx, t->yminusx);
     fe_copy(minust.yminusx, t->yplusx);
     fe_neg(minust.xy2d, t->xy2d);
     cmov(t, &minust, bnegative);
 }
 
+#endif
+
 /*
 h = a * B
 where a = a[0]+256*a[1]+...+256^31 a[31]
 B is the Ed25519 base point (x,4/5) with x positive.
 
+a is recoded into signed radix-2^BASE_WINDOW digits e[i]. Digit i is added
+from base[i / BASE_PASSES], so each pass over the table covers every
+BASE_PASSES-th digit and passes are separated by BASE_WINDOW doublings.
+
 Preconditions:
   a[31] <= 127
 */
 
 void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
-    signed char e[64];
+    signed char e[BASE_DIGITS];
     signed char carry;
     ge_p1p1 r;
     ge_p2 s;
     ge_precomp t;
+    int pass;
     int i;
 
-    for (i = 0; i < 32; ++i) {
-        e[2 * i + 0] = (a[i] >> 0) & 15;
-        e[2 * i + 1] = (a[i] >> 4) & 15;
+    STATS_START(timer);
+
+    for (i = 0; i < BASE_DIGITS; ++i) {
+        int bit = i * BASE_WINDOW;
+        int v = 0;
+        int b;
+
+        for (b = 0; b < BASE_WINDOW && bit + b < 256; ++b) {
+            v |= ((a[(bit + b) >> 3] >> ((bit + b) & 7)) & 1) << b;
+        }
+
+        e[i] = (signed char) v;
     }
 
-    /* each e[i] is between 0 and 15 */
-    /* e[63] is between 0 and 7 */
+    /* each e[i] is between 0 and 2^BASE_WINDOW - 1 */
     carry = 0;
 
-    for (i = 0; i < 63; ++i) {
+    for (i = 0; i < BASE_DIGITS - 1; ++i) {
         e[i] += carry;
-        carry = e[i] + 8;
-        carry >>= 4;
-        e[i] -= carry << 4;
+        carry = e[i] + (1 << (BASE_WINDOW - 1));
+        carry >>= BASE_WINDOW;
+        e[i] -= carry << BASE_WINDOW;
     }
 
-    e[63] += carry;
-    /* each e[i] is between -8 and 8 */
+    e[BASE_DIGITS - 1] += carry;
+    /* each e[i] is between -2^(BASE_WINDOW-1) and 2^(BASE_WINDOW-1) */
     ge_p3_0(h);
 
-    for (i = 1; i < 64; i += 2) {
-        select(&t, i / 2, e[i]);
-        ge_madd(&r, h, &t);
-        ge_p1p1_to_p3(h, &r);
-    }
+    for (pass = BASE_PASSES - 1; pass >= 0; --pass) {
+        if (pass != BASE_PASSES - 1) {
+            ge_p3_to_p2(&s, h);
 
-    ge_p3_dbl(&r, h);
-    ge_p1p1_to_p2(&s, &r);
-    ge_p2_dbl(&r, &s);
-    ge_p1p1_to_p2(&s, &r);
-    ge_p2_dbl(&r, &s);
-    ge_p1p1_to_p2(&s, &r);
-    ge_p2_dbl(&r, &s);
-    ge_p1p1_to_p3(h, &r);
-
-    for (i = 0; i < 64; i += 2) {
-        select(&t, i / 2, e[i]);
-        ge_madd(&r, h, &t);
-        ge_p1p1_to_p3(h, &r);
+            for (i = 0; i < BASE_WINDOW - 1; ++i) {
+                ge_p2_dbl(&r, &s);
+                ge_p1p1_to_p2(&s, &r);
+            }
+
+            ge_p2_dbl(&r, &s);
+            ge_p1p1_to_p3(h, &r);
+        }
+
+        for (i = pass; i < BASE_DIGITS; i += BASE_PASSES) {
+            select(&t, i / BASE_PASSES, e[i]);
+            ge_madd(&r, h, &t);
+            ge_p1p1_to_p3(h, &r);
+        }
     }
+
+    STATS_STOP(timer, GE_SCALARMULT_BASE);
 }
 
 
@@ -441,6 +633,7 @@ r = p - q
 void ge_sub(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q) {
     fe t0;
     
+    STATS_START(timer);
     fe_add(r->X, p->Y, p->X);
     fe_sub(r->Y, p->Y, p->X);
     fe_mul(r->Z, r->X, q->YminusX);
@@ -452,6 +645,7 @@ void ge_sub(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q) {
     fe_add(r->Y, r->Z, r->Y);
     fe_sub(r->Z, t0, r->T);
     fe_add(r->T, t0, r->T);
+    STATS_STOP(timer, GE_ADD);
 }
 
 
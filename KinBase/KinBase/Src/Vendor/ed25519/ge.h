@@ -1,6 +1,8 @@
 #ifndef GE_H
 #define GE_H
 
+#include <stddef.h>
+
 #include "fe.h"
 
 
@@ -51,16 +53,35 @@ typedef struct {
   fe T2d;
 } ge_cached;
 
+/*
+Tuning for ge_multiscalarmult_vartime, zero fields pick the defaults:
+  straus_window: sliding window width for Straus, 2..8
+  pippenger_window: bucket window width for Pippenger, 2..16
+  straus_max_points: largest input handled by Straus
+*/
+
+typedef struct {
+  int straus_window;
+  int pippenger_window;
+  size_t straus_max_points;
+} ge_msm_params;
+
 void ge_p3_tobytes(unsigned char *s, const ge_p3 *h);
+void ge_p3_batch_tobytes(unsigned char *s, const ge_p3 *h, size_t count);
 void ge_tobytes(unsigned char *s, const ge_p2 *h);
 int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s);
 
 void ge_add(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q);
 void ge_sub(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q);
 void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3 *A, const unsigned char *b);
+void ge_double_scalarmult_vartime_cached(ge_p2 *r, const unsigned char *a, const ge_cached *Ai, int awindow, const unsigned char *b);
 void ge_madd(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q);
 void ge_msub(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q);
 void ge_scalarmult_base(ge_p3 *h, const unsigned char *a);
+void ge_slide(signed char *r, const unsigned char *a, int window);
+
+size_t ge_multiscalarmult_scratch_size(size_t count, const ge_msm_params *params);
+int ge_multiscalarmult_vartime(ge_p3 *r, const unsigned char *scalars, const ge_p3 *points, size_t count, void *scratch, size_t scratch_size, const ge_msm_params *params);
 
 void ge_p1p1_to_p2(ge_p2 *r, const ge_p1p1 *p);
 void ge_p1p1_to_p3(ge_p3 *r, const ge_p1p1 *p);
@@ -68,6 +89,7 @@ void ge_p2_0(ge_p2 *h);
 void ge_p2_dbl(ge_p1p1 *r, const ge_p2 *p);
 void ge_p3_0(ge_p3 *h);
 void ge_p3_dbl(ge_p1p1 *r, const ge_p3 *p);
+void ge_p3_odd_multiples(ge_cached *Ai, const ge_p3 *A, int count);
 void ge_p3_to_cached(ge_cached *r, const ge_p3 *p);
 void ge_p3_to_p2(ge_p2 *r, const ge_p3 *p);
 
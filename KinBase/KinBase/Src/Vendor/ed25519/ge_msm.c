@@ -0,0 +1,307 @@
+#include "ge.h"
+#include "stats.h"
+
+/*
+    Variable-time multi-scalar multiplication
+
+        r = scalars[0] * points[0] + ... + scalars[n-1] * points[n-1]
+
+    Small inputs use Straus' method (interleaved sliding windows sharing one
+    doubling chain), large inputs use Pippenger's bucket method with signed
+    digits. All working memory comes from the caller's scratch buffer, see
+    ge_multiscalarmult_scratch_size.
+
+    Preconditions:
+      scalars[i][31] <= 127
+*/
+
+#define STRAUS_WINDOW_DEFAULT 5
+#define STRAUS_MAX_POINTS_DEFAULT 128
+#define PIPPENGER_WINDOW_MAX 16
+#define SCRATCH_ALIGN 16
+
+static size_t align_up(size_t n) {
+    return (n + SCRATCH_ALIGN - 1) & ~(size_t) (SCRATCH_ALIGN - 1);
+}
+
+static int straus_window(const ge_msm_params *params) {
+    if (params && params->straus_window >= 2 && params->straus_window <= 8) {
+        return params->straus_window;
+    }
+
+    return STRAUS_WINDOW_DEFAULT;
+}
+
+static int use_straus(size_t count, const ge_msm_params *params) {
+    size_t max = STRAUS_MAX_POINTS_DEFAULT;
+
+    if (params && params->straus_max_points) {
+        max = params->straus_max_points;
+    }
+
+    return count <= max;
+}
+
+/* minimizes the number of additions, roughly (256 / c) * (count + 2^c) */
+static int pippenger_window(size_t count, const ge_msm_params *params) {
+    size_t best_cost = (size_t) -1;
+    int best = 2;
+    int c;
+
+    if (params && params->pippenger_window >= 2 && params->pippenger_window <= PIPPENGER_WINDOW_MAX) {
+        return params->pippenger_window;
+    }
+
+    for (c = 2; c <= PIPPENGER_WINDOW_MAX; ++c) {
+        size_t cost = (256 / c + 1) * (count + ((size_t) 1 << c));
+
+        if (cost < best_cost) {
+            best_cost = cost;
+            best = c;
+        }
+    }
+
+    return best;
+}
+
+static size_t straus_scratch_size(size_t count, int window) {
+    return align_up(count * 256) +
+           align_up(count * ((size_t) 1 << (window - 2)) * sizeof(ge_cached));
+}
+
+static size_t pippenger_scratch_size(size_t count, int window) {
+    size_t windows = 256 / window + 1;
+
+    return align_up(count * windows * sizeof(short)) +
+           align_up(((size_t) 1 << (window - 1)) * sizeof(ge_p3)) +
+           align_up(((size_t) 1 << (window - 1)) * sizeof(unsigned char)) +
+           align_up(count * sizeof(ge_cached));
+}
+
+/* includes slack so that any scratch pointer can be aligned */
+size_t ge_multiscalarmult_scratch_size(size_t count, const ge_msm_params *params) {
+    if (use_straus(count, params)) {
+        return SCRATCH_ALIGN + straus_scratch_size(count, straus_window(params));
+    }
+
+    return SCRATCH_ALIGN + pippenger_scratch_size(count, pippenger_window(count, params));
+}
+
+static void p3_add_cached(ge_p3 *r, const ge_p3 *p, const ge_cached *q) {
+    ge_p1p1 t;
+    ge_add(&t, p, q);
+    ge_p1p1_to_p3(r, &t);
+}
+
+static void p3_add(ge_p3 *r, const ge_p3 *p, const ge_p3 *q) {
+    ge_cached c;
+    ge_p3_to_cached(&c, q);
+    p3_add_cached(r, p, &c);
+}
+
+static void straus(ge_p3 *r, const unsigned char *scalars, const ge_p3 *points, size_t count, int window, unsigned char *scratch) {
+    size_t entries = (size_t) 1 << (window - 2); /* P,3P,5P,... */
+    signed char *slides = (signed char *) scratch;
+    ge_cached *tables = (ge_cached *) (scratch + align_up(count * 256));
+    ge_p1p1 t;
+    ge_p3 u;
+    ge_p2 acc;
+    signed char digit;
+    size_t j;
+    int i;
+
+    for (j = 0; j < count; ++j) {
+        ge_slide(slides + j * 256, scalars + j * 32, window);
+        ge_p3_odd_multiples(tables + j * entries, &points[j], (int) entries);
+    }
+
+    ge_p3_0(r);
+
+    for (i = 255; i >= 0; --i) {
+        for (j = 0; j < count; ++j) {
+            if (slides[j * 256 + i]) {
+                break;
+            }
+        }
+
+        if (j < count) {
+            break;
+        }
+    }
+
+    ge_p2_0(&acc);
+
+    for (; i >= 0; --i) {
+        ge_p2_dbl(&t, &acc);
+
+        for (j = 0; j < count; ++j) {
+            digit = slides[j * 256 + i];
+
+            if (digit > 0) {
+                ge_p1p1_to_p3(&u, &t);
+                ge_add(&t, &u, &tables[j * entries + digit / 2]);
+            } else if (digit < 0) {
+                ge_p1p1_to_p3(&u, &t);
+                ge_sub(&t, &u, &tables[j * entries + (-digit) / 2]);
+            }
+        }
+
+        if (i == 0) {
+            ge_p1p1_to_p3(r, &t);
+        } else {
+            ge_p1p1_to_p2(&acc, &t);
+        }
+    }
+}
+
+/*
+Signed radix-2^c digits of a, each in [-2^(c-1), 2^(c-1)).
+The last digit absorbs the final carry.
+*/
+
+static void recode_signed(short *digits, const unsigned char *a, int c, size_t windows) {
+    int carry = 0;
+    int half = 1 << (c - 1);
+    int mask = (1 << c) - 1;
+    size_t w;
+
+    for (w = 0; w < windows; ++w) {
+        int bit = (int) w * c;
+        int value = 0;
+        int b;
+
+        for (b = 0; b < c && bit + b < 256; ++b) {
+            value |= ((a[(bit + b) >> 3] >> ((bit + b) & 7)) & 1) << b;
+        }
+
+        value = (value & mask) + carry;
+        carry = value >= half;
+        digits[w] = (short) (value - (carry << c));
+    }
+}
+
+static void pippenger(ge_p3 *r, const unsigned char *scalars, const ge_p3 *points, size_t count, int c, unsigned char *scratch) {
+    size_t windows = 256 / c + 1;
+    size_t buckets = (size_t) 1 << (c - 1);
+    short *digits = (short *) scratch;
+    ge_p3 *bucket = (ge_p3 *) (scratch + align_up(count * windows * sizeof(short)));
+    unsigned char *used = (unsigned char *) bucket + align_up(buckets * sizeof(ge_p3));
+    ge_cached *cached = (ge_cached *) (used + align_up(buckets));
+    ge_p1p1 t;
+    ge_p2 s;
+    ge_p3 running;
+    ge_p3 sum;
+    int running_used;
+    int sum_used;
+    int acc_used = 0;
+    size_t w;
+    size_t j;
+    size_t b;
+    int k;
+
+    for (j = 0; j < count; ++j) {
+        recode_signed(digits + j * windows, scalars + j * 32, c, windows);
+        ge_p3_to_cached(&cached[j], &points[j]);
+    }
+
+    ge_p3_0(r);
+
+    for (w = windows; w-- > 0;) {
+        if (acc_used) {
+            ge_p3_to_p2(&s, r);
+
+            for (k = 0; k < c - 1; ++k) {
+                ge_p2_dbl(&t, &s);
+                ge_p1p1_to_p2(&s, &t);
+            }
+
+            ge_p2_dbl(&t, &s);
+            ge_p1p1_to_p3(r, &t);
+        }
+
+        for (b = 0; b < buckets; ++b) {
+            used[b] = 0;
+        }
+
+        for (j = 0; j < count; ++j) {
+            short digit = digits[j * windows + w];
+
+            if (digit > 0) {
+                b = digit - 1;
+
+                if (used[b]) {
+                    p3_add_cached(&bucket[b], &bucket[b], &cached[j]);
+                } else {
+                    bucket[b] = points[j];
+                    used[b] = 1;
+                }
+            } else if (digit < 0) {
+                b = -digit - 1;
+
+                if (used[b]) {
+                    ge_sub(&t, &bucket[b], &cached[j]);
+                    ge_p1p1_to_p3(&bucket[b], &t);
+                } else {
+                    bucket[b] = points[j];
+                    fe_neg(bucket[b].X, bucket[b].X);
+                    fe_neg(bucket[b].T, bucket[b].T);
+                    used[b] = 1;
+                }
+            }
+        }
+
+        /* sum = 1 * bucket[0] + 2 * bucket[1] + ... via running sums */
+        running_used = 0;
+        sum_used = 0;
+
+        for (b = buckets; b-- > 0;) {
+            if (used[b]) {
+                if (running_used) {
+                    p3_add(&running, &running, &bucket[b]);
+                } else {
+                    running = bucket[b];
+                    running_used = 1;
+                }
+            }
+
+            if (running_used) {
+                if (sum_used) {
+                    p3_add(&sum, &sum, &running);
+                } else {
+                    sum = running;
+                    sum_used = 1;
+                }
+            }
+        }
+
+        if (sum_used) {
+            if (acc_used) {
+                p3_add(r, r, &sum);
+            } else {
+                *r = sum;
+                acc_used = 1;
+            }
+        }
+    }
+}
+
+int ge_multiscalarmult_vartime(ge_p3 *r, const unsigned char *scalars, const ge_p3 *points, size_t count, void *scratch, size_t scratch_size, const ge_msm_params *params) {
+    unsigned char *aligned = (unsigned char *) scratch + (SCRATCH_ALIGN - ((size_t) scratch & (SCRATCH_ALIGN - 1))) % SCRATCH_ALIGN;
+
+    if (scratch_size < ge_multiscalarmult_scratch_size(count, params)) {
+        return -1;
+    }
+
+    STATS_START(timer);
+
+    if (count == 0) {
+        ge_p3_0(r);
+    } else if (use_straus(count, params)) {
+        straus(r, scalars, points, count, straus_window(params), aligned);
+    } else {
+        pippenger(r, scalars, points, count, pippenger_window(count, params), aligned);
+    }
+
+    STATS_STOP(timer, GE_MULTISCALARMULT);
+    return 0;
+}
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+#
+# Generates the fixed-base tables used by ge_scalarmult_base.
+#
+#     gen_base_table.py <window> <passes> > precomp_base_<size>.h
+#
+# base[i][j] = (j+1) * 2^(window*passes*i) * B, for the 2^(window-1) positive
+# multiples of every table position. See ge_scalarmult_base in ge.c.
+#
+#     gen_base_table.py --odd <window>
+#
+# Bi[i] = (2i+1) * B, the sliding window table of ge_double_scalarmult_vartime.
+
+import sys
+
+p = 2**255 - 19
+d = -121665 * pow(121666, p - 2, p) % p
+
+By = 4 * pow(5, p - 2, p) % p
+Bx = pow((By * By - 1) * pow(d * By * By + 1, p - 2, p), (p + 3) // 8, p)
+if (Bx * Bx - (By * By - 1) * pow(d * By * By + 1, p - 2, p)) % p != 0:
+    Bx = Bx * pow(2, (p - 1) // 4, p) % p
+if Bx & 1:
+    Bx = p - Bx
+
+
+def add(P, Q):
+    x1, y1 = P
+    x2, y2 = Q
+    t = d * x1 * x2 * y1 * y2 % p
+    x3 = (x1 * y2 + x2 * y1) * pow(1 + t, p - 2, p) % p
+    y3 = (y1 * y2 + x1 * x2) * pow(1 - t, p - 2, p) % p
+    return x3, y3
+
+
+# radix 2^25.5 limbs centered around zero, like the ref10 tables
+def limbs(v):
+    out = []
+    carry = 0
+    for i in range(10):
+        bits = 26 if i % 2 == 0 else 25
+        l = (v & ((1 << bits) - 1)) + carry
+        v >>= bits
+        carry = 1 if l >= 1 << (bits - 1) else 0
+        out.append(l - (carry << bits))
+    out[0] += 19 * carry
+    return out
+
+
+def fe_const(v):
+    return "FE_CONST(" + ", ".join(str(l) for l in limbs(v)) + ")"
+
+
+def print_precomp(indent, P):
+    x, y = P
+    print(indent + "{")
+    print(indent + "    %s," % fe_const((y + x) % p))
+    print(indent + "    %s," % fe_const((y - x) % p))
+    print(indent + "    %s," % fe_const(2 * d * x * y % p))
+    print(indent + "},")
+
+
+def print_base(window, passes):
+    digits = (256 + window - 1) // window
+    positions = (digits + passes - 1) // passes
+    entries = 1 << (window - 1)
+
+    print("/* generated by gen_base_table.py %d %d */" % (window, passes))
+    print("")
+    print("/* base[i][j] = (j+1)*2^(%d*i)*B */" % (window * passes))
+    print("static const ge_precomp base[%d][%d] BASE_TABLE_ALIGN = {" % (positions, entries))
+
+    P = (Bx, By)
+    for i in range(positions):
+        print("    {")
+        Q = P
+        for j in range(entries):
+            print_precomp("        ", Q)
+            Q = add(Q, P)
+        print("    },")
+        for _ in range(window * passes):
+            P = add(P, P)
+
+    print("};")
+
+
+def print_odd(window):
+    entries = 1 << (window - 2)
+    B2 = add((Bx, By), (Bx, By))
+
+    print("/* Bi[i] = (2i+1)*B, generated by gen_base_table.py --odd %d */" % window)
+    print("static const ge_precomp Bi[%d] = {" % entries)
+
+    Q = (Bx, By)
+    for i in range(entries):
+        print_precomp("    ", Q)
+        Q = add(Q, B2)
+
+    print("};")
+
+
+def main():
+    if sys.argv[1] == "--odd":
+        print_odd(int(sys.argv[2]))
+    else:
+        print_base(int(sys.argv[1]), int(sys.argv[2]))
+
+
+main()
@@ -1,23 +1,11 @@
 #include "kined25519.h"
 #include "fe.h"
+#include "stats.h"
 
-void ed25519_key_exchange(unsigned char *shared_secret, const unsigned char *public_key, const unsigned char *private_key) {
-    unsigned char e[32];
+/* clamped copy of the private scalar */
+static void clamp(unsigned char *e, const unsigned char *private_key) {
     unsigned int i;
-    
-    fe x1;
-    fe x2;
-    fe z2;
-    fe x3;
-    fe z3;
-    fe tmp0;
-    fe tmp1;
 
-    int pos;
-    unsigned int swap;
-    unsigned int b;
-
-    /* copy the private key and make sure it's valid */
     for (i = 0; i < 32; ++i) {
         e[i] = private_key[i];
     }
@@ -25,15 +13,18 @@ void ed25519_key_exchange(unsigned char *shared_secret, const unsigned char *pub
     e[0] &= 248;
     e[31] &= 63;
     e[31] |= 64;
+}
 
-    /* unpack the public key and convert edwards to montgomery */
-    /* due to CodesInChaos: montgomeryX = (edwardsY + 1)*inverse(1 - edwardsY) mod p */
-    fe_frombytes(x1, public_key);
-    fe_1(tmp1);
-    fe_add(tmp0, x1, tmp1);
-    fe_sub(tmp1, tmp1, x1);
-    fe_invert(tmp1, tmp1);
-    fe_mul(x1, tmp0, tmp1);
+/* Montgomery ladder, leaves e * x1 in projective form x2 / z2 */
+static void ladder(fe x2, fe z2, const fe x1, const unsigned char *e) {
+    fe x3;
+    fe z3;
+    fe tmp0;
+    fe tmp1;
+
+    int pos;
+    unsigned int swap;
+    unsigned int b;
 
     fe_1(x2);
     fe_0(z2);
@@ -72,8 +63,118 @@ void ed25519_key_exchange(unsigned char *shared_secret, const unsigned char *pub
 
     fe_cswap(x2, x3, swap);
     fe_cswap(z2, z3, swap);
+}
+
+void ed25519_key_exchange(unsigned char *shared_secret, const unsigned char *public_key, const unsigned char *private_key) {
+    unsigned char e[32];
+    
+    fe x1;
+    fe x2;
+    fe z2;
+    fe tmp0;
+    fe tmp1;
+
+    STATS_START(timer);
+
+    /* copy the private key and make sure it's valid */
+    clamp(e, private_key);
+
+    /* unpack the public key and convert edwards to montgomery */
+    /* due to CodesInChaos: montgomeryX = (edwardsY + 1)*inverse(1 - edwardsY) mod p */
+    fe_frombytes(x1, public_key);
+    fe_1(tmp1);
+    fe_add(tmp0, x1, tmp1);
+    fe_sub(tmp1, tmp1, x1);
+    fe_invert(tmp1, tmp1);
+    fe_mul(x1, tmp0, tmp1);
+
+    ladder(x2, z2, x1, e);
 
     fe_invert(z2, z2);
     fe_mul(x2, x2, z2);
     fe_tobytes(shared_secret, x2);
+    STATS_STOP(timer, KEY_EXCHANGE);
+}
+
+#define KEY_EXCHANGE_BATCH 64
+
+/*
+    Zero has no inverse and would zero the whole batched product, so zeros
+    are inverted as one and the result is cleared afterwards, matching
+    fe_invert(0) == 0 in ed25519_key_exchange.
+*/
+
+static void batch_invert_or_zero(fe *v, size_t n, fe *scratch) {
+    unsigned int nonzero[KEY_EXCHANGE_BATCH];
+    fe one;
+    fe zero;
+    size_t i;
+
+    fe_1(one);
+    fe_0(zero);
+
+    for (i = 0; i < n; ++i) {
+        nonzero[i] = (unsigned int) (fe_isnonzero(v[i]) != 0);
+        fe_cmov(v[i], one, nonzero[i] ^ 1);
+    }
+
+    fe_batch_invert(v, v, n, scratch);
+
+    for (i = 0; i < n; ++i) {
+        fe_cmov(v[i], zero, nonzero[i] ^ 1);
+    }
+}
+
+/*
+    Same as ed25519_key_exchange with one private key and count public keys.
+    The Edwards to Montgomery conversions share one field inversion, and so
+    do the final projective to affine conversions.
+    shared_secrets: count * 32 bytes, public_keys: count * 32
+*/
+
+void ed25519_key_exchange_batch(size_t count, unsigned char *shared_secrets, const unsigned char *public_keys, const unsigned char *private_key) {
+    fe num[KEY_EXCHANGE_BATCH];
+    fe den[KEY_EXCHANGE_BATCH];
+    fe scratch[KEY_EXCHANGE_BATCH];
+    unsigned char e[32];
+    fe x1;
+    fe x2;
+    fe one;
+    size_t n;
+    size_t i;
+
+    STATS_START(timer);
+    clamp(e, private_key);
+    fe_1(one);
+
+    for (; count > 0; count -= n) {
+        n = count < KEY_EXCHANGE_BATCH ? count : KEY_EXCHANGE_BATCH;
+
+        /* montgomeryX = (edwardsY + 1) / (1 - edwardsY) */
+        for (i = 0; i < n; ++i) {
+            fe_frombytes(x1, public_keys + 32 * i);
+            fe_add(num[i], x1, one);
+            fe_sub(den[i], one, x1);
+        }
+
+        batch_invert_or_zero(den, n, scratch);
+
+        /* num[i] / den[i] = x2 / z2 after the ladder */
+        for (i = 0; i < n; ++i) {
+            fe_mul(x1, num[i], den[i]);
+            ladder(num[i], den[i], x1, e);
+        }
+
+        batch_invert_or_zero(den, n, scratch);
+
+        for (i = 0; i < n; ++i) {
+            fe_mul(x2, num[i], den[i]);
+            fe_tobytes(shared_secrets + 32 * i, x2);
+        }
+
+        shared_secrets += 32 * n;
+        public_keys += 32 * n;
+    }
+
+    STATS_STOP(timer, KEY_EXCHANGE_BATCH);
 }
@@ -1,11 +1,13 @@
 #include "kined25519.h"
 #include "sha512.h"
 #include "ge.h"
+#include "stats.h"
 
 
 void ed25519_create_keypair(unsigned char *public_key, unsigned char *private_key, const unsigned char *seed) {
     ge_p3 A;
 
+    STATS_START(timer);
     sha512(seed, 32, private_key);
     private_key[0] &= 248;
     private_key[31] &= 63;
@@ -13,4 +15,45 @@ void ed25519_create_keypair(unsigned char *public_key, unsigned char *private_ke
 
     ge_scalarmult_base(&A, private_key);
     ge_p3_tobytes(public_key, &A);
+    STATS_STOP(timer, CREATE_KEYPAIR);
+}
+
+#define KEYPAIR_BATCH 64
+
+/*
+    Same as ed25519_create_keypair for count seeds. The public keys are
+    encoded together so they share one field inversion.
+    public_keys: count * 32 bytes, private_keys: count * 64, seeds: count * 32
+*/
+
+void ed25519_create_keypairs_batch(size_t count, unsigned char *public_keys, unsigned char *private_keys, const unsigned char *seeds) {
+    ge_p3 A[KEYPAIR_BATCH];
+    unsigned char *private_key;
+    size_t n;
+    size_t i;
+
+    STATS_START(timer);
+
+    for (; count > 0; count -= n) {
+        n = count < KEYPAIR_BATCH ? count : KEYPAIR_BATCH;
+
+        for (i = 0; i < n; ++i) {
+            private_key = private_keys + 64 * i;
+
+            sha512(seeds + 32 * i, 32, private_key);
+            private_key[0] &= 248;
+            private_key[31] &= 63;
+            private_key[31] |= 64;
+
+            ge_scalarmult_base(&A[i], private_key);
+        }
+
+        ge_p3_batch_tobytes(public_keys, A, n);
+
+        public_keys += 32 * n;
+        private_keys += 64 * n;
+        seeds += 32 * n;
+    }
+
+    STATS_STOP(timer, CREATE_KEYPAIRS_BATCH);
 }
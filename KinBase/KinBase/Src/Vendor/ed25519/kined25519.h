@@ -2,6 +2,7 @@
 #define KINED25519_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 #if defined(_WIN32)
     #if defined(ED25519_BUILD_DLL)
@@ -22,14 +23,150 @@ extern "C" {
 
 #ifndef ED25519_NO_SEED
 int ED25519_DECLSPEC ed25519_create_seed(unsigned char *seed);
+int ED25519_DECLSPEC ed25519_create_seeds(size_t count, unsigned char *seeds);
 #endif
 
 void ED25519_DECLSPEC ed25519_create_keypair(unsigned char *public_key, unsigned char *private_key, const unsigned char *seed);
+void ED25519_DECLSPEC ed25519_create_keypairs_batch(size_t count, unsigned char *public_keys, unsigned char *private_keys, const unsigned char *seeds);
 void ED25519_DECLSPEC ed25519_sign(unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key, const unsigned char *private_key);
 int ED25519_DECLSPEC ed25519_on_curve(const unsigned char *public_key);
 int ED25519_DECLSPEC ed25519_verify(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key);
+
+/*
+    Checks 8 (sB - hA - R) == 0 rather than sB - hA == R, which only accepts
+    more signatures when A or R has a small-order component. The per
+    signature results of ed25519_verify_batch match this check.
+*/
+int ED25519_DECLSPEC ed25519_verify_cofactored(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key);
+int ED25519_DECLSPEC ed25519_verify_batch(size_t count, const unsigned char *const *signatures, const unsigned char *const *messages, const size_t *message_lens, const unsigned char *const *public_keys, int *results);
+
+/* public key decompressed once, with a precomputed table for repeated verification */
+typedef struct ed25519_pubkey_ctx ed25519_pubkey_ctx;
+
+ed25519_pubkey_ctx ED25519_DECLSPEC *ed25519_pubkey_ctx_create(const unsigned char *public_key);
+void ED25519_DECLSPEC ed25519_pubkey_ctx_destroy(ed25519_pubkey_ctx *ctx);
+int ED25519_DECLSPEC ed25519_verify_prepared(const ed25519_pubkey_ctx *ctx, const unsigned char *signature, const unsigned char *message, size_t message_len);
+
+/* a message split into segments, hashed in order as if concatenated */
+typedef struct {
+    const unsigned char *data;
+    size_t len;
+} ed25519_iovec;
+
+void ED25519_DECLSPEC ed25519_sign_iov(unsigned char *signature, const ed25519_iovec *iov, size_t iovcnt, const unsigned char *public_key, const unsigned char *private_key);
+int ED25519_DECLSPEC ed25519_verify_iov(const unsigned char *signature, const ed25519_iovec *iov, size_t iovcnt, const unsigned char *public_key);
+
+/* key pair copied once, with the nonce hash state preloaded, for signing many messages */
+typedef struct ed25519_signer ed25519_signer;
+
+ed25519_signer ED25519_DECLSPEC *ed25519_signer_create(const unsigned char *public_key, const unsigned char *private_key);
+void ED25519_DECLSPEC ed25519_signer_destroy(ed25519_signer *signer);
+void ED25519_DECLSPEC ed25519_signer_sign(const ed25519_signer *signer, unsigned char *signature, const unsigned char *message, size_t message_len);
+void ED25519_DECLSPEC ed25519_signer_sign_iov(const ed25519_signer *signer, unsigned char *signature, const ed25519_iovec *iov, size_t iovcnt);
+
+/* one signature of ed25519_sign_batch, made with signer or, when it's NULL, the key pair */
+typedef struct {
+    unsigned char *signature;
+    const unsigned char *message;
+    size_t message_len;
+    const ed25519_signer *signer;
+    const unsigned char *public_key;
+    const unsigned char *private_key;
+} ed25519_sign_job;
+
+/* worker threads for ed25519_sign_batch, 0 uses one per online CPU */
+typedef struct ed25519_pool ed25519_pool;
+
+ed25519_pool ED25519_DECLSPEC *ed25519_pool_create(size_t threads);
+void ED25519_DECLSPEC ed25519_pool_destroy(ed25519_pool *pool);
+void ED25519_DECLSPEC ed25519_sign_batch(const ed25519_sign_job *jobs, size_t count, ed25519_pool *pool);
+
+/* SLIP-0010 derivation, ed25519 only has hardened children */
+#define ED25519_HD_HARDENED 0x80000000u
+#define ED25519_HD_MAX_DEPTH 32
+
+typedef struct {
+    unsigned char key[32]; /* seed for ed25519_create_keypair */
+    unsigned char chain_code[32];
+} ed25519_hd_node;
+
+void ED25519_DECLSPEC ed25519_hd_master(ed25519_hd_node *node, const unsigned char *seed, size_t seed_len);
+int ED25519_DECLSPEC ed25519_hd_derive_child(ed25519_hd_node *child, const ed25519_hd_node *parent, uint32_t index);
+int ED25519_DECLSPEC ed25519_hd_parse_path(uint32_t *indices, size_t max_depth, const char *path);
+int ED25519_DECLSPEC ed25519_hd_derive_path(ed25519_hd_node *node, const ed25519_hd_node *master, const char *path);
+int ED25519_DECLSPEC ed25519_hd_derive_range(unsigned char *public_keys, const ed25519_hd_node *parent, uint32_t start, size_t count, ed25519_pool *pool);
+
+/* master node plus recently derived nodes, keyed by path */
+typedef struct ed25519_hd_cache ed25519_hd_cache;
+
+ed25519_hd_cache ED25519_DECLSPEC *ed25519_hd_cache_create(const unsigned char *seed, size_t seed_len, size_t capacity);
+void ED25519_DECLSPEC ed25519_hd_cache_destroy(ed25519_hd_cache *cache);
+int ED25519_DECLSPEC ed25519_hd_cache_derive(ed25519_hd_cache *cache, ed25519_hd_node *node, const char *path);
+
+/* CPU features reported in ed25519_backends */
+#define ED25519_CPU_AVX2     (1u << 0)
+#define ED25519_CPU_BMI2     (1u << 1)
+#define ED25519_CPU_ADX      (1u << 2)
+#define ED25519_CPU_AVX512F  (1u << 3)
+#define ED25519_CPU_AVX512VL (1u << 4)
+#define ED25519_CPU_NEON     (1u << 5)
+
+/* kernels picked for this host on first use */
+typedef struct {
+    unsigned int cpu_features;
+    const char *field;    /* "fe51-bmi2", "fe51" or "fe10" */
+    const char *sha512;   /* "bmi2" or "generic" */
+    const char *sha512x4; /* "avx512vl", "avx2", "vector" or "scalar" */
+} ed25519_backends;
+
+void ED25519_DECLSPEC ed25519_get_backends(ed25519_backends *backends);
+
 void ED25519_DECLSPEC ed25519_add_scalar(unsigned char *public_key, unsigned char *private_key, const unsigned char *scalar);
 void ED25519_DECLSPEC ed25519_key_exchange(unsigned char *shared_secret, const unsigned char *public_key, const unsigned char *private_key);
+void ED25519_DECLSPEC ed25519_key_exchange_batch(size_t count, unsigned char *shared_secrets, const unsigned char *public_keys, const unsigned char *private_key);
+
+/*
+    Call counts and timer ticks per operation, summed over all threads.
+    Only collected when the library is built with ED25519_STATS, otherwise
+    ed25519_stats_read zeroes stats and returns -1.
+*/
+enum {
+    ED25519_STAT_FE_MUL,
+    ED25519_STAT_FE_SQ,
+    ED25519_STAT_FE_INVERT,
+    ED25519_STAT_GE_ADD,             /* ge_add, ge_sub */
+    ED25519_STAT_GE_MADD,            /* ge_madd, ge_msub */
+    ED25519_STAT_GE_DBL,
+    ED25519_STAT_GE_FROMBYTES,
+    ED25519_STAT_GE_SCALARMULT_BASE,
+    ED25519_STAT_GE_DOUBLE_SCALARMULT,
+    ED25519_STAT_GE_MULTISCALARMULT,
+    ED25519_STAT_SHA512_BLOCK,       /* one compression */
+    ED25519_STAT_SHA512X4_BLOCK,     /* one four-lane compression */
+    ED25519_STAT_CREATE_SEEDS,
+    ED25519_STAT_CREATE_KEYPAIR,
+    ED25519_STAT_CREATE_KEYPAIRS_BATCH,
+    ED25519_STAT_SIGN,               /* every signature, including signers and batches */
+    ED25519_STAT_SIGN_BATCH,
+    ED25519_STAT_VERIFY,
+    ED25519_STAT_VERIFY_PREPARED,
+    ED25519_STAT_VERIFY_BATCH,
+    ED25519_STAT_KEY_EXCHANGE,
+    ED25519_STAT_KEY_EXCHANGE_BATCH,
+    ED25519_STAT_ADD_SCALAR,
+    ED25519_STAT_HD_DERIVE,          /* every child, including ranges */
+    ED25519_STAT_HD_DERIVE_RANGE,
+    ED25519_STAT_COUNT
+};
+
+typedef struct {
+    uint64_t calls[ED25519_STAT_COUNT];
+    uint64_t ticks[ED25519_STAT_COUNT];
+} ed25519_stats;
+
+int ED25519_DECLSPEC ed25519_stats_read(ed25519_stats *stats);
+void ED25519_DECLSPEC ed25519_stats_reset(void);
+const char ED25519_DECLSPEC *ed25519_stat_name(int stat);
 
 
 #ifdef __cplusplus
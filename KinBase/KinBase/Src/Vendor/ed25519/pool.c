@@ -0,0 +1,307 @@
+#include <stdlib.h>
+
+#include "pool.h"
+
+/*
+    A fixed pool of worker threads for batch operations.
+
+    The caller of pool_run works alongside the pool. Every participant
+    starts with an even share of the tasks as a range packed into one
+    atomic word, (begin << 32) | end. The owner takes tasks one at a time
+    from the front of its range; a participant whose range runs dry steals
+    the back half of another's with a single compare-and-swap. Nothing is
+    allocated after ed25519_pool_create.
+
+    Without threads (_WIN32, or ED25519_NO_THREADS) ed25519_pool_create
+    returns NULL and tasks run on the calling thread.
+*/
+
+#if !defined(_WIN32) && !defined(ED25519_NO_THREADS)
+#define POOL_THREADS
+#endif
+
+#ifdef POOL_THREADS
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <unistd.h>
+#endif
+
+static void run_serial(size_t count, pool_task task, void *ctx) {
+    size_t i;
+
+    for (i = 0; i < count; ++i) {
+        task(ctx, i);
+    }
+}
+
+#ifdef POOL_THREADS
+
+#define ROUND_MAX 0x7fffffffu /* tasks per round, so range bounds fit 32 bits */
+#define CACHE_LINE 64
+
+typedef struct {
+    _Atomic uint64_t range;
+    unsigned char pad[CACHE_LINE - sizeof(uint64_t)];
+} task_range;
+
+typedef struct {
+    pthread_t thread;
+    ed25519_pool *pool;
+    size_t index;
+} worker;
+
+struct ed25519_pool {
+    pthread_mutex_t batch; /* one run at a time */
+    pthread_mutex_t lock;  /* guards everything below */
+    pthread_cond_t wake;
+    pthread_cond_t done;
+    unsigned long generation;
+    size_t pending;
+    int shutdown;
+
+    pool_task task;
+    void *ctx;
+    size_t offset;       /* of this round within the whole run */
+    size_t participants; /* workers + the caller */
+    task_range *ranges;   /* [0] belongs to the caller */
+    worker *workers;
+};
+
+static uint64_t pack(uint64_t begin, uint64_t end) {
+    return (begin << 32) | end;
+}
+
+static int take(task_range *r, size_t *index) {
+    uint64_t v = atomic_load_explicit(&r->range, memory_order_acquire);
+    uint64_t begin, end;
+
+    for (;;) {
+        begin = v >> 32;
+        end = v & 0xffffffffu;
+
+        if (begin >= end) {
+            return 0;
+        }
+
+        if (atomic_compare_exchange_weak_explicit(&r->range, &v, pack(begin + 1, end), memory_order_acq_rel, memory_order_acquire)) {
+            *index = (size_t) begin;
+            return 1;
+        }
+    }
+}
+
+/* moves the back half of some other participant's range into ours */
+static int steal(ed25519_pool *pool, size_t self) {
+    uint64_t v, begin, end, mid;
+    task_range *victim;
+    size_t k;
+
+    for (k = 1; k < pool->participants; ++k) {
+        victim = &pool->ranges[(self + k) % pool->participants];
+        v = atomic_load_explicit(&victim->range, memory_order_acquire);
+
+        for (;;) {
+            begin = v >> 32;
+            end = v & 0xffffffffu;
+
+            if (begin >= end) {
+                break;
+            }
+
+            mid = begin + (end - begin) / 2;
+
+            if (atomic_compare_exchange_weak_explicit(&victim->range, &v, pack(begin, mid), memory_order_acq_rel, memory_order_acquire)) {
+                atomic_store_explicit(&pool->ranges[self].range, pack(mid, end), memory_order_release);
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static void run_tasks(ed25519_pool *pool, size_t self) {
+    size_t index;
+
+    do {
+        while (take(&pool->ranges[self], &index)) {
+            pool->task(pool->ctx, pool->offset + index);
+        }
+    } while (steal(pool, self));
+}
+
+static void *worker_main(void *arg) {
+    worker *w = (worker *) arg;
+    ed25519_pool *pool = w->pool;
+    unsigned long seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+
+    for (;;) {
+        while (!pool->shutdown && pool->generation == seen) {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+
+        if (pool->shutdown) {
+            break;
+        }
+
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        run_tasks(pool, w->index);
+
+        pthread_mutex_lock(&pool->lock);
+
+        if (--pool->pending == 0) {
+            pthread_cond_signal(&pool->done);
+        }
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+static void stop_workers(ed25519_pool *pool, size_t started) {
+    size_t i;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (i = 0; i < started; ++i) {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+}
+
+static void free_pool(ed25519_pool *pool) {
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_mutex_destroy(&pool->batch);
+    free(pool->workers);
+    free(pool->ranges);
+    free(pool);
+}
+
+ed25519_pool *ed25519_pool_create(size_t threads) {
+    ed25519_pool *pool;
+    long online;
+    size_t i;
+
+    if (threads == 0) {
+        online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = online > 0 ? (size_t) online : 1;
+    }
+
+    pool = (ed25519_pool *) calloc(1, sizeof(ed25519_pool));
+
+    if (pool == NULL) {
+        return NULL;
+    }
+
+    pool->participants = threads;
+    pool->ranges = (task_range *) calloc(threads, sizeof(task_range));
+    pool->workers = (worker *) calloc(threads, sizeof(worker));
+
+    pthread_mutex_init(&pool->batch, NULL);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    if (pool->ranges == NULL || pool->workers == NULL) {
+        free_pool(pool);
+        return NULL;
+    }
+
+    /* the caller is participant 0, so one thread fewer is started */
+    for (i = 0; i + 1 < threads; ++i) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i + 1;
+
+        if (pthread_create(&pool->workers[i].thread, NULL, worker_main, &pool->workers[i]) != 0) {
+            stop_workers(pool, i);
+            free_pool(pool);
+            return NULL;
+        }
+    }
+
+    return pool;
+}
+
+void ed25519_pool_destroy(ed25519_pool *pool) {
+    if (pool == NULL) {
+        return;
+    }
+
+    stop_workers(pool, pool->participants - 1);
+    free_pool(pool);
+}
+
+static void run_round(ed25519_pool *pool, size_t offset, size_t count) {
+    size_t n = pool->participants;
+    size_t i;
+
+    pool->offset = offset;
+
+    for (i = 0; i < n; ++i) {
+        atomic_store_explicit(&pool->ranges[i].range, pack(count * i / n, count * (i + 1) / n), memory_order_relaxed);
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->pending = n - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    run_tasks(pool, 0);
+
+    pthread_mutex_lock(&pool->lock);
+
+    while (pool->pending != 0) {
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void pool_run(ed25519_pool *pool, size_t count, pool_task task, void *ctx) {
+    size_t offset;
+    size_t round;
+
+    if (pool == NULL || pool->participants < 2 || count < 2) {
+        run_serial(count, task, ctx);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->batch);
+    pool->task = task;
+    pool->ctx = ctx;
+
+    for (offset = 0; offset < count; offset += round) {
+        round = count - offset < ROUND_MAX ? count - offset : ROUND_MAX;
+        run_round(pool, offset, round);
+    }
+
+    pthread_mutex_unlock(&pool->batch);
+}
+
+#else
+
+ed25519_pool *ed25519_pool_create(size_t threads) {
+    (void) threads;
+    return NULL;
+}
+
+void ed25519_pool_destroy(ed25519_pool *pool) {
+    (void) pool;
+}
+
+void pool_run(ed25519_pool *pool, size_t count, pool_task task, void *ctx) {
+    (void) pool;
+    run_serial(count, task, ctx);
+}
+
+#endif
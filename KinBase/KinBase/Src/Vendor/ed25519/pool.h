@@ -0,0 +1,16 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include "kined25519.h"
+
+typedef void (*pool_task)(void *ctx, size_t index);
+
+/*
+    Calls task(ctx, i) once for every i in [0, count), spread over the
+    threads of pool and the calling thread. Returns when all calls are done.
+    A NULL pool runs the tasks in order on the calling thread.
+*/
+
+void pool_run(ed25519_pool *pool, size_t count, pool_task task, void *ctx);
+
+#endif
@@ -0,0 +1,2693 @@
+/* generated by gen_base_table.py 4 1 */
+
+/* base[i][j] = (j+1)*2^(4*i)*B */
+static const ge_precomp base[64][8] BASE_TABLE_ALIGN = {
+    {
+        {
+            FE_CONST(25967493, -14356035, 29566456, 3660896, -12694345, 4014787, 27544626, -11754271, -6079156, 2047605),
+            FE_CONST(-12545711, 934262, -2722910, 3049990, -727428, 9406986, 12720692, 5043384, 19500929, -15469378),
+            FE_CONST(-8738181, 4489570, 9688441, -14785194, 10184609, -12363380, 29287919, 11864899, -24514362, -4438546),
+        },
+        {
+            FE_CONST(-12815894, -12976347, -21581243, 11784320, -25355658, -2750717, -11717903, -3814571, -358445, -10211303),
+            FE_CONST(-21703237, 6903825, 27185491, 6451973, -29577724, -9554005, -15616551, 11189268, -26829678, -5319081),
+            FE_CONST(26966642, 11152617, 32442495, 15396054, 14353839, -12752335, -3128826, -9541118, -15472047, -4166697),
+        },
+        {
+            FE_CONST(15636291, -9688557, 24204773, -7912398, 616977, -16685262, 27787600, -14772189, 28944400, -1550024),
+            FE_CONST(16568933, 4717097, -11556148, -1102322, 15682896, -11807043, 16354577, -11775962, 7689662, 11199574),
+            FE_CONST(30464156, -5976125, -11779434, -15670865, 23220365, 15915852, 7512774, 10017326, -17749093, -9920357),
+        },
+        {
+            FE_CONST(-17036878, 13921892, 10945806, -6033431, 27105052, -16084379, -28926210, 15006023, 3284568, -6276540),
+            FE_CONST(23599295, -8306047, -11193664, -7687416, 13236774, 10506355, 7464579, 9656445, 13059162, 10374397),
+            FE_CONST(7798556, 16710257, 3033922, 2874086, 28997861, 2835604, 32406664, -3839045, -641708, -101325),
+        },
+        {
+            FE_CONST(10861363, 11473154, 27284546, 1981175, -30064349, 12577861, 32867885, 14515107, -15438304, 10819380),
+            FE_CONST(4708026, 6336745, 20377586, 9066809, -11272109, 6594696, -25653668, 12483688, -12668491, 5581306),
+            FE_CONST(19563160, 16186464, -29386857, 4097519, 10237984, -4348115, 28542350, 13850243, -23678021, -15815942),
+        },
+        {
+            FE_CONST(-15371964, -12862754, 32573250, 4720197, -26436522, 5875511, -19188627, -15224819, -9818940, -12085777),
+            FE_CONST(-8549212, 109983, 15149363, 2178705, 22900618, 4543417, 3044240, -15689887, 1762328, 14866737),
+            FE_CONST(-18199695, -15951423, -10473290, 1707278, -17185920, 3916101, -28236412, 3959421, 27914454, 4383652),
+        },
+        {
+            FE_CONST(5153746, 9909285, 1723747, -2777874, 30523605, 5516873, 19480852, 5230134, -23952439, -15175766),
+            FE_CONST(-30269007, -3463509, 7665486, 10083793, 28475525, 1649722, 20654025, 16520125, 30598449, 7715701),
+            FE_CONST(28881845, 14381568, 9657904, 3680757, -20181635, 7843316, -31400660, 1370708, 29794553, -1409300),
+        },
+        {
+            FE_CONST(14499471, -2729599, -33191113, -4254652, 28494862, 14271267, 30290735, 10876454, -33154098, 2381726),
+            FE_CONST(-7195431, -2655363, -14730155, 462251, -27724326, 3941372, -6236617, 3696005, -32300832, 15351955),
+            FE_CONST(27431194, 8222322, 16448760, -3907995, -18707002, 11938355, -32961401, -2970515, 29551813, 10109425),
+        },
+    },
+    {
+        {
+            FE_CONST(26223094, -12506805, -817594, -6574538, -18413955, 13765386, 18686369, -3396849, -7690672, 5303412),
+            FE_CONST(20852230, 1340053, -15306791, 6107716, -23311853, 8966632, -17691495, -15696681, -20600407, -13383612),
+            FE_CONST(-24458581, -6348954, 15021041, 7419977, 24989846, 1575285, -1464843, 14432789, -30182382, 8836379),
+        },
+        {
+            FE_CONST(25502114, 10391924, -26826463, -4050907, -26716962, 3269111, 7668966, -13852660, -8419601, -520106),
+            FE_CONST(-24607933, -125399, 27759914, 11704479, -13092015, -4246277, -31528997, 7225004, -27484501, 2725107),
+            FE_CONST(-27564026, 11085236, -17642282, 12970677, -175541, 5844177, -25815899, -6927864, -28278469, -10902258),
+        },
+        {
+            FE_CONST(28030621, 12483271, -25195826, -5406909, -18234667, -6891922, -33047916, 5155062, 24723735, 13276372),
+            FE_CONST(-27129960, 3588874, -22456573, 13304690, 24473799, 11062727, 24979328, 5931312, 13919550, 6259887),
+            FE_CONST(-10189769, -7263816, -279947, 13385854, 29420949, -12969307, -23945129, 9247089, -8854330, 2360016),
+        },
+        {
+            FE_CONST(1486148, 257970, 33324453, 14599991, 21718373, 12985333, -7620229, -14188035, 11555299, -15970292),
+            FE_CONST(-6462181, -12130342, 6177105, -16246374, -8117458, 9121956, 16433140, 14850752, 11457245, 14449899),
+            FE_CONST(-1000256, 6079, 25942700, -9008072, -29696963, 8709793, -3663384, 13501444, -31660106, -13571732),
+        },
+        {
+            FE_CONST(20816112, 1931570, 19511135, -12874295, -18560501, 13026401, -14689286, 3158043, -2185620, -4741347),
+            FE_CONST(12122792, 2690359, 8480807, -1350476, -31706150, -8656851, 4373013, 11230151, -14211542, -916169),
+            FE_CONST(5110021, 4273512, 5925105, 5605386, -1315143, -10679911, 5648811, 2137817, 1243403, -9785047),
+        },
+        {
+            FE_CONST(25121076, 8602287, 29936647, -6877539, -33413339, -6767260, -20407100, 4635621, 19352480, 7360883),
+            FE_CONST(-20371192, -3368241, 3938506, 1520415, 22365898, 1723267, 26933925, -15185683, -1996297, 7239312),
+            FE_CONST(32757571, 923933, -12720547, -8693969, 14249519, 5990430, 18635548, 12333130, 1140694, 9249959),
+        },
+        {
+            FE_CONST(17407970, -15257465, -16996093, 9855303, 18142982, 2391553, -2035036, 8245277, -12340585, -14058334),
+            FE_CONST(7843323, -8705304, -15486198, -9908390, 14745055, -11217004, -30032107, -11577090, -5326908, -10019347),
+            FE_CONST(-27472011, -9057975, 25934454, 889001, -29071154, -16189314, 30398126, -3704042, -21726816, -4450942),
+        },
+        {
+            FE_CONST(18572438, 13390462, -1291416, -13971098, -21571726, -14145612, 21104946, -15003393, 18527392, -8247942),
+            FE_CONST(-8672907, -5790586, 22819840, 15232814, -27083876, -8187835, -27833833, -10942465, -18512588, -3852411),
+            FE_CONST(16280619, -12797117, -352962, 9451951, -19811304, 12151784, -19903486, 5076884, -16935204, -3175527),
+        },
+    },
+    {
+        {
+            FE_CONST(-13657040, -13155431, -31283750, 11777098, 21447386, 6519384, -2378284, -1627556, 10092783, -4764171),
+            FE_CONST(27939166, 14210322, 4677035, 16277044, -22964462, -12398139, -32508754, 12005538, -17810127, 12803510),
+            FE_CONST(17228999, -15661624, -1233527, 300140, -1224870, -11714777, 30364213, -9038194, 18016357, 4397660),
+        },
+        {
+            FE_CONST(-10958843, -7690207, 4776341, -14954238, 27850028, -15602212, -26619106, 14544525, -17477504, 982639),
+            FE_CONST(29253598, 15796703, -2863982, -9908884, 10057023, 3163536, 7332899, -4120128, -21047696, 9934963),
+            FE_CONST(5793303, 16271923, -24131614, -10116404, 29188560, 1206517, -14747930, 4559895, -30123922, -10897950),
+        },
+        {
+            FE_CONST(-27643952, -11493006, 16282657, -11036493, 28414021, -15012264, 24191034, 4541697, -13338309, 5500568),
+            FE_CONST(12650548, -1497113, 9052871, 11355358, -17680037, -8400164, -17430592, 12264343, 10874051, 13524335),
+            FE_CONST(25556948, -3045990, 714651, 2510400, 23394682, -10415330, 33119038, 5080568, -22528059, 5376628),
+        },
+        {
+            FE_CONST(-26088264, -4011052, -17013699, -3537628, -6726793, 1920897, -22321305, -9447443, 4535768, 1569007),
+            FE_CONST(-2255422, 14606630, -21692440, -8039818, 28430649, 8775819, -30494562, 3044290, 31848280, 12543772),
+            FE_CONST(-22028579, 2943893, -31857513, 6777306, 13784462, -4292203, -27377195, -2062731, 7718482, 14474653),
+        },
+        {
+            FE_CONST(2385315, 2454213, -22631320, 46603, -4437935, -15680415, 656965, -7236665, 24316168, -5253567),
+            FE_CONST(13741529, 10911568, -33233417, -8603737, -20177830, -1033297, 33040651, -13424532, -20729456, 8321686),
+            FE_CONST(21060490, -2212744, 15712757, -4336099, 1639040, 10656336, 23845965, -11874838, -9984458, 608372),
+        },
+        {
+            FE_CONST(-13672732, -15087586, -10889693, -7557059, -6036909, 11305547, 1123968, -6780577, 27229399, 23887),
+            FE_CONST(-23244140, -294205, -11744728, 14712571, -29465699, -2029617, 12797024, -6440308, -1633405, 16678954),
+            FE_CONST(-29500620, 4770662, -16054387, 14001338, 7830047, 9564805, -1508144, -4795045, -17169265, 4904953),
+        },
+        {
+            FE_CONST(24059557, 14617003, 19037157, -15039908, 19766093, -14906429, 5169211, 16191880, 2128236, -4326833),
+            FE_CONST(-16981152, 4124966, -8540610, -10653797, 30336522, -14105247, -29806336, 916033, -6882542, -2986532),
+            FE_CONST(-22630907, 12419372, -7134229, -7473371, -16478904, 16739175, 285431, 2763829, 15736322, 4143876),
+        },
+        {
+            FE_CONST(2379352, 11839345, -4110402, -5988665, 11274298, 794957, 212801, -14594663, 23527084, -16458268),
+            FE_CONST(33431127, -11130478, -17838966, -15626900, 8909499, 8376530, -32625340, 4087881, -15188911, -14416214),
+            FE_CONST(1767683, 7197987, -13205226, -2022635, -13091350, 448826, 5799055, 4357868, -4774191, -16323038),
+        },
+    },
+    {
+        {
+            FE_CONST(-29755419, 6305835, -22834437, 1218102, 14106849, -3320406, 33180036, 7098280, 16480428, -10816293),
+            FE_CONST(-25409045, -2090218, -3321267, 6706121, 1684499, -3393205, -5561614, -6662956, 6948745, -9283878),
+            FE_CONST(18131284, -12160957, -11401895, -5986896, -5516845, -492965, -4079275, 1219798, -15173186, 3647927),
+        },
+        {
+            FE_CONST(-22513286, 12246326, -18464073, -7350751, 33281396, 9110981, 1027358, -6331104, 7679661, 2842418),
+            FE_CONST(-12261954, -5253859, 6370637, 4487386, -9942686, -11121872, -1484289, 3910609, 8734779, -9653790),
+            FE_CONST(20187343, -12265314, -5076413, 1625266, -5489572, 4035687, 31030596, -7400186, -25735164, 2419199),
+        },
+        {
+            FE_CONST(11080345, 5771544, -25438435, 2341831, 33357664, -7709139, 989408, 10996986, 7088054, -1307096),
+            FE_CONST(-32057391, 2062735, -27657054, 14997402, -24256513, 747392, -18904030, 8416795, 26888753, -5729108),
+            FE_CONST(-9858810, 4617589, -12692517, -2172298, 21515963, 12161333, 7668390, -3483423, -581023, -10257578),
+        },
+        {
+            FE_CONST(-15739746, -11220585, 19995470, -7561731, -31096311, -2785751, 23370033, 2652913, -19683896, -1586607),
+            FE_CONST(21052810, -1610886, 13610781, 11319631, -3579929, -8738841, 29919090, 7572283, 29080032, -5602195),
+            FE_CONST(-20410884, 9161070, 2962171, -11180144, 9727648, -11619100, -30948360, -4939465, 29083304, -638292),
+        },
+        {
+            FE_CONST(-21773417, -1508058, 10896193, 12876401, 4668072, -9102352, -28546348, -15462477, 32835806, 6796376),
+            FE_CONST(-16684034, -14049046, 23966554, 7312936, -29277827, 14955947, 8826854, -864916, 4594064, 6718517),
+            FE_CONST(-2300195, 9123234, 32090817, 2372390, 33346979, 8403512, 16034065, 8360168, -15362715, -14618773),
+        },
+        {
+            FE_CONST(14319862, -2932051, -255270, 3129732, -32956167, 7314853, 2700503, 15679648, 17420152, 7455050),
+            FE_CONST(-13305271, 247074, -23322801, -8277974, 4308014, -1898563, 3913714, 2081858, 10346090, 13245188),
+            FE_CONST(-11626284, -6326110, 25953886, -11678736, 5442956, 6333322, 15626037, -16250128, -22370389, 8779608),
+        },
+        {
+            FE_CONST(-24375608, -3674512, 5263740, -3729328, 191392, -9678996, 30183127, 12667180, -18489489, 1840682),
+            FE_CONST(9313987, -969719, -1420361, -16094298, -8267168, 5645141, 21859230, -13851699, 33002917, -90360),
+            FE_CONST(-13502849, 12628279, -10126019, 4752872, -4941834, 6086069, 626606, -8795943, 20581562, 13551728),
+        },
+        {
+            FE_CONST(-18641829, -1151976, -25627818, 7354577, -16878411, -13424373, -13158667, 14873054, 24830217, 7401132),
+            FE_CONST(8228420, -5980670, 8316609, -4287605, -2919655, -1418908, -26013645, 1778869, -18502634, -6918179),
+            FE_CONST(-3491920, 11306418, 7963539, -6275618, 32872270, 4872405, -31217624, -13497777, -21941853, 2607490),
+        },
+    },
+    {
+        {
+            FE_CONST(6721966, 13833823, -23523388, -1551314, 26354293, -11863321, 23365147, -3949732, 7390890, 2759800),
+            FE_CONST(4409041, 2052381, 23373853, 10530217, 7676779, -12885954, 21302353, -4264057, 1244380, -12919645),
+            FE_CONST(-4421239, 7169619, 4982368, -2957590, 30256825, -2777540, 14086413, 9208236, 15886429, 16489664),
+        },
+        {
+            FE_CONST(1996075, 10375649, 14346367, 13311202, -6874135, -16438411, -13693198, 398369, -30606455, -712933),
+            FE_CONST(-25307465, 9795880, -2777414, 14878809, -33531835, 14780363, 13348553, 12076947, -30836462, 5113182),
+            FE_CONST(-17770784, 11797796, 31950843, 13929123, -25888302, 12288344, -30341101, -7336386, 13847711, 5387222),
+        },
+        {
+            FE_CONST(-18582163, -3416217, 17824843, -2340966, 22744343, -10442611, 8763061, 3617786, -19600662, 10370991),
+            FE_CONST(20246567, -14369378, 22358229, -543712, 18507283, -10413996, 14554437, -8746092, 32232924, 16763880),
+            FE_CONST(9648505, 10094563, 26416693, 14745928, -30374318, -6472621, 11094161, 15689506, 3140038, -16510092),
+        },
+        {
+            FE_CONST(-16160072, 5472695, 31895588, 4744994, 8823515, 10365685, -27224800, 9448613, -28774454, 366295),
+            FE_CONST(19153450, 11523972, -11096490, -6503142, -24647631, 5420647, 28344573, 8041113, 719605, 11671788),
+            FE_CONST(8678025, 2694440, -6808014, 2517372, 4964326, 11152271, -15432916, -15266516, 27000813, -10195553),
+        },
+        {
+            FE_CONST(-15157904, 7134312, 8639287, -2814877, -7235688, 10421742, 564065, 5336097, 6750977, -14521026),
+            FE_CONST(11836410, -3979488, 26297894, 16080799, 23455045, 15735944, 1695823, -8819122, 8169720, 16220347),
+            FE_CONST(-18115838, 8653647, 17578566, -6092619, -8025777, -16012763, -11144307, -2627664, -5990708, -14166033),
+        },
+        {
+            FE_CONST(-23308498, -10968312, 15213228, -10081214, -30853605, -11050004, 27884329, 2847284, 2655861, 1738395),
+            FE_CONST(-27537433, -14253021, -25336301, -8002780, -9370762, 8129821, 21651608, -3239336, -19087449, -11005278),
+            FE_CONST(1533110, 3437855, 23735889, 459276, 29970501, 11335377, 26030092, 5821408, 10478196, 8544890),
+        },
+        {
+            FE_CONST(32173121, -16129311, 24896207, 3921497, 22579056, -3410854, 19270449, 12217473, 17789017, -3395995),
+            FE_CONST(-30552961, -2228401, -15578829, -10147201, 13243889, 517024, 15479401, -3853233, 30460520, 1052596),
+            FE_CONST(-11614875, 13323618, 32618793, 8175907, -15230173, 12596687, 27491595, -4612359, 3179268, -9478891),
+        },
+        {
+            FE_CONST(31947069, -14366651, -4640583, -15339921, -15125977, -6039709, -14756777, -16411740, 19072640, -9511060),
+            FE_CONST(11685058, 11822410, 3158003, -13952594, 33402194, -4165066, 5977896, -5215017, 473099, 5040608),
+            FE_CONST(-20290863, 8198642, -27410132, 11602123, 1290375, -2799760, 28326862, 1721092, -19558642, -3131606),
+        },
+    },
+    {
+        {
+            FE_CONST(19274469, -5125445, 2025249, 13387528, -26551745, -13237864, 8572282, -5701955, -7605577, 3755890),
+            FE_CONST(-1003765, -3998347, -29431273, 5708148, 20949970, -10765004, 2582995, 4041757, 28570893, 242978),
+            FE_CONST(24217466, 683998, 12990241, -14980929, 24711442, 2582675, -18704628, -10573407, 27632805, 10325174),
+        },
+        {
+            FE_CONST(-1376293, 10581090, 17601840, -2177403, -23669777, 2515960, 7946113, 5265099, -30565938, 15659181),
+            FE_CONST(11690190, -256939, -28435932, 7575499, -10373362, 8175929, -1669485, -6706172, -29188463, 11378246),
+            FE_CONST(3934827, -895850, 14579491, -4161754, 26542055, 14629900, -19665954, 12702562, -9783987, -15825989),
+        },
+        {
+            FE_CONST(-7905285, -7567146, 24242009, -9981986, -10005548, 2864673, -12432996, -290370, -32192614, -12380245),
+            FE_CONST(21648538, 5875995, -25737427, 5595486, -2079098, 2667116, -30134869, -9286435, 2742570, -4025892),
+            FE_CONST(-17630385, -4775178, -17556574, -12786114, 22223083, 9281306, 25269654, 16741825, 7733910, -4295804),
+        },
+        {
+            FE_CONST(18931912, -5979763, 8372851, -1816752, 17694526, -3581508, -27130390, -2408709, 18843966, -5880493),
+            FE_CONST(31572541, 1387635, -27527774, 1197914, -15555676, 13484267, -12740138, 13093864, 20957081, -3614436),
+            FE_CONST(11695417, -11068051, -11229652, -9956937, -13423087, 6286991, 6574490, -8543138, -31992930, -3252886),
+        },
+        {
+            FE_CONST(4406854, -203587, 23268839, -16188749, 3696359, -3025310, -2374384, -14048190, 25835549, 14199049),
+            FE_CONST(-9053661, 9666137, 17702016, 13681030, 31673492, -7546596, 25994291, 7426565, 11705204, -499004),
+            FE_CONST(-9704638, 7750859, 4780558, -9879028, 3972007, -1273251, 9397471, 6020439, 9390255, -13657745),
+        },
+        {
+            FE_CONST(-4038073, 4122774, 15819690, -2689661, 32461321, 5475061, 7223123, 15194198, 6509018, -10905669),
+            FE_CONST(-9539544, 2095849, 29789961, 61126, 24968268, -13581175, -2582874, -12225942, 13866993, 1421457),
+            FE_CONST(-4214256, -4717999, 22567784, 3736576, 19253254, -4356505, 28225722, -14220075, 2798085, 8570919),
+        },
+        {
+            FE_CONST(-21155172, -14003898, 8717306, -11400688, 17970583, 10837346, 31185163, -6616264, 6612499, -14261069),
+            FE_CONST(8368990, -7533904, -5084524, 4262330, 745608, 13759847, -15288234, 15767429, -2114388, -1422552),
+            FE_CONST(16253406, -12125540, 5328056, 520783, 7323359, -5067190, 25388761, -12503796, 13788611, 15592195),
+        },
+        {
+            FE_CONST(-18007641, -11299895, -22979045, 15904833, -24466524, -2430858, 14251255, -13476220, 30848991, 13037900),
+            FE_CONST(113900, 16486627, 15167557, -13760546, 21770965, -6995991, 13113953, -1349366, -31585887, 10056458),
+            FE_CONST(25229681, -12266646, 5569512, 8982737, 32063203, -5581096, -1437669, 4966335, 13017505, 11031479),
+        },
+    },
+    {
+        {
+            FE_CONST(7881532, 10687937, 7578723, 7738378, -18951012, -2553952, 21820786, 8076149, -27868496, 11538389),
+            FE_CONST(-19935666, 3899861, 18283497, -6801568, -15728660, -11249211, 8754525, 7446702, -5676054, 5797016),
+            FE_CONST(-11295600, -3793569, -15782110, -7964573, 12708869, -8456199, 2014099, -9050574, -2369172, -5877341),
+        },
+        {
+            FE_CONST(-22472376, -11568741, -27682020, 1146375, 18956691, 16640559, 1192730, -3714199, 15123619, 10811505),
+            FE_CONST(14352098, -3419715, -18942044, 10822655, 32750596, 4699007, -70363, 15776356, -28886779, -11974553),
+            FE_CONST(-28241164, -8072475, -4978962, -5315317, 29416931, 1847569, -20654173, -16484855, 4714547, -9600655),
+        },
+        {
+            FE_CONST(15200332, 8368572, 19679101, 15970074, -31872674, 1959451, 24611599, -4543832, -11745876, 12340220),
+            FE_CONST(12876937, -10480056, 33134381, 6590940, -6307776, 14872440, 9613953, 8241152, 15370987, 9608631),
+            FE_CONST(-4143277, -12014408, 8446281, -391603, 4407738, 13629032, -7724868, 15866074, -28210621, -8814099),
+        },
+        {
+            FE_CONST(26660628, -15677655, 8393734, 358047, -7401291, 992988, -23904233, 858697, 20571223, 8420556),
+            FE_CONST(14620715, 13067227, -15447274, 8264467, 14106269, 15080814, 33531827, 12516406, -21574435, -12476749),
+            FE_CONST(236881, 10476226, 57258, -14677024, 6472998, 2466984, 17258519, 7256740, 8791136, 15069930),
+        },
+        {
+            FE_CONST(1276410, -9371918, 22949635, -16322807, -23493039, -5702186, 14711875, 4874229, -30663140, -2331391),
+            FE_CONST(5855666, 4990204, -13711848, 7294284, -7804282, 1924647, -1423175, -7912378, -33069337, 9234253),
+            FE_CONST(20590503, -9018988, 31529744, -7352666, -2706834, 10650548, 31559055, -11609587, 18979186, 13396066),
+        },
+        {
+            FE_CONST(24474287, 4968103, 22267082, 4407354, 24063882, -8325180, -18816887, 13594782, 33514650, 7021958),
+            FE_CONST(-11566906, -6565505, -21365085, 15928892, -26158305, 4315421, -25948728, -3916677, -21480480, 12868082),
+            FE_CONST(-28635013, 13504661, 19988037, -2132761, 21078225, 6443208, -21446107, 2244500, -12455797, -8089383),
+        },
+        {
+            FE_CONST(-30595528, 13793479, -5852820, 319136, -25723172, -6263899, 33086546, 8957937, -15233648, 5540521),
+            FE_CONST(-11630176, -11503902, -8119500, -7643073, 2620056, 1022908, -23710744, -1568984, -16128528, -14962807),
+            FE_CONST(23152971, 775386, 27395463, 14006635, -9701118, 4649512, 1689819, 892185, -11513277, -15205948),
+        },
+        {
+            FE_CONST(9770129, 9586738, 26496094, 4324120, 1556511, -3550024, 27453819, 4763127, -19179614, 5867134),
+            FE_CONST(-32765025, 1927590, 31726409, -4753295, 23962434, -16019500, 27846559, 5931263, -29749703, -16108455),
+            FE_CONST(27461885, -2977536, 22380810, 1815854, -23033753, -3031938, 7283490, -15148073, -19526700, 7734629),
+        },
+    },
+    {
+        {
+            FE_CONST(-7747423, 9283212, 16885577, 15459439, 25972200, 15573013, -33536708, 522134, -27572165, 11723471),
+            FE_CONST(2772043, 16117691, 1948422, 1594977, 11683210, 14644609, 19125577, -11518681, -30198843, -4147809),
+            FE_CONST(-14970719, -16387341, -14039331, -11274100, 13553527, 6014471, 8651844, 4302826, 944768, 9457783),
+        },
+        {
+            FE_CONST(25367933, 9925423, 1217074, 10032740, 15893633, -7285020, -21001184, 13591837, 15590119, 6888531),
+            FE_CONST(-1053008, -3203632, -15488193, 5115517, -19937346, 3036256, -16932496, 9411692, 11827739, -10643384),
+            FE_CONST(11974674, 3048430, -771228, -4998519, -19084529, -1036918, 27844685, 12465445, -19625526, -12787241),
+        },
+        {
+            FE_CONST(-25956653, -12255812, 24522558, -9746296, -23652022, 230925, 9724355, -12665711, 7329542, -3626927),
+            FE_CONST(20097826, -14840878, -8161024, -4621726, 32179128, 11048424, 27972941, 1059821, 14340256, 14287005),
+            FE_CONST(13600812, -9962902, 20158995, 8659885, -12409259, 11574470, -32794224, 1224150, 4403633, -7718084),
+        },
+        {
+            FE_CONST(7654660, 7028247, -28691608, 540979, -19280698, -5394104, 9795209, 8516409, 13848267, -1499300),
+            FE_CONST(30465487, -13875670, 357144, -6273628, -4648327, 10924293, 4789084, 2863329, 27548793, -6193966),
+            FE_CONST(4433141, 3224307, -2806764, 5354430, 31289755, -461331, 22067864, -4713425, 2154528, 4684644),
+        },
+        {
+            FE_CONST(-1403958, -1741809, 24799460, 10590365, 1395551, -8503429, 28864881, -8546382, 31138022, -1292228),
+            FE_CONST(-17832188, -6421901, 26054946, -9496460, -31678298, 11448778, -26652215, 6547852, 18183957, 6621583),
+            FE_CONST(-28299910, 12504930, -26590470, 2262325, -19557535, 972638, 11625555, 13979573, 28514419, 213985),
+        },
+        {
+            FE_CONST(24519105, -11597889, -29444913, -12967244, 27722451, -5096431, -5686781, 16364260, 8723084, 14806813),
+            FE_CONST(-8616707, 12913566, 807665, 3681606, -3143279, -1699128, 23760372, -12159793, 23694807, 12446998),
+            FE_CONST(-28137048, 5428051, 6680625, 9942468, -21535496, 1824313, -20798373, 14263050, 29191327, 16544139),
+        },
+        {
+            FE_CONST(9398608, -11563003, -11646986, -15947939, 1349980, 5197359, -18481524, 3237354, -14923730, -16662985),
+            FE_CONST(26283058, -3686364, 2459090, -16384105, -23888576, 9598009, -13957769, -14726119, -340227, -7544671),
+            FE_CONST(-15130889, 12798752, -20048948, 909824, 20905484, 16479172, -20502723, -741616, 29265753, -12361483),
+        },
+        {
+            FE_CONST(13874816, -13376467, 30152726, -13956199, -23325064, 13021371, -24134600, 14450792, 13790612, -10418809),
+            FE_CONST(18487466, 935344, -33484627, -8443849, 11904660, 6601985, -7750533, 16303926, -15507119, -6926203),
+            FE_CONST(-19759966, 11298845, 14718846, 13623030, -16980751, 6469663, -19011727, 11615538, 11731611, 768756),
+        },
+    },
+    {
+        {
+            FE_CONST(-8010264, -9590817, -11120403, 6196038, 29344158, -13430885, 7585295, -3176626, 18549497, 15302069),
+            FE_CONST(-32658337, -6171222, -7672793, -11051681, 6258878, 13504381, 10458790, -6418461, -8872242, 8424746),
+            FE_CONST(24687205, 8613276, -30667046, -3233545, 1863892, -1830544, 19206234, 7134917, -11284482, -828919),
+        },
+        {
+            FE_CONST(11334899, -9218022, 8025293, 12707519, 17523892, -10476071, 10243738, -14685461, -5066034, 16498837),
+            FE_CONST(8911542, 6887158, -9584260, -6958590, 11145641, -9543680, 17303925, -14124238, 6536641, 10543906),
+            FE_CONST(-28946384, 15479763, -17466835, 568876, -1497683, 11223454, -2669190, -16625574, -27235709, 8876771),
+        },
+        {
+            FE_CONST(-25742899, -12566864, -15649966, -846607, -33026686, -796288, -33481822, 15824474, -604426, -9039817),
+            FE_CONST(10330056, 70051, 7957388, -9002667, 9764902, 15609756, 27698697, -4890037, 1657394, 3084098),
+            FE_CONST(10477963, -7470260, 12119566, -13250805, 29016247, -5365589, 31280319, 14396151, -30233575, 15272409),
+        },
+        {
+            FE_CONST(-12288309, 3169463, 28813183, 16658753, 25116432, -5630466, -25173957, -12636138, -25014757, 1950504),
+            FE_CONST(-26180358, 9489187, 11053416, -14746161, -31053720, 5825630, -8384306, -8767532, 15341279, 8373727),
+            FE_CONST(28685821, 7759505, -14378516, -12002860, -31971820, 4079242, 298136, -10232602, -2878207, 15190420),
+        },
+        {
+            FE_CONST(-32932876, 13806336, -14337485, -15794431, -24004620, 10940928, 8669718, 2742393, -26033313, -6875003),
+            FE_CONST(-1580388, -11729417, -25979658, -11445023, -17411874, -10912854, 9291594, -16247779, -12154742, 6048605),
+            FE_CONST(-30305315, 14843444, 1539301, 11864366, 20201677, 1900163, 13934231, 5128323, 11213262, 9168384),
+        },
+        {
+            FE_CONST(-26280513, 11007847, 19408960, -940758, -18592965, -4328580, -5088060, -11105150, 20470157, -16398701),
+            FE_CONST(-23136053, 9282192, 14855179, -15390078, -7362815, -14408560, -22783952, 14461608, 14042978, 5230683),
+            FE_CONST(29969567, -2741594, -16711867, -8552442, 9175486, -2468974, 21556951, 3506042, -5933891, -12449708),
+        },
+        {
+            FE_CONST(-3144746, 8744661, 19704003, 4581278, -20430686, 6830683, -21284170, 8971513, -28539189, 15326563),
+            FE_CONST(-19464629, 10110288, -17262528, -3503892, -23500387, 1355669, -15523050, 15300988, -20514118, 9168260),
+            FE_CONST(-5353335, 4488613, -23803248, 16314347, 7780487, -15638939, -28948358, 9601605, 33087103, -9011387),
+        },
+        {
+            FE_CONST(-19443170, -15512900, -20797467, -12445323, -29824447, 10229461, -27444329, -15000531, -5996870, 15664672),
+            FE_CONST(23294591, -16632613, -22650781, -8470978, 27844204, 11461195, 13099750, -2460356, 18151676, 13417686),
+            FE_CONST(-24722913, -4176517, -31150679, 5988919, -26858785, 6685065, 1661597, -12551441, 15271676, -15452665),
+        },
+    },
+    {
+        {
+            FE_CONST(-20258635, -7120467, 11453541, -6332845, 32959413, 13781704, -10523784, 10616930, -7375307, 11149822),
+            FE_CONST(4536597, -7124298, 27508502, 7816921, 29384726, -2965218, 30191588, -11586218, -30257971, -11614795),
+            FE_CONST(77135, 15628759, -27441852, 9328400, 3300633, -10653494, -15124044, 8300023, 12084288, 3054740),
+        },
+        {
+            FE_CONST(-17273444, 14034146, 11836332, -4781612, 25536070, 11173207, 8964775, -4233782, 25146892, 13305965),
+            FE_CONST(-23305164, -12173503, 31479650, -15972020, -17779631, -14348649, -232634, 3747945, -25152809, -1147712),
+            FE_CONST(27133824, 586572, -21447921, 805820, -4254913, 701432, -25327283, 7219467, 1516428, 4919925),
+        },
+        {
+            FE_CONST(-8809150, 15205857, 29876534, 8214191, 25802562, -9431905, 6190966, 10041152, 6949444, 5277385),
+            FE_CONST(-1558679, 2968832, 24781098, 15495403, 8788080, -16587504, 23862282, -11100668, 12990749, 9708672),
+            FE_CONST(2402247, -15817821, -2184875, 444291, 1247189, -12666404, 19858950, -6523465, 4491850, 11195713),
+        },
+        {
+            FE_CONST(6109965, -1369913, 26057601, -7352580, 23168326, -9182544, 3992655, 2862676, 15421102, -3405869),
+            FE_CONST(-15770113, 9030044, 17073626, 718504, -27225159, 6870038, 32915018, 4714511, -31763938, -4043028),
+            FE_CONST(-26071999, 7984758, -28087167, 8099324, -23473273, 2221418, 17986974, -10193023, 19196845, 14943647),
+        },
+        {
+            FE_CONST(-17690082, 12669673, 20380407, -9074644, -7674053, -4133441, 6120570, -9623555, -10022611, -13437694),
+            FE_CONST(-30064868, -10252561, 7087359, 7207762, 19996121, 5645904, 31617719, 9156087, -26563046, 2059452),
+            FE_CONST(29720969, 995338, -5496468, 1238411, 23470990, 15773069, -16119314, 5301623, -20495997, -1164366),
+        },
+        {
+            FE_CONST(3697542, -4629441, 26797664, 971220, -9819131, 9864026, -96924, -16076052, -31780053, -4480985),
+            FE_CONST(13794499, 9444875, 16235673, -14688437, -9705715, 13901471, 32089413, -3557805, 24520430, -3537902),
+            FE_CONST(16614970, -13710209, 18395785, 5370482, 12553636, 8976933, 14955496, -14296187, -7530701, 5174393),
+        },
+        {
+            FE_CONST(33211681, -1215545, 9045064, -7636310, 13201557, -7243860, 30174131, 9936993, -10159990, 8077411),
+            FE_CONST(23153096, 13841946, 22477413, 12324549, -6986529, 1190805, 26252247, -13237895, 16454666, -16277057),
+            FE_CONST(173763, 3663982, -8739130, 3806570, -31441379, 12952789, 8828535, 12263775, -6062884, -3037038),
+        },
+        {
+            FE_CONST(14238208, -13232994, -16224806, 2003324, 8999610, -4207177, 23598910, 10246308, 18611982, -6260531),
+            FE_CONST(-8676618, 7221067, -9815386, -5652509, 20976677, -7121811, -1600797, -1498010, 21150529, 8555924),
+            FE_CONST(-16560296, -13801631, 31420781, -7275248, 12463560, 6639844, -28685603, 15035685, 14966100, -11633690),
+        },
+    },
+    {
+        {
+            FE_CONST(11433042, -13228665, 8239631, -5279517, -1985436, -725718, -18698764, 2167544, -6921301, -13440182),
+            FE_CONST(-31436171, 15575146, 30436815, 12192228, -22463353, 9395379, -9917708, -8638997, 12215110, 12028277),
+            FE_CONST(14098400, 6555944, 23007258, 5757252, -15427832, -12950502, 30123440, 4617780, -16900089, -655628),
+        },
+        {
+            FE_CONST(-4026201, -15240835, 11893168, 13718664, -14809462, 1847385, -15819999, 10154009, 23973261, -12684474),
+            FE_CONST(-26531820, -3695990, -1908898, 2534301, -31870557, -16550355, 18341390, -11419951, 32013174, -10103539),
+            FE_CONST(-25479301, 10876443, -11771086, -14625140, -12369567, 1838104, 21911214, 6354752, 4425632, -837822),
+        },
+        {
+            FE_CONST(-10433389, -14612966, 22229858, -3091047, -13191166, 776729, -17415375, -12020462, 4725005, 14044970),
+            FE_CONST(19268650, -7304421, 1555349, 8692754, -21474059, -9910664, 6347390, -1411784, -19522291, -16109756),
+            FE_CONST(-24864089, 12986008, -10898878, -5558584, -11312371, -148526, 19541418, 8180106, 9282262, 10282508),
+        },
+        {
+            FE_CONST(-26205082, 4428547, -8661196, -13194263, 4098402, -14165257, 15522535, 8372215, 5542595, -10702683),
+            FE_CONST(-10562541, 14895633, 26814552, -16673850, -17480754, -2489360, -2781891, 6993761, -18093885, 10114655),
+            FE_CONST(-20107055, -929418, 31422704, 10427861, -7110749, 6150669, -29091755, -11529146, 25953725, -106158),
+        },
+        {
+            FE_CONST(-4234397, -8039292, -9119125, 3046000, 2101609, -12607294, 19390020, 6094296, -3315279, 12831125),
+            FE_CONST(-15998678, 7578152, 5310217, 14408357, -33548620, -224739, 31575954, 6326196, 7381791, -2421839),
+            FE_CONST(-20902779, 3296811, 24736065, -16328389, 18374254, 7318640, 6295303, 8082724, -15362489, 12339664),
+        },
+        {
+            FE_CONST(27724736, 2291157, 6088201, -14184798, 1792727, 5857634, 13848414, 15768922, 25091167, 14856294),
+            FE_CONST(-18866652, 8331043, 24373479, 8541013, -701998, -9269457, 12927300, -12695493, -22182473, -9012899),
+            FE_CONST(-11423429, -5421590, 11632845, 3405020, 30536730, -11674039, -27260765, 13866390, 30146206, 9142070),
+        },
+        {
+            FE_CONST(3924129, -15307516, -13817122, -10054960, 12291820, -668366, -27702774, 9326384, -8237858, 4171294),
+            FE_CONST(-15921940, 16037937, 6713787, 16606682, -21612135, 2790944, 26396185, 3731949, 345228, -5462949),
+            FE_CONST(-21327538, 13448259, 25284571, 1143661, 20614966, -8849387, 2031539, -12391231, -16253183, -13582083),
+        },
+        {
+            FE_CONST(31016211, -16722429, 26371392, -14451233, -5027349, 14854137, 17477601, 3842657, 28012650, -16405420),
+            FE_CONST(-5075835, 9368966, -8562079, -4600902, -15249953, 6970560, -9189873, 16292057, -8867157, 3507940),
+            FE_CONST(29439664, 3537914, 23333589, 6997794, -17555561, -11018068, -15209202, -15051267, -9164929, 6580396),
+        },
+    },
+    {
+        {
+            FE_CONST(-2057689, -13794612, -24133317, -8462964, -15854653, 11926895, 24462524, -10400996, -8692214, -12157994),
+            FE_CONST(-9483899, 153323, 31677098, 14319101, 1299253, 816448, -15243115, 5297074, 4923922, 11471160),
+            FE_CONST(19188924, 16119364, -32390388, 2999380, 32178693, -9424395, -21396285, -10705542, -18306160, -7811606),
+        },
+        {
+            FE_CONST(-12971386, 13407111, -26731979, -7600085, 6443508, -7595666, -20270123, -3340436, -27786526, -98287),
+            FE_CONST(-16790999, -4431934, 2967930, 14371159, -8905849, -11582799, 28841649, 5898474, -12207839, -8552185),
+            FE_CONST(-24369384, 12934401, -20983894, -11610004, -33503754, -7565858, -2722696, -13433312, -4494273, -362586),
+        },
+        {
+            FE_CONST(-28491536, -13657943, -24904191, 8921751, -18343578, 10764853, -30445391, 14544953, 25829926, -13442905),
+            FE_CONST(-26901066, 2465512, 24265387, -16464052, -27318668, 11775406, -7713353, -6340074, -24163015, -16228224),
+            FE_CONST(-4692332, -13983486, -22584392, 16013620, 2128896, 298625, -1624766, 4556699, -30150049, -1917882),
+        },
+        {
+            FE_CONST(23409055, 7340959, 29156936, 15107907, -6620265, -4158425, 26665342, -4693455, -25180668, -6278125),
+            FE_CONST(-11486532, -4524797, 25022595, -13549308, 5513673, -4078739, -28846115, -5524381, -20106536, 3415915),
+            FE_CONST(22717419, 9458330, 31735608, 6303028, -9793359, -7104961, -32388032, 10252174, 19973013, 8665651),
+        },
+        {
+            FE_CONST(-103367, 3954766, 10159466, 12760864, -8123661, 5644140, 7905446, -7200170, 9241231, -12139025),
+            FE_CONST(10951705, 8420484, -33278584, -8937986, 27891587, -13225225, 23178781, 15226760, -15178256, -10769865),
+            FE_CONST(-11316967, -8465676, 18096127, -3213176, -2989450, 3908390, -25873715, 14571456, 18304282, 6456444),
+        },
+        {
+            FE_CONST(-25534676, -7391563, 14352251, -1813240, -4178157, 6595633, 28183879, -3102081, -28261981, 1288880),
+            FE_CONST(-9717207, 14510800, 17156110, 12896498, -25489701, -10513686, 475507, -10734791, -9457471, 12709967),
+            FE_CONST(-7686662, -12318605, -31628145, 4907649, -1012463, 5640354, -13058649, -6640668, 25962257, -15505028),
+        },
+        {
+            FE_CONST(30993119, -4220190, 13906475, 9376137, -6627759, -12260529, -30282595, 7722927, -10000608, -3568176),
+            FE_CONST(28847816, -13543428, 30031976, -9828123, -20616306, -283436, 5967048, 12842824, -32165144, -2475148),
+            FE_CONST(-8456547, -9265989, -10191775, 16484183, 26784716, 12868456, 1277658, -6839522, 4939055, -12260018),
+        },
+        {
+            FE_CONST(-17609474, -4152861, -19543099, 5098039, -29348848, 12420371, 24509421, -1037150, -23559591, -7903522),
+            FE_CONST(-14051170, -15163342, 12298459, 8559429, 19812335, -9020791, -6307607, 4484220, -28599798, 13843190),
+            FE_CONST(28825950, -9845550, -24587047, 12656477, -24129723, -12040139, -8525508, 2482307, -17643768, -5811846),
+        },
+    },
+    {
+        {
+            FE_CONST(-12185861, -7679788, 16438269, 10826160, -8696817, -6235611, 17860444, -9273846, -2095802, 9304567),
+            FE_CONST(20714564, -4336911, 29088195, 7406487, 11426967, -5095705, 14792667, -14608617, 5289421, -477127),
+            FE_CONST(-16665533, -10650790, -6160345, -13305760, 9192020, -1802462, 17271490, 12349094, 26939669, -3752294),
+        },
+        {
+            FE_CONST(-12889898, 9373458, 31595848, 16374215, 21471720, 13221525, -27283495, -12348559, -3698806, 117887),
+            FE_CONST(22263325, -6560050, 3984570, -11174646, -15114008, -566785, 28311253, 5358056, -23319780, 541964),
+            FE_CONST(16259219, 3261970, 2309254, -15534474, -16885711, -4581916, 24134070, -16705829, -13337066, -13552195),
+        },
+        {
+            FE_CONST(9378160, -13140186, -22845982, -12745264, 28198281, -7244098, -2399684, -717351, 690426, 14876244),
+            FE_CONST(24977353, -314384, -8223969, -13465086, 28432343, -1176353, -13068804, -12297348, -22380984, 6618999),
+            FE_CONST(-1538174, 11685646, 12944378, 13682314, -24389511, -14413193, 8044829, -13817328, 32239829, -5652762),
+        },
+        {
+            FE_CONST(-18603066, 4762990, -926250, 8885304, -28412480, -3187315, 9781647, -10350059, 32779359, 5095274),
+            FE_CONST(-33008130, -5214506, -32264887, -3685216, 9460461, -9327423, -24601656, 14506724, 21639561, -2630236),
+            FE_CONST(-16400943, -13112215, 25239338, 15531969, 3987758, -4499318, -1289502, -6863535, 17874574, 558605),
+        },
+        {
+            FE_CONST(-13600129, 10240081, 9171883, 16131053, -20869254, 9599700, 33499487, 5080151, 2085892, 5119761),
+            FE_CONST(-22205145, -2519528, -16381601, 414691, -25019550, 2170430, 30634760, -8363614, -31999993, -5759884),
+            FE_CONST(-6845704, 15791202, 8550074, -1312654, 29928809, -12092256, 27534430, -7192145, -22351378, 12961482),
+        },
+        {
+            FE_CONST(-24492060, -9570771, 10368194, 11582341, -23397293, -2245287, 16533930, 8206996, -30194652, -5159638),
+            FE_CONST(-11121496, -3382234, 2307366, 6362031, -135455, 8868177, -16835630, 7031275, 7589640, 8945490),
+            FE_CONST(-32152748, 8917967, 6661220, -11677616, -1192060, -15793393, 7251489, -11182180, 24099109, -14456170),
+        },
+        {
+            FE_CONST(5019558, -7907470, 4244127, -14714356, -26933272, 6453165, -19118182, -13289025, -6231896, -10280736),
+            FE_CONST(10853594, 10721687, 26480089, 5861829, -22995819, 1972175, -1866647, -10557898, -3363451, -6441124),
+            FE_CONST(-17002408, 5906790, 221599, -6563147, 7828208, -13248918, 24362661, -2008168, -13866408, 7421392),
+        },
+        {
+            FE_CONST(8139927, -6546497, 32257646, -5890546, 30375719, 1886181, -21175108, 15441252, 28826358, -4123029),
+            FE_CONST(6267086, 9695052, 7709135, -16603597, -32869068, -1886135, 14795160, -7840124, 13746021, -1742048),
+            FE_CONST(28584902, 7787108, -6732942, -15050729, 22846041, -7571236, -3181936, -363524, 4771362, -8419958),
+        },
+    },
+    {
+        {
+            FE_CONST(17912732, -16092699, -23476692, 3944828, -10517612, -7179213, 20648131, 3965321, 25469530, -3442254),
+            FE_CONST(17267796, 4369299, 20216911, -7939165, -30519798, 12392099, -15110587, -9548329, -20275099, -3661740),
+            FE_CONST(-9788656, 11359472, 29586899, -11795605, 1321283, -44743, 28967383, 3240535, -10200090, 938826),
+        },
+        {
+            FE_CONST(-30063177, 5835117, -28123481, -735266, 5676682, -9446010, -30843342, 10343790, -24897229, -1612201),
+            FE_CONST(25095668, -3632031, -25646677, 15666421, -7485125, -8818634, 10553094, 15233358, -9930050, 15528461),
+            FE_CONST(26598792, 10725764, 17168817, -12521779, -23850141, -10978889, -18530094, -11449726, -29909881, -8162213),
+        },
+        {
+            FE_CONST(20858827, 7716357, -20871520, 10528024, -18963043, -10644188, -9151709, -11451866, 1577263, -13006193),
+            FE_CONST(-8264340, 11670045, 5858996, -13190140, 23445499, -5786029, -4655634, 13678963, 1684698, -9952556),
+            FE_CONST(23771014, -13958892, -28853989, -16083794, 23423949, -16633663, -18277778, 3775198, -24631884, 2402240),
+        },
+        {
+            FE_CONST(22439197, 6073835, -18681498, -3015329, 352366, 5109476, 10943265, -16128583, 30589587, 12639673),
+            FE_CONST(-3083565, -8358797, -9442335, -8713834, 30259461, -7479673, 2234642, 10981484, -13673465, 7924042),
+            FE_CONST(22652335, 6515168, -25265582, 13236281, 28274803, 13460880, -4372059, 2427596, -20657332, -11572556),
+        },
+        {
+            FE_CONST(19725763, -11865887, 27358001, 11194039, 11732154, -10829189, 15818702, -2937313, 18322843, -12784080),
+            FE_CONST(13150166, -3213849, 20334997, 8011597, 20261326, 16121344, 33068193, 15359641, -6562832, 427264),
+            FE_CONST(-891886, -5082612, 16059063, 4783539, 7017123, -8942606, -2103306, 7854757, 27722026, 12635359),
+        },
+        {
+            FE_CONST(-19726895, -11586817, 1381102, 12172594, -13753842, -13317338, 396980, -5937666, 29854147, 10125267),
+            FE_CONST(1875343, -16217949, -25038165, -4664102, 518917, 5982423, -20399159, 6516690, 23468862, -11541835),
+            FE_CONST(9267085, 1044336, 23257472, -14944919, 20340927, 15041265, -13244711, -12019696, 18740243, 10858954),
+        },
+        {
+            FE_CONST(-21449314, 9208183, 4856822, -16367543, 18443179, 7494936, 31493197, 16398886, 2498321, 9215196),
+            FE_CONST(-2428009, 16222925, 9858848, 13520177, -12321768, -10797543, -23947861, 16257348, 29699595, 11384160),
+            FE_CONST(-29460071, -11471655, 6981537, 1446853, 27152467, 6395638, 33056313, -11053624, 33039455, -2041072),
+        },
+        {
+            FE_CONST(1151868, -12082912, -12248755, -9209951, -15023342, -12612269, 17683376, -12601632, 27176316, 4618238),
+            FE_CONST(32070292, 9778898, 28212468, 8406405, 21384023, 719879, 7526632, -1635932, 1232678, -9087008),
+            FE_CONST(11738445, 12055293, 17975421, -6256476, -15122178, 867096, -13344125, -10936354, -12725087, 13257295),
+        },
+    },
+    {
+        {
+            FE_CONST(24949256, 6376279, -27466481, -8174608, -18646154, -9930606, 33543569, -12141695, 3569627, 11342593),
+            FE_CONST(26514989, 4740088, 27912651, 3697550, 19331575, -11472339, 6809886, 4608608, 7325975, -14801071),
+            FE_CONST(-11618399, -14554430, -24321212, 7655128, -1369274, 5214312, -27400540, 10258390, -17646694, -8186692),
+        },
+        {
+            FE_CONST(11431204, 15823007, 26570245, 14329124, 18029990, 4796082, -31446179, 15580664, 9280358, -3973687),
+            FE_CONST(-160783, -10326257, -22855316, -4304997, -20861367, -13621002, -32810901, -11181622, -15545091, 4387441),
+            FE_CONST(-20799378, 12194512, 3937617, -5805892, -27154820, 9340370, -24513992, 8548137, 20617071, -7482001),
+        },
+        {
+            FE_CONST(-938825, -3930586, -8714311, 16124718, 24603125, -6225393, -13775352, -11875822, 24345683, 10325460),
+            FE_CONST(-19855277, -1568885, -22202708, 8714034, 14007766, 6928528, 16318175, -1010689, 4766743, 3552007),
+            FE_CONST(-21751364, -16730916, 1351763, -803421, -4009670, 3950935, 3217514, 14481909, 10988822, -3994762),
+        },
+        {
+            FE_CONST(15564307, -14311570, 3101243, 5684148, 30446780, -8051356, 12677127, -6505343, -8295852, 13296005),
+            FE_CONST(-9442290, 6624296, -30298964, -11913677, -4670981, -2057379, 31521204, 9614054, -30000824, 12074674),
+            FE_CONST(4771191, -135239, 14290749, -13089852, 27992298, 14998318, -1413936, -1556716, 29832613, -16391035),
+        },
+        {
+            FE_CONST(7064884, -7541174, -19161962, -5067537, -18891269, -2912736, 25825242, 5293297, -27122660, 13101590),
+            FE_CONST(-2298563, 2439670, -7466610, 1719965, -27267541, -16328445, 32512469, -5317593, -30356070, -4190957),
+            FE_CONST(-30006540, 10162316, -33180176, 3981723, -16482138, -13070044, 14413974, 9515896, 19568978, 9628812),
+        },
+        {
+            FE_CONST(33053803, 199357, 15894591, 1583059, 27380243, -4580435, -17838894, -6106839, -6291786, 3437740),
+            FE_CONST(-18978877, 3884493, 19469877, 12726490, 15913552, 13614290, -22961733, 70104, 7463304, 4176122),
+            FE_CONST(-27124001, 10659917, 11482427, -16070381, 12771467, -6635117, -32719404, -5322751, 24216882, 5944158),
+        },
+        {
+            FE_CONST(8894125, 7450974, -2664149, -9765752, -28080517, -12389115, 19345746, 14680796, 11632993, 5847885),
+            FE_CONST(26942781, -2315317, 9129564, -4906607, 26024105, 11769399, -11518837, 6367194, -9727230, 4782140),
+            FE_CONST(19916461, -4828410, -22910704, -11414391, 25606324, -5972441, 33253853, 8220911, 6358847, -1873857),
+        },
+        {
+            FE_CONST(801428, -2081702, 16569428, 11065167, 29875704, 96627, 7908388, -4480480, -13538503, 1387155),
+            FE_CONST(19646058, 5720633, -11416706, 12814209, 11607948, 12749789, 14147075, 15156355, -21866831, 11835260),
+            FE_CONST(19299512, 1155910, 28703737, 14890794, 2925026, 7269399, 26121523, 15467869, -26560550, 5052483),
+        },
+    },
+    {
+        {
+            FE_CONST(166991, -15976393, 15612707, -12414786, 3859799, 10068474, 15791766, 8882529, -13904217, -16113556),
+            FE_CONST(5878335, -11030369, 10377567, -1004952, -26821707, -12500491, -32589455, 1330441, 20157226, 5246228),
+            FE_CONST(-10703555, -5134677, 32878464, 10118550, -16188877, -13117789, -18307586, -12382964, 4281976, 2841433),
+        },
+        {
+            FE_CONST(-7176526, -14530030, 17755939, -8800171, 13593436, -15587581, -7176951, 11682802, -17650183, -11954511),
+            FE_CONST(24898741, 9496464, 5033731, 6719600, 19600974, 9612324, 29526147, 4615092, -30745039, 4637079),
+            FE_CONST(-16993447, -570329, -1406964, 2180914, -10106635, -10114385, 981040, -16698728, -5368639, -15756431),
+        },
+        {
+            FE_CONST(29542070, -2182933, -7168690, -4764788, -12344156, 4582134, 29160811, -8922022, 6050304, -14977506),
+            FE_CONST(20489514, 11664490, -27510910, -10908666, 18661539, -3332790, 2854782, -14555153, 2555760, -2911023),
+            FE_CONST(-10712936, 28558, 6884883, -5300244, 19667819, -14481644, 423572, -7844175, 16634613, 11281690),
+        },
+        {
+            FE_CONST(-16801750, -1762975, -22467725, 9434440, -9951831, -8933476, 27827120, -3222516, -32374318, 7290746),
+            FE_CONST(-16659543, -2982994, 20476665, 10859803, -32517917, 4205786, -15350323, -1086381, 17401998, -5907683),
+            FE_CONST(6969781, 9774089, -5109431, 16204799, -10945801, -14454277, 29242247, -2434264, 9253113, -5791284),
+        },
+        {
+            FE_CONST(-3669226, 3129507, 31416816, -6565690, 27965531, -13838685, -711700, -13280343, 9391828, -7974698),
+            FE_CONST(-27869520, 10677334, -8828821, -2983317, -1840345, -12009354, 20734475, 12867382, -9533141, 16434110),
+            FE_CONST(17014661, -6877276, -11191730, -1067110, -16537698, 420500, -12178760, -4473581, 8518315, 15782726),
+        },
+        {
+            FE_CONST(-7956, 12772300, 32978859, 8517266, 27953488, 6824388, -1319335, 7161177, 11931082, -8295195),
+            FE_CONST(10460864, -11872344, 17958900, -8539875, 7777518, 14231236, 30537017, 7189523, 18087307, 14485069),
+            FE_CONST(-23257390, 1423639, 20207261, -5020483, -4218590, 6221438, -26758641, -7211487, 29919858, 12403424),
+        },
+        {
+            FE_CONST(-2469315, -11851734, 4851051, -5102376, 13157069, 12165049, -27074990, -12296615, 9797749, -1265251),
+            FE_CONST(6820283, 9377919, 124462, 4395148, -26029759, -6727852, 10086820, -413999, -11524269, 13780629),
+            FE_CONST(-19755809, 5857808, -3720534, 9870103, 4940095, -13136305, -5936654, -3243695, 33015652, 13484),
+        },
+        {
+            FE_CONST(-23811906, -14818544, 25006789, 7818556, 2841551, -9159601, 23314567, -6712687, -10834224, -2520603),
+            FE_CONST(7162490, 8520820, -235608, 2918152, -17043438, -12026913, 6511583, -12247282, 23271856, -4675124),
+            FE_CONST(-19555662, 2820406, -33502507, -949064, -14455339, -11775334, -6229176, 2263280, 30370950, -10340844),
+        },
+    },
+    {
+        {
+            FE_CONST(-3017432, 10058206, 1980837, 3964243, 22160966, 12322533, -6431123, -12618185, 12228557, -7003677),
+            FE_CONST(32944382, 14922211, -22844894, 5188528, 21913450, -8719943, 4001465, 13238564, -6114803, 8653815),
+            FE_CONST(22865569, -4652735, 27603668, -12545395, 14348958, 8234005, 24808405, 5719875, 28483275, 2841751),
+        },
+        {
+            FE_CONST(-16420968, -1113305, -327719, -12107856, 21886282, -15552774, -1887966, -315658, 19932058, -12739203),
+            FE_CONST(-11656086, 10087521, -8864888, -5536143, -19278573, -3055912, 3999228, 13239134, -4777469, -13910208),
+            FE_CONST(1382174, -11694719, 17266790, 9194690, -13324356, 9720081, 20403944, 11284705, -14013818, 3093230),
+        },
+        {
+            FE_CONST(16650921, -11037932, -1064178, 1570629, -8329746, 7352753, -302424, 16271225, -24049421, -6691850),
+            FE_CONST(-21911077, -5927941, -4611316, -5560156, -31744103, -10785293, 24123614, 15193618, -21652117, -16739389),
+            FE_CONST(-9935934, -4289447, -25279823, 4372842, 2087473, 10399484, 31870908, 14690798, 17361620, 11864968),
+        },
+        {
+            FE_CONST(-11307610, 6210372, 13206574, 5806320, -29017692, -13967200, -12331205, -7486601, -25578460, -16240689),
+            FE_CONST(14668462, -12270235, 26039039, 15305210, 25515617, 4542480, 10453892, 6577524, 9145645, -6443880),
+            FE_CONST(5974874, 3053895, -9433049, -10385191, -31865124, 3225009, -7972642, 3936128, -5652273, -3050304),
+        },
+        {
+            FE_CONST(30625386, -4729400, -25555961, -12792866, -20484575, 7695099, 17097188, -16303496, -27999779, 1803632),
+            FE_CONST(-3553091, 9865099, -5228566, 4272701, -5673832, -16689700, 14911344, 12196514, -21405489, 7047412),
+            FE_CONST(20093277, 9920966, -11138194, -5343857, 13161587, 12044805, -32856851, 4124601, -32343828, -10257566),
+        },
+        {
+            FE_CONST(-20788824, 14084654, -13531713, 7842147, 19119038, -13822605, 4752377, -8714640, -21679658, 2288038),
+            FE_CONST(-26819236, -3283715, 29965059, 3039786, -14473765, 2540457, 29457502, 14625692, -24819617, 12570232),
+            FE_CONST(-1063558, -11551823, 16920318, 12494842, 1278292, -5869109, -21159943, -3498680, -11974704, 4724943),
+        },
+        {
+            FE_CONST(17960970, -11775534, -4140968, -9702530, -8876562, -1410617, -12907383, -8659932, -29576300, 1903856),
+            FE_CONST(23134274, -14279132, -10681997, -1611936, 20684485, 15770816, -12989750, 3190296, 26955097, 14109738),
+            FE_CONST(15308788, 5320727, -30113809, -14318877, 22902008, 7767164, 29425325, -11277562, 31960942, 11934971),
+        },
+        {
+            FE_CONST(-27395711, 8435796, 4109644, 12222639, -24627868, 14818669, 20638173, 4875028, 10491392, 1379718),
+            FE_CONST(-13159415, 9197841, 3875503, -8936108, -1383712, -5879801, 33518459, 16176658, 21432314, 12180697),
+            FE_CONST(-11787308, 11500838, 13787581, -13832590, -22430679, 10140205, 1465425, 12689540, -10301319, -13872883),
+        },
+    },
+    {
+        {
+            FE_CONST(-3837602, 13045718, 28443955, 15948611, -27578806, -14460236, -29347292, -252415, -28687142, 11603313),
+            FE_CONST(-14406401, 916949, -27375369, 6685201, 9811730, -2545467, 25034225, -8324028, 29022371, -14440283),
+            FE_CONST(16286546, -893152, 25911489, -3780305, 3806294, 2014063, -6126197, -16659809, 19533296, -1102562),
+        },
+        {
+            FE_CONST(5383362, -13359103, -14007394, 14372650, 30801004, 9041537, 29182249, 2690795, -33462474, 7189273),
+            FE_CONST(-3721620, -461813, -12849007, 2632908, 19840529, 11366335, -28594834, 14080560, 12447689, -10691972),
+            FE_CONST(23299755, 6701149, 1736245, -559789, 13956935, 10200200, -29845082, 6434963, -24888610, -7345734),
+        },
+        {
+            FE_CONST(-28614985, -9456779, 10429491, 6686314, 24709062, -3498274, 238113, -5440539, 26162616, 1842414),
+            FE_CONST(26722664, -16247591, 15809068, 312980, -25309744, 5749280, -9176935, -1932522, 27292487, 13656831),
+            FE_CONST(15020244, -15082733, -12674552, 3791600, 2986753, -5004514, -25705075, 5841100, -32165104, 12718938),
+        },
+        {
+            FE_CONST(-33349104, -12968546, -10808498, 8713650, 33524436, 13108626, -1419451, 4669469, -5523721, -3186258),
+            FE_CONST(-8099411, -5380176, -31015873, 2560818, 5636160, -9168869, 12687448, 15176521, 15747510, 15632705),
+            FE_CONST(28990153, 11360283, 28664170, 8248719, -22786756, -16472522, 11077326, 12281365, -13134018, -6271260),
+        },
+        {
+            FE_CONST(-15368644, -13462083, 18136627, -8194135, 5092566, -16410180, -25707578, 8240042, -17674365, -699957),
+            FE_CONST(-12507199, -13888243, -1789173, -3926048, 4289554, 1601359, 16514210, -14673047, -7607028, 6136737),
+            FE_CONST(-13378982, -1977492, -12633570, 15578906, 216825, 10284750, 21305294, 7030757, -7195356, -9147474),
+        },
+        {
+            FE_CONST(-31742072, -1053778, -23975, 16716574, -18794104, 8654288, -2956882, 13009257, 12372728, -389384),
+            FE_CONST(30237642, -6624058, 17252020, 9506435, 27013206, -11482442, -22336111, 5535246, 30475505, 8645734),
+            FE_CONST(26853683, -15762533, -259021, -9293731, -31965059, 15227278, 24684743, 12160374, 10472519, -2433654),
+        },
+        {
+            FE_CONST(-30490426, -8624043, 11380809, -7253077, 22421015, 10597312, 2953892, 1303465, 13457662, -8235397),
+            FE_CONST(23234298, 13840477, -22048989, 12499537, -9487540, 7519719, 26349813, -14864434, 9507613, 522337),
+            FE_CONST(15563273, -336150, -15497256, -2152428, 19396363, 1152040, 31927966, -1488739, 22800712, 14124973),
+        },
+        {
+            FE_CONST(-26424185, -10781027, -13852000, -951650, 15474996, 10668212, 24279721, 13459047, -6237183, -10048830),
+            FE_CONST(24350163, 12173425, -8529029, -5401735, -1631271, 15818485, 11878433, 10161213, 33224202, 15370052),
+            FE_CONST(-27349979, -12905691, -18411784, 2293916, 6365638, 11138129, -6185985, -12006553, 15502955, 6395806),
+        },
+    },
+    {
+        {
+            FE_CONST(5414091, -15386041, -21007664, 9643570, 12834970, 1186149, -2622916, -1342231, 26128231, 6032912),
+            FE_CONST(-26337395, -13766162, 32496025, -13653919, 17847801, -12669156, 3604025, 8316894, -25875034, -10437358),
+            FE_CONST(3296484, 6223048, 24680646, -12246460, -23052020, 5903205, -8862297, -4639164, 12376617, 3188849),
+        },
+        {
+            FE_CONST(29190488, -14659046, 27549113, -1183516, 3520066, -10697301, 32049515, -7309113, -16109234, -9852307),
+            FE_CONST(-14744486, -9309156, 735818, -598978, -20407687, -5057904, 25246078, -15795669, 18640741, -960977),
+            FE_CONST(-6928835, -16430795, 10361374, 5642961, 4910474, 12345252, -31638386, -494430, 10530747, 1053335),
+        },
+        {
+            FE_CONST(-29265967, -14186805, -13538216, -12117373, -19457059, -10655384, -31462369, -2948985, 24018831, 15026644),
+            FE_CONST(-22592535, -3145277, -2289276, 5953843, -13440189, 9425631, 25310643, 13003497, -2314791, -15145616),
+            FE_CONST(-27419985, -603321, -8043984, -1669117, -26092265, 13987819, -27297622, 187899, -23166419, -2531735),
+        },
+        {
+            FE_CONST(-21744398, -13810475, 1844840, 5021428, -10434399, -15911473, 9716667, 16266922, -5070217, 726099),
+            FE_CONST(29370922, -6053998, 7334071, -15342259, 9385287, 2247707, -13661962, -4839461, 30007388, -15823341),
+            FE_CONST(-936379, 16086691, 23751945, -543318, -1167538, -5189036, 9137109, 730663, 9835848, 4555336),
+        },
+        {
+            FE_CONST(-23376435, 1410446, -22253753, -12899614, 30867635, 15826977, 17693930, 544696, -11985298, 12422646),
+            FE_CONST(31117226, -12215734, -13502838, 6561947, -9876867, -12757670, -5118685, -4096706, 29120153, 13924425),
+            FE_CONST(-17400879, -14233209, 19675799, -2734756, -11006962, -5858820, -9383939, -11317700, 7240931, -237388),
+        },
+        {
+            FE_CONST(-31361739, -11346780, -15007447, -5856218, -22453340, -12152771, 1222336, 4389483, 3293637, -15551743),
+            FE_CONST(-16684801, -14444245, 11038544, 11054958, -13801175, -3338533, -24319580, 7733547, 12796905, -6335822),
+            FE_CONST(-8759414, -10817836, -25418864, 10783769, -30615557, -9746811, -28253339, 3647836, 3222231, -11160462),
+        },
+        {
+            FE_CONST(18606113, 1693100, -25448386, -15170272, 4112353, 10045021, 23603893, -2048234, -7550776, 2484985),
+            FE_CONST(9255317, -3131197, -12156162, -1004256, 13098013, -9214866, 16377220, -2102812, -19802075, -3034702),
+            FE_CONST(-22729289, 7496160, -5742199, 11329249, 19991973, -3347502, -31718148, 9936966, -30097688, -10618797),
+        },
+        {
+            FE_CONST(21878590, -5001297, 4338336, 13643897, -3036865, 13160960, 19708896, 5415497, -7360503, -4109293),
+            FE_CONST(27736861, 10103576, 12500508, 8502413, -3413016, -9633558, 10436918, -1550276, -23659143, -8132100),
+            FE_CONST(19492550, -12104365, -29681976, -852630, -3208171, 12403437, 30066266, 8367329, 13243957, 8709688),
+        },
+    },
+    {
+        {
+            FE_CONST(-31752550, -8452702, 9056473, 3887422, -2454335, -1493608, -13028399, -171987, 14026798, 1572583),
+            FE_CONST(27775746, 11317923, 17097773, 15519649, 14265191, -2278283, -27492312, -3385907, 28653834, -16717595),
+            FE_CONST(20930892, -88067, 26662083, -14115021, 25414360, -12285276, 6256602, 3300085, 5699050, -1530678),
+        },
+        {
+            FE_CONST(23302914, -15658466, -1730796, 10126900, 19633094, 1767878, 28234852, 196118, -11245455, 15155201),
+            FE_CONST(3008648, 7723116, 29614439, -617974, 24990778, 14788928, -3003375, -9227048, -2108344, 1321150),
+            FE_CONST(-28255369, -15807254, 24529008, 15586857, 28229536, -4730088, 10491543, 14278611, -20745542, 11365884),
+        },
+        {
+            FE_CONST(20629748, -15723688, 15045843, -10496833, 20984049, -3227120, 8546576, -14823192, -13082549, 7111039),
+            FE_CONST(-717073, -15536287, -15935880, 13395092, 21118002, 12052078, -5061660, -14997379, -29734918, 4053335),
+            FE_CONST(-28634308, -13939211, 18967230, -1375802, 17856594, 2912238, -12463893, -6959955, 29916687, 352087),
+        },
+        {
+            FE_CONST(-14764745, -6994634, 11694757, 716682, -6811806, -11671880, -26238841, -16121200, -13614211, -11907386),
+            FE_CONST(-11222704, -1321919, 23862869, 2970041, -10583355, -6040463, 14464259, 3040525, -19389344, -7036015),
+            FE_CONST(-3345863, 3678291, -9280390, 7081144, -28631785, -11264420, 12367405, -13692564, -15990240, -16608968),
+        },
+        {
+            FE_CONST(-3813227, 6001747, 610521, 13100340, -3656446, 2550366, -14760732, -10885913, 23425437, 15149273),
+            FE_CONST(-14620054, 1729108, 12786517, 9069328, -5746033, -15992641, 16672133, -6419456, -30849046, 14144417),
+            FE_CONST(-7882916, 1821660, 922346, -16770473, -15166789, 13848023, 2847189, 11658201, -32619506, 1403952),
+        },
+        {
+            FE_CONST(-22856267, 11014876, 14395810, 11475721, 23018800, 4512103, -28624137, -11169250, 13805958, -7132974),
+            FE_CONST(24337682, 6840162, -12702579, 11481878, -9585505, 3757698, 30512181, -1788935, 5056155, 14216704),
+            FE_CONST(12882240, 2328185, 30241579, 7398702, -4247315, 6002902, 24457341, -16570204, -21897653, -4091153),
+        },
+        {
+            FE_CONST(-28040919, 3151953, -9300910, -9046933, -3437813, 11271708, -30642757, 14154213, 31997282, 546283),
+            FE_CONST(-25754028, 7885911, 472867, 3830780, -22639733, -904950, -7174753, 15822501, -16072069, -2774579),
+            FE_CONST(-6683765, -5911929, -620599, -11274494, 12139418, 14398666, 19151799, 11300916, -24580912, 6967612),
+        },
+        {
+            FE_CONST(2319062, 2758214, -11045016, -4435351, -18449066, -8037897, 5903291, 7033251, -25898398, 10160192),
+            FE_CONST(17011570, 4670548, 14408373, -4403631, 12275167, -13210773, 16864895, -13454290, 29190402, 1884324),
+            FE_CONST(30155528, -12097542, -17855342, 13190891, 26931544, -14403119, 32936115, -9885446, -19997959, -14202425),
+        },
+    },
+    {
+        {
+            FE_CONST(12015105, 2801261, 28198131, 10151021, 24818120, -4743133, -11194191, -5645734, 5150968, 7274186),
+            FE_CONST(2831366, -12492146, 1478975, 6122054, 23825128, -12733586, 31097299, 6083058, 31021603, -9793610),
+            FE_CONST(-2529932, -2229646, 445613, 10720828, -13849527, -11505937, -23507731, 16354465, 15067285, -14147707),
+        },
+        {
+            FE_CONST(7840942, 14037873, -33364863, 15934016, -728213, -3642706, 21403988, 1057586, -19379462, -12403220),
+            FE_CONST(915865, -16469274, 15608285, -8789130, -24357026, 6060030, -17371319, 8410997, -7220461, 16527025),
+            FE_CONST(32922597, -556987, 20336074, -16184568, 10903705, -5384487, 16957574, 52992, 23834301, 6588044),
+        },
+        {
+            FE_CONST(32752030, 11232950, 3381995, -8714866, 22652988, -10744103, 17159699, 16689107, -20314580, -1305992),
+            FE_CONST(-4689649, 9166776, -25710296, -10847306, 11576752, 12733943, 7924251, -2752281, 1976123, -7249027),
+            FE_CONST(21251222, 16309901, -2983015, -6783122, 30810597, 12967303, 156041, -3371252, 12331345, -8237197),
+        },
+        {
+            FE_CONST(8651614, -4477032, -16085636, -4996994, 13002507, 2950805, 29054427, -5106970, 10008136, -4667901),
+            FE_CONST(31486080, 15114593, -14261250, 12951354, 14369431, -7387845, 16347321, -13662089, 8684155, -10532952),
+            FE_CONST(19443825, 11385320, 24468943, -9659068, -23919258, 2187569, -26263207, -6086921, 31316348, 14219878),
+        },
+        {
+            FE_CONST(-28594490, 1193785, 32245219, 11392485, 31092169, 15722801, 27146014, 6992409, 29126555, 9207390),
+            FE_CONST(32382935, 1110093, 18477781, 11028262, -27411763, -7548111, -4980517, 10843782, -7957600, -14435730),
+            FE_CONST(2814918, 7836403, 27519878, -7868156, -20894015, -11553689, -21494559, 8550130, 28346258, 1994730),
+        },
+        {
+            FE_CONST(-19578299, 8085545, -14000519, -3948622, 2785838, -16231307, -19516951, 7174894, 22628102, 8115180),
+            FE_CONST(-30405132, 955511, -11133838, -15078069, -32447087, -13278079, -25651578, 3317160, -9943017, 930272),
+            FE_CONST(-15303681, -6833769, 28856490, 1357446, 23421993, 1057177, 24091212, -1388970, -22765376, -10650715),
+        },
+        {
+            FE_CONST(-22751231, -5303997, -12907607, -12768866, -15811511, -7797053, -14839018, -16554220, -1867018, 8398970),
+            FE_CONST(-31969310, 2106403, -4736360, 1362501, 12813763, 16200670, 22981545, -6291273, 18009408, -15772772),
+            FE_CONST(-17220923, -9545221, -27784654, 14166835, 29815394, 7444469, 29551787, -3727419, 19288549, 1325865),
+        },
+        {
+            FE_CONST(15100157, -15835752, -23923978, -1005098, -26450192, 15509408, 12376730, -3479146, 33166107, -8042750),
+            FE_CONST(20909231, 13023121, -9209752, 16251778, -5778415, -8094914, 12412151, 10018715, 2213263, -13878373),
+            FE_CONST(32529814, -11074689, 30361439, -16689753, -9135940, 1513226, 22922121, 6382134, -5766928, 8371348),
+        },
+    },
+    {
+        {
+            FE_CONST(1466931, 6920868, 81906, -9248881, -3631797, -7282819, -4002752, -577600, -2046153, -12744640),
+            FE_CONST(-9673188, -8089957, -14215533, 2884955, -23247878, -4031904, 14654684, -14180722, 15170242, -12458993),
+            FE_CONST(-2212300, 4413816, -676769, 9818067, -12803306, 1459473, 3636451, -7302343, 4498007, 9916704),
+        },
+        {
+            FE_CONST(16919400, -15661710, -29375088, 788854, 22709065, -4825587, -11475732, -10166778, -16952540, -16383675),
+            FE_CONST(-1461905, 574386, -13912147, 921132, 3852007, -4804097, 31744587, -1323224, -31409235, 12484286),
+            FE_CONST(-28793381, -3171741, 488608, 3533994, -18241312, -2771362, -26159196, 6255600, -27946083, 5734944),
+        },
+        {
+            FE_CONST(-6930613, -16376897, -8736493, 451357, 19038266, -9692007, 300533, 13382813, 21800307, -9951755),
+            FE_CONST(6034582, 1921245, 2196036, -1125949, -9700108, 7455568, -3435626, -4375395, 26430431, 15139308),
+            FE_CONST(-3545259, -10335546, 29296041, -7059068, -12529674, 5999578, -725847, 994694, -14937652, 12283828),
+        },
+        {
+            FE_CONST(8888927, -3934348, -23208510, 11198962, -26094395, -5555530, -30697656, 7752898, 4539597, 2184177),
+            FE_CONST(-15359790, -5687054, -5659965, -7880287, 21858547, -1533493, -5663516, -11218210, -4561268, 16071223),
+            FE_CONST(32353580, 15216981, -4404163, -555710, 9622736, -4545032, -8252350, -3037329, -7763384, -6406645),
+        },
+        {
+            FE_CONST(-8956266, 7753750, -29662271, 14804683, -4504423, 12378480, -19524208, -12673196, -32600823, 4062684),
+            FE_CONST(-24114073, 4670198, 13030953, -10164071, 13952457, -13227063, 9718022, -12850761, -1414985, -13241528),
+            FE_CONST(8761375, 8057205, -26433829, 9905518, -24549998, 1154254, -20299679, -5507027, 9537249, -15416947),
+        },
+        {
+            FE_CONST(-16309084, -16434421, -20221227, 605502, 7260294, 9063152, 2403511, 13364645, 13423223, -6828350),
+            FE_CONST(-20054243, -9162646, -25832804, 11485713, 22535108, -13643926, 28295885, 3009938, -11230337, 1702788),
+            FE_CONST(26739191, 11009990, -18481770, 16585992, -25896844, -184502, 9343419, -244546, -25100783, 4797376),
+        },
+        {
+            FE_CONST(28402825, 3806924, 25125539, -4269176, -29447309, -11869638, 6224465, 1582902, -22740014, 1561392),
+            FE_CONST(26079848, 10174068, 7784834, -12016685, -16297528, -3589280, -23184902, 13911438, -30523400, -5271909),
+            FE_CONST(4277711, -16537680, 6920641, -15710284, -14909484, -7845980, -29931818, -9128021, -32879317, -7235157),
+        },
+        {
+            FE_CONST(-13113012, -11600435, 31634969, -1011958, 32691622, -13580464, -27929075, 9242993, -129472, 10712363),
+            FE_CONST(448786, 5297823, 6384904, -15869444, -14137103, -3415431, 29201369, 580246, 5011189, 7722222),
+            FE_CONST(13344599, 2986769, -4722760, -10019693, 6459271, -16492604, 1721111, -14299322, -8871735, -13556176),
+        },
+    },
+    {
+        {
+            FE_CONST(9923462, 11271500, 12616794, 3544722, -29998368, -1721626, 12891687, -8193132, -26442943, 10486144),
+            FE_CONST(-22597207, -7012665, 8587003, -8257861, 4084309, -12970062, 361726, 2610596, -23921530, -11455195),
+            FE_CONST(5408411, -1136691, -4969122, 10561668, 24145918, 14240566, 31319731, -4235541, 19985175, -3436086),
+        },
+        {
+            FE_CONST(-13994457, 16616821, 14549246, 3341099, 32155958, 13648976, -17577068, 8849297, 65030, 8370684),
+            FE_CONST(-8320926, -12049626, 31204563, 5839400, -20627288, -1057277, -19442942, 6922164, 12743482, -9800518),
+            FE_CONST(-2361371, 12678785, 28815050, 4759974, -23893047, 4884717, 23783145, 11038569, 18800704, 255233),
+        },
+        {
+            FE_CONST(-5269658, -1773886, 13957886, 7990715, 23132995, 728773, 13393847, 9066957, 19258688, -14753793),
+            FE_CONST(-2936654, -10827535, -10432089, 14516793, -3640786, 4372541, -31934921, 2209390, -1524053, 2055794),
+            FE_CONST(580882, 16705327, 5468415, -2683018, -30926419, -14696000, -7203346, -8994389, -30021019, 7394435),
+        },
+        {
+            FE_CONST(23838809, 1822728, -15738443, 15242727, 8318092, -3733104, -21672180, -3492205, -4821741, 14799921),
+            FE_CONST(13345610, 9759151, 3371034, -16137791, 16353039, 8577942, 31129804, 13496856, -9056018, 7402518),
+            FE_CONST(2286874, -4435931, -20042458, -2008336, -13696227, 5038122, 11006906, -15760352, 8205061, 1607563),
+        },
+        {
+            FE_CONST(14414086, -8002132, 3331830, -3208217, 22249151, -5594188, 18364661, -2906958, 30019587, -9029278),
+            FE_CONST(-27688051, 1585953, -10775053, 931069, -29120221, -11002319, -14410829, 12029093, 9944378, 8024),
+            FE_CONST(4368715, -3709630, 29874200, -15022983, -20230386, -11410704, -16114594, -999085, -8142388, 5640030),
+        },
+        {
+            FE_CONST(10299610, 13746483, 11661824, 16234854, 7630238, 5998374, 9809887, -16694564, 15219798, -14327783),
+            FE_CONST(27425505, -5719081, 3055006, 10660664, 23458024, 595578, -15398605, -1173195, -18342183, 9742717),
+            FE_CONST(6744077, 2427284, 26042789, 2720740, -847906, 1118974, 32324614, 7406442, 12420155, 1994844),
+        },
+        {
+            FE_CONST(14012521, -5024720, -18384453, -9578469, -26485342, -3936439, -13033478, -10909803, 24319929, -6446333),
+            FE_CONST(16412690, -4507367, 10772641, 15929391, -17068788, -4658621, 10555945, -10484049, -30102368, -4739048),
+            FE_CONST(22397382, -7767684, -9293161, -12792868, 17166287, -9755136, -27333065, 6199366, 21880021, -12250760),
+        },
+        {
+            FE_CONST(-4283307, 5368523, -31117018, 8163389, -30323063, 3209128, 16557151, 8890729, 8840445, 4957760),
+            FE_CONST(-15447727, 709327, -6919446, -10870178, -29777922, 6522332, -21720181, 12130072, -14796503, 5005757),
+            FE_CONST(-2114751, -14308128, 23019042, 15765735, -25269683, 6002752, 10183197, -13239326, -16395286, -2176112),
+        },
+    },
+    {
+        {
+            FE_CONST(6083246, 12395507, -20041050, -713102, 11444551, -15587007, 23416873, 10372699, 26431488, -14797209),
+            FE_CONST(15803991, -10657305, 29704098, 10955216, -6242370, -4502552, -28051410, -15443577, -14004028, 2921542),
+            FE_CONST(12255955, 11948580, -31284309, -7834093, 21202979, 15865602, 17908903, -16731059, -12339931, -13163379),
+        },
+        {
+            FE_CONST(-9680504, 16317181, 2402138, -14042063, -10652521, 2467095, 30023376, -16188146, -11779811, -5312013),
+            FE_CONST(-8354103, 10686468, 28908656, -4408072, 16637852, -774988, -9496537, 15765471, -3446083, -11954714),
+            FE_CONST(10816854, -1624971, 24102798, -4311051, -19361534, -8349905, 14656539, -6328833, 3879723, 56674),
+        },
+        {
+            FE_CONST(7719343, 16458075, -6383311, 1818, -7272941, 9467445, -4862499, -12918451, -11067592, -6653773),
+            FE_CONST(13306195, 7123786, 10035200, -16549663, 26209607, 14010929, -20756242, 13375158, -2571184, -6517193),
+            FE_CONST(10212123, 5954793, -28059294, -10937196, 617142, -11150927, 10452256, -8964465, -32242055, -3505130),
+        },
+        {
+            FE_CONST(-18545207, -11910535, -28966478, -10616503, -27055645, -5168344, -5589803, -9900290, -4713414, -926170),
+            FE_CONST(13182109, -6272313, -1371049, -9369335, 25827772, -979250, -18686929, -4192873, 27141691, 957129),
+            FE_CONST(-30204747, 7174328, 8658488, 7385061, 23756150, -2542927, -31688514, 14480373, -16660972, 11067504),
+        },
+        {
+            FE_CONST(20190850, 3116205, -31809800, -14627204, 10459946, -11032743, -17044523, 5591658, 31112684, -10746600),
+            FE_CONST(-3665452, 15081076, 11335059, 637623, -30542682, 7400957, 19345470, 1493531, -17267648, -8981863),
+            FE_CONST(9526309, -3026933, -25082483, -12560278, 7304007, -4964513, -16720252, 4737995, -33205350, 9787092),
+        },
+        {
+            FE_CONST(-1809433, 2541410, 7581448, 14053339, -21678427, -14312547, 3906475, 1408389, -23318237, -5824484),
+            FE_CONST(-19017175, 2610330, -32961032, -12695780, -9202301, 14639870, -20328751, 3300749, -25275667, -1435028),
+            FE_CONST(12271394, 4021509, 26283881, -14321946, 27467580, -1212226, -3559235, -7766618, 8779644, 9919534),
+        },
+        {
+            FE_CONST(-15014700, -10007953, -23227639, 3788747, 22734611, 10177342, -6161567, 15814757, -25588888, 8890937),
+            FE_CONST(-30673698, 7403102, -16422870, 16333359, 2161933, -14426667, -5433593, -10189521, -31024546, 5126378),
+            FE_CONST(-27624529, -4379365, -32747272, 14351887, -12016012, -13494711, 4983919, 503880, -14788050, -9344261),
+        },
+        {
+            FE_CONST(-16342477, -8800379, 30990426, -15692932, 32336203, -15320229, -12518815, 13139001, 6688050, 9467092),
+            FE_CONST(-12833317, 9092398, 12690062, 16437288, -17753039, -8277969, -31500781, -7217133, -5114726, 3738925),
+            FE_CONST(-21212473, -15723708, -29446787, -2257603, -21423987, 6140972, -32798871, 13796702, 23487581, 7747574),
+        },
+    },
+    {
+        {
+            FE_CONST(-19025756, 1632005, 13466291, -7995100, -23640451, 16573537, -32013908, -3057104, 22208662, 2000468),
+            FE_CONST(3065073, -1412761, -25598674, -361432, -17683065, -5703415, -8164212, 11248527, -3691214, -7414184),
+            FE_CONST(10379208, -6045554, 8877319, 1473647, -29291284, -12507580, 16690915, 2553332, -3132688, 16400289),
+        },
+        {
+            FE_CONST(15716668, 1254266, -18472690, 7446274, -8448918, 6344164, -22097271, -7285580, 26894937, 9132066),
+            FE_CONST(24158887, 12938817, 11085297, -8177598, -28063478, -4457083, -30576463, 64452, -6817084, -2692882),
+            FE_CONST(13488534, 7794716, 22236231, 5989356, 25426474, -12578208, 2350710, -3418511, -4688006, 2364226),
+        },
+        {
+            FE_CONST(16335052, 9132434, 25640582, 6678888, 1725628, 8517937, -11807024, -11697457, 15445875, -7798101),
+            FE_CONST(29004207, -7867081, 28661402, -640412, -12794003, -7943086, 31863255, -4135540, -278050, -15759279),
+            FE_CONST(-6122061, -14866665, -28614905, 14569919, -10857999, -3591829, 10343412, -6976290, -29828287, -10815811),
+        },
+        {
+            FE_CONST(27081650, 3463984, 14099042, -4517604, 1616303, -6205604, 29542636, 15372179, 17293797, 960709),
+            FE_CONST(20263915, 11434237, -5765435, 11236810, 13505955, -10857102, -16111345, 6493122, -19384511, 7639714),
+            FE_CONST(-2830798, -14839232, 25403038, -8215196, -8317012, -16173699, 18006287, -16043750, 29994677, -15808121),
+        },
+        {
+            FE_CONST(9769828, 5202651, -24157398, -13631392, -28051003, -11561624, -24613141, -13860782, -31184575, 709464),
+            FE_CONST(12286395, 13076066, -21775189, -1176622, -25003198, 4057652, -32018128, -8890874, 16102007, 13205847),
+            FE_CONST(13733362, 5599946, 10557076, 3195751, -5557991, 8536970, -25540170, 8525972, 10151379, 10394400),
+        },
+        {
+            FE_CONST(4024660, -16137551, 22436262, 12276534, -9099015, -2686099, 19698229, 11743039, -33302334, 8934414),
+            FE_CONST(-15879800, -4525240, -8580747, -2934061, 14634845, -698278, -9449077, 3137094, -11536886, 11721158),
+            FE_CONST(17555939, -5013938, 8268606, 2331751, -22738815, 9761013, 9319229, 8835153, -9205489, -1280045),
+        },
+        {
+            FE_CONST(-461409, -7830014, 20614118, 16688288, -7514766, -4807119, 22300304, 505429, 6108462, -6183415),
+            FE_CONST(-5070281, 12367917, -30663534, 3234473, 32617080, -8422642, 29880583, -13483331, -26898490, -7867459),
+            FE_CONST(-31975283, 5726539, 26934134, 10237677, -3173717, -605053, 24199304, 3795095, 7592688, -14992079),
+        },
+        {
+            FE_CONST(21594432, -14964228, 17466408, -4077222, 32537084, 2739898, 6407723, 12018833, -28256052, 4298412),
+            FE_CONST(-20650503, -11961496, -27236275, 570498, 3767144, -1717540, 13891942, -1569194, 13717174, 10805743),
+            FE_CONST(-14676630, -15644296, 15287174, 11927123, 24177847, -8175568, -796431, 14860609, -26938930, -5863836),
+        },
+    },
+    {
+        {
+            FE_CONST(-30587084, -4629784, -20009115, -10744271, -15524787, 10280576, -28667146, 7716332, 24015220, 15147052),
+            FE_CONST(-5646697, -13269764, -13947040, -14622668, 3346795, -337258, -1015199, 7124142, 4664896, 15322844),
+            FE_CONST(-8229784, 5997383, 8085987, -15578361, -2326588, -4766867, 25901074, 5262370, 25656743, 3392425),
+        },
+        {
+            FE_CONST(-5860243, 11777295, 769126, -15776754, -8901554, 6810940, -33061713, -5528741, 28019812, -9002317),
+            FE_CONST(30723280, -14669513, -5004498, 15511447, 9149397, 14075675, -15080544, 8780012, -6507584, -1125302),
+            FE_CONST(-26208846, -6712689, 29530263, 7885954, 30958908, 617491, 10886354, -6441812, 17398271, -5028867),
+        },
+        {
+            FE_CONST(4956577, -12669076, -6361090, -1974546, -12324368, -8776931, -22792445, -11783036, 18817572, -7313138),
+            FE_CONST(-12310337, 1702372, -21202916, -8048502, 5377387, 403765, -24479332, 9674308, 9302088, -7454061),
+            FE_CONST(-33117989, -5351766, 12466361, 16089921, -29020674, 16555776, 26195362, -6322866, 5646086, 12810190),
+        },
+        {
+            FE_CONST(12375359, -4411558, 31344248, -8172991, -15128721, -3466513, -8976863, 16561847, -26205910, -9394891),
+            FE_CONST(29358073, -9242956, -18683448, 1114915, -14399942, -15164073, -26780152, 13440858, -23247769, 7151756),
+            FE_CONST(22427521, -8216631, -13953689, 5390460, 9717898, -15420189, -24996943, -3843860, -27420816, 8959577),
+        },
+        {
+            FE_CONST(-30126184, -13656189, 25625075, 6569873, -5456214, 14774032, 15970087, -4369508, 21072393, -15754951),
+            FE_CONST(-9261855, 6283629, -1899634, -11914810, -33141702, -4158631, -27884874, -97164, 29917072, 2936988),
+            FE_CONST(-30028170, -8874873, 5361707, 7325840, -17285067, -8528659, 392275, 14456831, 9885372, -10694473),
+        },
+        {
+            FE_CONST(-26182647, 15674824, 15490680, 6526093, 13923950, 14064179, 1521517, 1040394, 32631944, -12010168),
+            FE_CONST(13523352, -4449934, 22306302, 8760927, -17036716, 12043353, -28278000, -16076403, -14476251, 13913407),
+            FE_CONST(27496510, -16264770, -8813338, -4404436, -14389617, -7726065, 10852392, 3110348, 24164752, -1314133),
+        },
+        {
+            FE_CONST(-8115330, 5274428, 14202128, 3980639, 22519493, -8892418, -28849278, 1503631, -8717104, -9616760),
+            FE_CONST(12107329, -8694487, 6010956, -16196217, -29313968, -1561933, -31909401, 16345151, -27510098, 4331499),
+            FE_CONST(20321045, -16524868, 8205169, 1278080, 6363273, 10637440, -22872718, 6556862, -7078489, 2662793),
+        },
+        {
+            FE_CONST(-20210390, -6496548, 22819522, 4633575, -1324763, -10609782, -2827669, -12753155, -3455290, -9249699),
+            FE_CONST(8174749, 12907021, 7366869, 10800649, 14755747, -2733367, 18391108, -2299491, -11855318, 8180997),
+            FE_CONST(-21517309, 7971553, -17356463, -12788426, -3116187, -7501968, -10418063, -13057315, 16249265, -871572),
+        },
+    },
+    {
+        {
+            FE_CONST(12962541, 5311799, -10060768, 11658280, 18855286, -7954201, 13286263, -12808704, -4381056, 9882022),
+            FE_CONST(18512079, 11319350, -20123124, 15090309, 18818594, 5271736, -22727904, 3666879, -23967430, -3299429),
+            FE_CONST(-6789020, -3146043, 16192429, 13241070, 15898607, -14206114, -10084880, -6661110, -2403099, 5276065),
+        },
+        {
+            FE_CONST(30169808, -5317648, 26306206, -11750859, 27814964, 7069267, 7152851, 3684982, 1449224, 13082861),
+            FE_CONST(10342826, 3098505, 2119311, 193222, 25702612, 12233820, 23697382, 15056736, -21016438, -8202000),
+            FE_CONST(-33150110, 3261608, 22745853, 7948688, 19370557, -15177665, -26171976, 6482814, -10300080, -11060101),
+        },
+        {
+            FE_CONST(32869458, -5408545, 25609743, 15678670, -10687769, -15471071, 26112421, 2521008, -22664288, 6904815),
+            FE_CONST(29506923, 4457497, 3377935, -9796444, -30510046, 12935080, 1561737, 3841096, -29003639, -6657642),
+            FE_CONST(10340844, -6630377, -18656632, -2278430, 12621151, -13339055, 30878497, -11824370, -25584551, 5181966),
+        },
+        {
+            FE_CONST(25940115, -12658025, 17324188, -10307374, -8671468, 15029094, 24396252, -16450922, -2322852, -12388574),
+            FE_CONST(-21765684, 9916823, -1300409, 4079498, -1028346, 11909559, 1782390, 12641087, 20603771, -6561742),
+            FE_CONST(-18882287, -11673380, 24849422, 11501709, 13161720, -4768874, 1925523, 11914390, 4662781, 7820689),
+        },
+        {
+            FE_CONST(12241050, -425982, 8132691, 9393934, 32846760, -1599620, 29749456, 12172924, 16136752, 15264020),
+            FE_CONST(-10349955, -14680563, -8211979, 2330220, -17662549, -14545780, 10658213, 6671822, 19012087, 3772772),
+            FE_CONST(3753511, -3421066, 10617074, 2028709, 14841030, -6721664, 28718732, -15762884, 20527771, 12988982),
+        },
+        {
+            FE_CONST(-14822485, -5797269, -3707987, 12689773, -898983, -10914866, -24183046, -10564943, 3299665, -12424953),
+            FE_CONST(-16777703, -15253301, -9642417, 4978983, 3308785, 8755439, 6943197, 6461331, -25583147, 8991218),
+            FE_CONST(-17226263, 1816362, -1673288, -6086439, 31783888, -8175991, -32948145, 7417950, -30242287, 1507265),
+        },
+        {
+            FE_CONST(29692663, 6829891, -10498800, 4334896, 20945975, -11906496, -28887608, 8209391, 14606362, -10647073),
+            FE_CONST(-3481570, 8707081, 32188102, 5672294, 22096700, 1711240, -33020695, 9761487, 4170404, -2085325),
+            FE_CONST(-11587470, 14855945, -4127778, -1531857, -26649089, 15084046, 22186522, 16002000, -14276837, -8400798),
+        },
+        {
+            FE_CONST(-4811456, 13761029, -31703877, -2483919, -3312471, 7869047, -7113572, -9620092, 13240845, 10965870),
+            FE_CONST(-7742563, -8256762, -14768334, -13656260, -23232383, 12387166, 4498947, 14147411, 29514390, 4302863),
+            FE_CONST(-13413405, -12407859, 20757302, -13801832, 14785143, 8976368, -5061276, -2144373, 17846988, -13971927),
+        },
+    },
+    {
+        {
+            FE_CONST(10346599, -476640, -10862894, -11213802, -7409626, 11386694, 27912709, 11780332, -10622439, -1151873),
+            FE_CONST(-14368516, 11729809, -8979461, 4324523, 1380618, 3235999, -2796427, -6292513, 6562440, -6112356),
+            FE_CONST(7457804, -13484963, 5733892, -4539260, -28012359, -1807520, -5223958, 12543215, 27429848, 11816789),
+        },
+        {
+            FE_CONST(-17925550, 6763423, 22706144, -4775257, -22840501, -5719270, 13600196, 14354316, 24469649, 14182103),
+            FE_CONST(-13256467, -9141865, 24575833, 13904658, -22844886, -14562032, 23414943, -5564006, -18301039, -5370616),
+            FE_CONST(-24984379, 8166081, 32884399, -7176833, 26433100, 13158336, -17384044, -15010054, -21555397, -5617170),
+        },
+        {
+            FE_CONST(-20018965, 1057168, 1151406, -11794570, -3961825, -8876069, 19411079, 15840644, -29122348, 1422923),
+            FE_CONST(7226966, -9661466, -32807954, -9007287, 4228865, 12624757, -6291562, 11689760, -7574398, 7645616),
+            FE_CONST(4040116, -9935425, -2489503, 1187245, 31415971, -3049192, 18788684, 8315099, 21959221, -6557998),
+        },
+        {
+            FE_CONST(19073494, -4037188, -22594853, 3100191, -9442162, -11197422, -16689028, -4093733, 5601348, 10233900),
+            FE_CONST(6033336, 9711222, 19885731, -13869448, -12140687, -16144022, -11316798, 13313507, 32398080, 5470206),
+            FE_CONST(-7984180, -4091862, 25152576, 13826189, -33084670, -3069252, -4095445, -15830519, -31898193, 6722296),
+        },
+        {
+            FE_CONST(7783583, -4032592, -25245671, -7079437, 26603500, 10502852, -15623946, -2062323, 8907598, 5426645),
+            FE_CONST(10887197, -3556024, 23008116, 1996959, 26345745, 3272147, 28549059, -4705972, -32379590, -3477772),
+            FE_CONST(-10036134, -11590357, 28169681, -590927, -5404463, -5048366, -16315336, 7298578, 2556075, -12833680),
+        },
+        {
+            FE_CONST(28500562, -12029136, -22720704, 666096, 19635978, -11450261, -6855447, 10918147, 4448423, -6115419),
+            FE_CONST(1659386, 1696246, 15694894, 7705734, -24893262, 14051188, 1560607, -9790233, -15680315, 2700818),
+            FE_CONST(-8184354, 11645186, -31343806, 12217059, 3573955, -2882335, 11112246, 1960278, -26489020, -16508218),
+        },
+        {
+            FE_CONST(31780082, -9226930, -11094895, -9950546, 23760847, -8521683, -15065910, -16260468, 31531331, 4776660),
+            FE_CONST(13776507, -10579833, -18898851, 15234424, 19621869, -14400384, -13397031, 6697642, 30566815, -138050),
+            FE_CONST(-2827996, 1762456, 16884081, -3034827, 25313726, -7684846, 28564061, 10091930, -14815436, 10607355),
+        },
+        {
+            FE_CONST(-24476149, -13841201, -5563725, 5192812, 20614618, 9319711, -3169617, -9007496, 19645471, -11264161),
+            FE_CONST(-15448412, -12956327, 8297361, -16338695, 26001315, 11118805, 20972297, -15046251, -6231662, -14424208),
+            FE_CONST(26571535, 13254858, -31603811, -15423465, 32650027, -3348869, -3007991, 3994168, 26626691, -10612448),
+        },
+    },
+    {
+        {
+            FE_CONST(-2244452, -754728, -4597030, -1066309, -6247172, 1455299, -21647728, -9214789, -5222701, 12650267),
+            FE_CONST(-9906797, -16070310, 21134160, 12198166, -27064575, 708126, 387813, 13770293, -19134326, 10958663),
+            FE_CONST(22470984, 12369526, 23446014, -5441109, -21520802, -9698723, -11772496, -11574455, -25083830, 4271862),
+        },
+        {
+            FE_CONST(-25169565, -10053642, -19909332, 15361595, -5984358, 2159192, 75375, -4278529, -32526221, 8469673),
+            FE_CONST(15854970, 4148314, -8893890, 7259002, 11666551, 13824734, -30531198, 2697372, 24154791, -9460943),
+            FE_CONST(15446137, -15806644, 29759747, 14019369, 30811221, -9610191, -31582008, 12840104, 24913809, 9815020),
+        },
+        {
+            FE_CONST(-4709286, -5614269, -31841498, -12288893, -14443537, 10799414, -9103676, 13438769, 18735128, 9466238),
+            FE_CONST(11933045, 9281483, 5081055, -5183824, -2628162, -4905629, -7727821, -10896103, -22728655, 16199064),
+            FE_CONST(14576810, 379472, -26786533, -8317236, -29426508, -10812974, -102766, 1876699, 30801119, 2164795),
+        },
+        {
+            FE_CONST(15995086, 3199873, 13672555, 13712240, -19378835, -4647646, -13081610, -15496269, -13492807, 1268052),
+            FE_CONST(-10290614, -3659039, -3286592, 10948818, 23037027, 3794475, -3470338, -12600221, -17055369, 3565904),
+            FE_CONST(29210088, -9419337, -5919792, -4952785, 10834811, -13327726, -16512102, -10820713, -27162222, -14030531),
+        },
+        {
+            FE_CONST(-13161890, 15508588, 16663704, -8156150, -28349942, 9019123, -29183421, -3769423, 2244111, -14001979),
+            FE_CONST(-5152875, -3800936, -9306475, -6071583, 16243069, 14684434, -25673088, -16180800, 13491506, 4641841),
+            FE_CONST(10813417, 643330, -19188515, -728916, 30292062, -16600078, 27548447, -7721242, 14476989, -12767431),
+        },
+        {
+            FE_CONST(10292079, 9984945, 6481436, 8279905, -7251514, 7032743, 27282937, -1644259, -27912810, 12651324),
+            FE_CONST(-31185513, -813383, 22271204, 11835308, 10201545, 15351028, 17099662, 3988035, 21721536, -3148940),
+            FE_CONST(10202177, -6545839, -31373232, -9574638, -32150642, -8119683, -12906320, 3852694, 13216206, 14842320),
+        },
+        {
+            FE_CONST(-15815640, -10601066, -6538952, -7258995, -6984659, -6581778, -31500847, 13765824, -27434397, 9900184),
+            FE_CONST(14465505, -13833331, -32133984, -14738873, -27443187, 12990492, 33046193, 15796406, -7051866, -8040114),
+            FE_CONST(30924417, -8279620, 6359016, -12816335, 16508377, 9071735, -25488601, 15413635, 9524356, -7018878),
+        },
+        {
+            FE_CONST(12274201, -13175547, 32627641, -1785326, 6736625, 13267305, 5237659, -5109483, 15663516, 4035784),
+            FE_CONST(-2951309, 8903985, 17349946, 601635, -16432815, -4612556, -13732739, -15889334, -22258478, 4659091),
+            FE_CONST(-16916263, -4952973, -30393711, -15158821, 20774812, 15897498, 5736189, 15026997, -2178256, -13455585),
+        },
+    },
+    {
+        {
+            FE_CONST(-28008380, 2647815, -557320, -14434835, 19427705, 15870322, 31787181, -4082468, 22278890, 6317806),
+            FE_CONST(-13667269, 11157205, 5128927, -16632537, -9482053, -6380415, -5071418, -2069913, -14534284, -16673198),
+            FE_CONST(-33280380, -1122728, -18708174, 13874374, 32782178, -105835, 25547284, 10785151, -26078720, 14346764),
+        },
+        {
+            FE_CONST(-14201112, -5815658, 23263515, -7142398, 18278913, 5627820, -26408943, 6765544, -30248805, -2144123),
+            FE_CONST(-28971948, -5050927, 14867138, 15835556, -626782, 2262239, -33194126, -4810459, 9241906, -15610919),
+            FE_CONST(11375832, 10181657, 5007665, -1255503, -23668956, -4111883, 7766691, 11637141, 3564243, 11636475),
+        },
+        {
+            FE_CONST(25622719, 6475425, -19000502, -4825715, -25453460, 3693811, -15535279, -15059647, -9577091, 7842950),
+            FE_CONST(-25659051, -8166661, 3600381, -675936, -18386874, -13280049, -2077427, -2362823, -10927060, 9020604),
+            FE_CONST(6737791, 16017032, -6623060, 6450788, 16805878, -15888542, -11313305, 777007, -12966005, -6340770),
+        },
+        {
+            FE_CONST(-28419990, -1416873, 24102316, -14529035, 26731487, 1913811, -5837063, -4336319, -14566214, 6386410),
+            FE_CONST(-12655499, -15958340, -5090882, 5566744, -26775554, 2542258, -24597337, 1518118, 32425009, 3373400),
+            FE_CONST(14928705, -5805827, -17837455, -5634115, -17035700, 4602756, 16940648, -2252724, -9834809, 16458858),
+        },
+        {
+            FE_CONST(10698818, -11801108, -23789066, 6282064, 18449787, -464218, -18979741, -15540503, -7034545, -1474910),
+            FE_CONST(-8296787, -8530178, -17439788, -3712921, 20444833, -1377912, 1535073, -6318272, -2023628, 5241709),
+            FE_CONST(-3315807, -10229115, -22877613, 810718, -27690110, 8930740, -20523753, -11410723, -2799202, 14021862),
+        },
+        {
+            FE_CONST(21756920, -9753338, 5449988, -7481556, 20307856, -15502688, -30369985, -12835873, -1634313, 15349274),
+            FE_CONST(12242540, -1566740, -12336168, 6350205, -14364280, -8210917, -7446001, -157297, -22388875, 11948678),
+            FE_CONST(28309867, 3364693, -18600469, 14920372, -18285911, -10149250, 9555145, 7065272, 3944235, -5834675),
+        },
+        {
+            FE_CONST(4951523, 15690522, 14880855, 8519248, -24390881, 9874089, -3572240, 7259760, 12989831, 8402230),
+            FE_CONST(26724669, 4675512, -30154303, 16337449, 20792326, 3467676, -12788488, 13812359, -18558388, -647099),
+            FE_CONST(9679678, 12276434, -13859823, -658738, 16510921, -5905145, 24074350, -5072148, 23600090, -5930513),
+        },
+        {
+            FE_CONST(-14440190, -3214043, 30041968, 11753827, 32540373, 7885479, 21494429, -4186953, -27772691, 10678751),
+            FE_CONST(14556385, -8354790, -8126760, -13076762, -6073244, -11205210, -71666, -385922, 20790980, 14145741),
+            FE_CONST(-27426762, 10365497, -23982985, 303514, 26055800, 9233714, 1544212, 10783003, -6067369, 15255216),
+        },
+    },
+    {
+        {
+            FE_CONST(-8858980, -2219056, 28571666, -10155518, -474467, -10105698, -3801496, 278095, 23440562, -290208),
+            FE_CONST(10226241, -5928702, 15139956, 120818, -14867693, 5218603, 32937275, 11551483, -16571960, -7442864),
+            FE_CONST(17932739, -12437276, -24039557, 10749060, 11316803, 7535897, 22503767, 5561594, -3646624, 3898661),
+        },
+        {
+            FE_CONST(7749907, -969567, -16339731, -16464, -25018111, 15122143, -1573531, 7152530, 21831162, 1245233),
+            FE_CONST(26958459, -14658026, 4314586, 8346991, -5677764, 11960072, -32589295, -620035, -30402091, -16716212),
+            FE_CONST(-12165896, 9166947, 33491384, 13673479, 29787085, 13096535, 6280834, 14587357, -22338025, 13987525),
+        },
+        {
+            FE_CONST(-24349909, 7778775, 21116000, 15572597, -4833266, -5357778, -4300898, -5124639, -7469781, -2858068),
+            FE_CONST(9681908, -6737123, -31951644, 13591838, -6883821, 386950, 31622781, 6439245, -14581012, 4091397),
+            FE_CONST(-8426427, 1470727, -28109679, -1596990, 3978627, -5123623, -19622683, 12092163, 29077877, -14741988),
+        },
+        {
+            FE_CONST(5269168, -6859726, -13230211, -8020715, 25932563, 1763552, -5606110, -5505881, -20017847, 2357889),
+            FE_CONST(32264008, -15407652, -5387735, -1160093, -2091322, -3946900, 23104804, -12869908, 5727338, 189038),
+            FE_CONST(14609123, -8954470, -6000566, -16622781, -14577387, -7743898, -26745169, 10942115, -25888931, -14884697),
+        },
+        {
+            FE_CONST(20513500, 5557931, -15604613, 7829531, 26413943, -2019404, -21378968, 7471781, 13913677, -5137875),
+            FE_CONST(-25574376, 11967826, 29233242, 12948236, -6754465, 4713227, -8940970, 14059180, 12878652, 8511905),
+            FE_CONST(-25656801, 3393631, -2955415, -7075526, -2250709, 9366908, -30223418, 6812974, 5568676, -3127656),
+        },
+        {
+            FE_CONST(11630004, 12144454, 2116339, 13606037, 27378885, 15676917, -17408753, -13504373, -14395196, 8070818),
+            FE_CONST(27117696, -10007378, -31282771, -5570088, 1127282, 12772488, -29845906, 10483306, -11552749, -1028714),
+            FE_CONST(10637467, -5688064, 5674781, 1072708, -26343588, -6982302, -1683975, 9177853, -27493162, 15431203),
+        },
+        {
+            FE_CONST(20525145, 10892566, -12742472, 12779443, -29493034, 16150075, -28240519, 14943142, -15056790, -7935931),
+            FE_CONST(-30024462, 5626926, -551567, -9981087, 753598, 11981191, 25244767, -3239766, -3356550, 9594024),
+            FE_CONST(-23752644, 2636870, -5163910, -10103818, 585134, 7877383, 11345683, -6492290, 13352335, -10977084),
+        },
+        {
+            FE_CONST(-1931799, -5407458, 3304649, -12884869, 17015806, -4877091, -29783850, -7752482, -13215537, -319204),
+            FE_CONST(20239939, 6607058, 6203985, 3483793, -18386976, -779229, -20723742, 15077870, -22750759, 14523817),
+            FE_CONST(27406042, -6041657, 27423596, -4497394, 4996214, 10002360, -28842031, -4545494, -30172742, -4805667),
+        },
+    },
+    {
+        {
+            FE_CONST(13709443, -5310645, 30658614, -13647152, -27739891, 14679756, 29939045, 1891282, 27601955, -11772417),
+            FE_CONST(6456676, -7170684, -1668316, -1751641, 11087586, -6058429, 18004340, 9296837, 27258448, 15922863),
+            FE_CONST(12181132, -14302828, -21793544, -2222066, 16009888, -9772148, -23645078, -12877747, 3515930, -1614618),
+        },
+        {
+            FE_CONST(22615882, 7758979, 26919993, 9915811, -26236665, -7749685, -12447737, -58302, 21424870, -1612162),
+            FE_CONST(20038096, -11305584, -16491737, -15976605, 30802515, 5895106, -25753230, 5261453, -28528333, -5224460),
+            FE_CONST(6763013, 13765978, -13787601, -12458665, 14809004, 16769926, -29819221, 11742263, 22770778, 12963910),
+        },
+        {
+            FE_CONST(-16605113, 3054095, -19332353, 12056446, 21005442, -11088926, 30273803, 2846210, -32384631, 8452371),
+            FE_CONST(-8767989, 4219950, 14703898, -16462673, -26810867, 149419, -1049475, -11470934, 5115191, 10341261),
+            FE_CONST(-4594766, -7360882, -12289327, -11824677, 4288262, 6031202, -5100333, -15039990, -23743276, -10885819),
+        },
+        {
+            FE_CONST(21711231, -16012093, 26271973, 3526118, 8119692, 1142597, -24864148, -10451213, -31452154, 1382966),
+            FE_CONST(-16550601, -687739, 5065324, -4880418, -7847240, -1470289, -24818286, -8440430, 9270014, -14909132),
+            FE_CONST(20080625, -10917250, 30490655, 7210668, -12894370, -15146353, -17731974, 6968387, 18462259, -15308870),
+        },
+        {
+            FE_CONST(-31791751, -14984478, 20682127, 8893813, 13020185, 2452812, -21821280, 12305540, 5493274, 12394874),
+            FE_CONST(14739307, 8925852, -32335240, 13063418, -20664407, -14216573, -17865630, 329002, -31843043, 3200232),
+            FE_CONST(537606, -3071769, 9471571, -92834, 29333654, -13268969, -1523546, -13137307, 5805055, -6962026),
+        },
+        {
+            FE_CONST(-16191937, 10995446, 16388152, 2978592, -8966808, 10742696, -10425367, -16370954, 27860305, 5652808),
+            FE_CONST(-22671007, 781773, 1381250, 15312553, -7194557, -6647433, -30299592, 50892, 12601078, 13360121),
+            FE_CONST(-7271732, 15222706, 16107540, -3699863, -29339776, -5138987, -7312298, 9200467, 5434008, 7268345),
+        },
+        {
+            FE_CONST(3568783, -6609549, 6404588, 10180702, 10815493, 7961328, 23281271, 7940263, -13457221, -8734293),
+            FE_CONST(-2797647, 7754797, -25674438, -589718, 11894387, 5228204, 23276368, -6739400, -18628148, -6880696),
+            FE_CONST(15800573, 14255173, -6967792, -2317915, 11329250, 15310656, 33197658, 13831758, 25312629, -1930587),
+        },
+        {
+            FE_CONST(-17288697, 9375896, -23677282, 10374474, -22027693, -161800, 4589981, 2497038, 17920358, 6412770),
+            FE_CONST(9186017, 1882711, -7769002, 11741429, 27738098, 15184939, 21462049, -2725754, 1190574, -8952229),
+            FE_CONST(-15970161, 14138394, -25693621, 1427938, -33132767, 14483520, 9915704, -7437809, -5840242, -10046162),
+        },
+    },
+    {
+        {
+            FE_CONST(11374242, 12660715, 17861383, -12540833, 10935568, 1099227, -13886076, -9091740, -27727044, 11358504),
+            FE_CONST(-12730809, 10311867, 1510375, 10778093, -2119455, -9145702, 32676003, 11149336, -26123651, 4985768),
+            FE_CONST(-19096303, 341147, -6197485, -239033, 15756973, -8796662, -983043, 13794114, -19414307, -15621255),
+        },
+        {
+            FE_CONST(6490081, 11940286, 25495923, -7726360, 8668373, -8751316, 3367603, 6970005, -1691065, -9004790),
+            FE_CONST(1656497, 13457317, 15370807, 6364910, 13605745, 8362338, -19174622, -5475723, -16796596, -5031438),
+            FE_CONST(-22273315, -13524424, -64685, -4334223, -18605636, -10921968, -20571065, -7007978, -99853, -10237333),
+        },
+        {
+            FE_CONST(17747465, 10039260, 19368299, -4050591, -20630635, -16041286, 31992683, -15857976, -29260363, -5511971),
+            FE_CONST(31932027, -4986141, -19612382, 16366580, 22023614, 88450, 11371999, -3744247, 4882242, -10626905),
+            FE_CONST(29796507, 37186, 19818052, 10115756, -11829032, 3352736, 18551198, 3272828, -5190932, -4162409),
+        },
+        {
+            FE_CONST(12501286, 4044383, -8612957, -13392385, -32430052, 5136599, -19230378, -3529697, 330070, -3659409),
+            FE_CONST(6384877, 2899513, 17807477, 7663917, -2358888, 12363165, 25366522, -8573892, -271295, 12071499),
+            FE_CONST(-8365515, -4042521, 25133448, -4517355, -6211027, 2265927, -32769618, 1936675, -5159697, 3829363),
+        },
+        {
+            FE_CONST(28425966, -5835433, -577090, -4697198, -14217555, 6870930, 7921550, -6567787, 26333140, 14267664),
+            FE_CONST(-11067219, 11871231, 27385719, -10559544, -4585914, -11189312, 10004786, -8709488, -21761224, 8930324),
+            FE_CONST(-21197785, -16396035, 25654216, -1725397, 12282012, 11008919, 1541940, 4757911, -26491501, -16408940),
+        },
+        {
+            FE_CONST(13537262, -7759490, -20604840, 10961927, -5922820, -13218065, -13156584, 6217254, -15943699, 13814990),
+            FE_CONST(-17422573, 15157790, 18705543, 29619, 24409717, -260476, 27361681, 9257833, -1956526, -1776914),
+            FE_CONST(-25045300, -10191966, 15366585, 15166509, -13105086, 8423556, -29171540, 12361135, -18685978, 4578290),
+        },
+        {
+            FE_CONST(24579768, 3711570, 1342322, -11180126, -27005135, 14124956, -22544529, 14074919, 21964432, 8235257),
+            FE_CONST(-6528613, -2411497, 9442966, -5925588, 12025640, -1487420, -2981514, -1669206, 13006806, 2355433),
+            FE_CONST(-16304899, -13605259, -6632427, -5142349, 16974359, -10911083, 27202044, 1719366, 1141648, -12796236),
+        },
+        {
+            FE_CONST(-12863944, -13219986, -8318266, -11018091, -6810145, -4843894, 13475066, -3133972, 32674895, 13715045),
+            FE_CONST(11423335, -5468059, 32344216, 8962751, 24989809, 9241752, -13265253, 16086212, -28740881, -15642093),
+            FE_CONST(-1409668, 12530728, -6368726, 10847387, 19531186, -14132160, -11709148, 7791794, -27245943, 4383347),
+        },
+    },
+    {
+        {
+            FE_CONST(30624416, -13126242, -25953584, 418414, -13619589, -10675952, -19780750, -133977, -22060553, 12064616),
+            FE_CONST(-10199003, 9477007, 10089317, 8504039, 13126086, -9573819, -25173649, -3230644, 17558158, 1638976),
+            FE_CONST(-31724711, -1833290, 16865417, -1626396, 26770535, -3512281, 2769244, -1784691, 13565448, 10809822),
+        },
+        {
+            FE_CONST(18870803, -1739352, -21421351, -15365439, -13778108, -11299402, 21598286, -9834178, 16981576, -12393717),
+            FE_CONST(-16346986, 2595842, 3223760, 11478824, -22323860, 1704264, 28019409, -5521154, -15652842, 1187792),
+            FE_CONST(-24491659, -12385790, 26429703, 10127433, 29357889, -9451299, -5790376, 11625206, -11285062, -13888177),
+        },
+        {
+            FE_CONST(-4107564, -12040502, -20498463, 5105880, 24840609, 7318424, 26629447, -16249919, 30739409, 1389103),
+            FE_CONST(-13435015, -8441977, 32732045, 16260520, -5384278, 517639, -23775690, -14606434, 22353688, 13910451),
+            FE_CONST(30345040, 2902983, 5162772, -14827595, 19759779, -12562534, -19524886, 4538331, 31805532, -3432267),
+        },
+        {
+            FE_CONST(24583426, 7569242, -30425061, 7038944, 17041883, 11611847, -23579122, -15980151, 23229697, 10575612),
+            FE_CONST(14173403, 14311420, 23670113, 15125454, -18068511, -2486496, -23010463, 4340309, -23753497, -1183599),
+            FE_CONST(16869553, 6557632, -33508380, 10353713, -10623105, -1372388, 24588191, 1741860, 11830688, -12306463),
+        },
+        {
+            FE_CONST(-16072335, 15868402, -18463594, 12573710, -20722027, -8860644, -26273805, -928922, 7355221, -13377612),
+            FE_CONST(-25714182, 5041893, -28904280, -15524663, 30650606, -2952870, -30773733, -12106936, 5130284, 11850181),
+            FE_CONST(16510498, -14739098, -3822213, -15377746, -25617200, 7737542, 33231369, -11238894, -22214113, -13101174),
+        },
+        {
+            FE_CONST(26207936, 15850744, -28531962, 14065220, -7401020, -15289724, -23189631, -4782208, 32197845, 6641181),
+            FE_CONST(-11329741, 14342291, -11044013, 7584389, 17459672, 2345856, 16421236, -1025155, 23625929, -7979935),
+            FE_CONST(-29780071, -4742204, 3083701, -14546963, 32200811, 3498973, -26474449, 1431142, -18698700, 5757691),
+        },
+        {
+            FE_CONST(-28974552, 8642277, 28800851, -9515936, -3300987, 2142241, -26057223, -2406959, -23712367, -5331776),
+            FE_CONST(32258658, 15909644, -25669435, 2656712, -33277779, -2440539, -10331107, 5254930, -25501015, 10739106),
+            FE_CONST(8708797, -8496810, 11839434, 14605987, -17462289, -1448667, 11949319, 8059627, 13314843, -4587253),
+        },
+        {
+            FE_CONST(-28172399, 1658246, -4767066, -3886846, 26752027, 6228089, 12901930, 16123303, -17330499, -13808625),
+            FE_CONST(-30881170, -11597196, 19381794, 517552, -18133739, 15347008, 20409297, -15254296, 15007530, 2276981),
+            FE_CONST(-21185048, 2732272, 30486111, 5693908, 20725545, -4202630, 15365220, -2691595, -25577947, 3620022),
+        },
+    },
+    {
+        {
+            FE_CONST(-28970898, 5271447, -1266009, -9736989, -12455236, 16732599, -4862407, -4906449, 27193557, 6245191),
+            FE_CONST(-15193956, 5362278, -1783893, 2695834, 4960227, 12840725, 23061898, 3260492, 22510453, 8577507),
+            FE_CONST(-12632451, 11257346, -32692994, 13548177, -721004, 10879011, 31168030, 13952092, -29571492, -3635906),
+        },
+        {
+            FE_CONST(3877321, -9572739, 32416692, 5405324, -11004407, -13656635, 3759769, 11935320, 5611860, 8164018),
+            FE_CONST(-16275802, 14667797, 15906460, 12155291, -22111149, -9039718, 32003002, -8832289, 5773085, -8422109),
+            FE_CONST(-23788118, -8254300, 1950875, 8937633, 18686727, 16459170, -905725, 12376320, 31632953, 190926),
+        },
+        {
+            FE_CONST(-24593607, -16138885, -8423991, 13378746, 14162407, 6901328, -8288749, 4508564, -25341555, -3627528),
+            FE_CONST(8884438, -5884009, 6023974, 10104341, -6881569, -4941533, 18722941, -14786005, -1672488, 827625),
+            FE_CONST(-32720583, -16289296, -32503547, 7101210, 13354605, 2659080, -1800575, -14108036, -24878478, 1541286),
+        },
+        {
+            FE_CONST(2901347, -1117687, 3880376, -10059388, -17620940, -3612781, -21802117, -3567481, 20456845, -1885033),
+            FE_CONST(27019610, 12299467, -13658288, -1603234, -12861660, -4861471, -19540150, -5016058, 29439641, 15138866),
+            FE_CONST(21536104, -6626420, -32447818, -10690208, -22408077, 5175814, -5420040, -16361163, 7779328, 109896),
+        },
+        {
+            FE_CONST(30279744, 14648750, -8044871, 6425558, 13639621, -743509, 28698390, 12180118, 23177719, -554075),
+            FE_CONST(26572847, 3405927, -31701700, 12890905, -19265668, 5335866, -6493768, 2378492, 4439158, -13279347),
+            FE_CONST(-22716706, 3489070, -9225266, -332753, 18875722, -1140095, 14819434, -12731527, -17717757, -5461437),
+        },
+        {
+            FE_CONST(-5056483, 16566551, 15953661, 3767752, -10436499, 15627060, -820954, 2177225, 8550082, -15114165),
+            FE_CONST(-18473302, 16596775, -381660, 15663611, 22860960, 15585581, -27844109, -3582739, -23260460, -8428588),
+            FE_CONST(-32480551, 15707275, -8205912, -5652081, 29464558, 2713815, -22725137, 15860482, -21902570, 1494193),
+        },
+        {
+            FE_CONST(-19562091, -14087393, -25583872, -9299552, 13127842, 759709, 21923482, 16529112, 8742704, 12967017),
+            FE_CONST(-28464899, 1553205, 32536856, -10473729, -24691605, -406174, -8914625, -2933896, -29903758, 15553883),
+            FE_CONST(21877909, 3230008, 9881174, 10539357, -4797115, 2841332, 11543572, 14513274, 19375923, -12647961),
+        },
+        {
+            FE_CONST(8832269, -14495485, 13253511, 5137575, 5037871, 4078777, 24880818, -6222716, 2862653, 9455043),
+            FE_CONST(29306751, 5123106, 20245049, -14149889, 9592566, 8447059, -2077124, -2990080, 15511449, 4789663),
+            FE_CONST(-20679756, 7004547, 8824831, -9434977, -4045704, -3750736, -5754762, 108893, 23513200, 16652362),
+        },
+    },
+    {
+        {
+            FE_CONST(-7570426, -524391, 20097620, -16661414, -8606086, -5438902, -2513010, 10337285, 10198951, -1104705),
+            FE_CONST(-6980636, -15417090, 2662804, -16317394, -24179607, 8716369, 17742056, 5985806, 15380671, 2812132),
+            FE_CONST(1759737, -275552, -12102669, 10734975, -32659979, -10917039, -10879009, -14934751, -8530948, 629933),
+        },
+        {
+            FE_CONST(25995253, 15321678, 20676051, -13905342, -5344615, 12928226, 26535743, 5834045, 32469870, 9220744),
+            FE_CONST(-32995849, 11707082, 25397526, -10218086, -24075856, -684171, -15920372, 5550704, 12235466, -3115905),
+            FE_CONST(20957975, 5279561, 23238636, -11021873, 2228468, 5359535, -16683060, 2719281, -33251788, 1049551),
+        },
+        {
+            FE_CONST(7240454, 15271080, 11273695, 2712681, 5348885, 8032711, -7735829, -4293645, 7428075, 13241387),
+            FE_CONST(-27146917, -8315473, -18688646, 12461725, 14323547, 14167305, 19720948, 14642646, -23573131, 3294684),
+            FE_CONST(-13145624, 695982, 29721039, -3953268, 1212790, -3347743, 19469174, -16513750, 3686075, 3532094),
+        },
+        {
+            FE_CONST(-6102612, -15517206, -15274115, -534898, 17071973, -10519397, -28251257, -10304793, -30207362, 3511881),
+            FE_CONST(-32172300, -8555800, 29933543, 8070229, -4587153, -12935436, -6416931, 14179867, -14546646, 2485296),
+            FE_CONST(27907910, 15385928, -10176367, -11095850, -23393364, 13320966, -30011805, -11735988, -22462796, -56256),
+        },
+        {
+            FE_CONST(8172112, -545433, 645285, -11888318, -27963834, 13577339, 29966526, -12436792, -21004912, -5003785),
+            FE_CONST(-10725063, 3964808, 25067649, 15849772, 6962365, -3729815, 11063679, 15714325, 20748469, -6921286),
+            FE_CONST(-17316702, -9815740, 10896567, 9140583, -5406512, -12720840, -5719565, -10454851, -32980692, -3389825),
+        },
+        {
+            FE_CONST(32798541, -9546936, -18551031, -10238786, -16938042, 5657132, 2875422, 4345059, 19486241, 15948449),
+            FE_CONST(-940853, 304405, -17760858, 5130154, -17590137, 12511162, 26577308, 5349209, 11135620, 12621286),
+            FE_CONST(-18044519, -13130609, 2484222, 202566, -17389204, 9997023, 13565515, 445687, -24828319, 16599809),
+        },
+        {
+            FE_CONST(-20703546, 3139196, -20041141, 12406424, -21878464, 14591148, -22751861, 11349075, 29986961, 1524641),
+            FE_CONST(-32288295, 11084683, -25493507, 10998779, 10586397, -8200719, 30732987, -7659157, 12216683, -8191935),
+            FE_CONST(-23282025, -8910792, 32407716, 11905118, -1564687, -15605914, -25800824, -3561742, -23414418, 14292210),
+        },
+        {
+            FE_CONST(-20584495, 15739967, -6829946, 2777159, 29961914, 9932699, 19292707, -451010, -19519450, -14144514),
+            FE_CONST(15964992, 7223198, -12744997, -7519682, 33360822, -4374562, -26678467, -3316604, -20369475, -5652160),
+            FE_CONST(17388308, -71784, -27321053, 10491141, -16512130, 6691084, 15825661, -3737631, -1176112, -6274009),
+        },
+    },
+    {
+        {
+            FE_CONST(-33256173, 4144782, -4476029, -6579123, 10770039, -7155542, -6650416, -12936300, -18319198, 10212860),
+            FE_CONST(2756081, 8598110, 7383731, -6859892, 22312759, -1105012, 21179801, 2600940, -9988298, -12506466),
+            FE_CONST(-24645692, 13317462, -30449259, -15653928, 21365574, -10869657, 11344424, 864440, -2499677, -16710063),
+        },
+        {
+            FE_CONST(-26432803, 6148329, -17184412, -14474154, 18782929, -275997, -22561534, 211300, 2719757, 4940997),
+            FE_CONST(-1323882, 3911313, -6948744, 14759765, -30027150, 7851207, 21690126, 8518463, 26699843, 5276295),
+            FE_CONST(-13149873, -6429067, 9396249, 365013, 24703301, -10488939, 1321586, 149635, -15452774, 7159369),
+        },
+        {
+            FE_CONST(9987780, -3404759, 17507962, 9505530, 9731535, -2165514, 22356009, 8312176, 22477218, -8403385),
+            FE_CONST(18155857, -16504990, 19744716, 9006923, 15154154, -10538976, 24256460, -4864995, -22548173, 9334109),
+            FE_CONST(2986088, -4911893, 10776628, -3473844, 10620590, -7083203, -21413845, 14253545, -22587149, 536906),
+        },
+        {
+            FE_CONST(4377756, 8115836, 24567078, 15495314, 11625074, 13064599, 7390551, 10589625, 10838060, -15420424),
+            FE_CONST(-19342404, 867880, 9277171, -3218459, -14431572, -1986443, 19295826, -15796950, 6378260, 699185),
+            FE_CONST(7895026, 4057113, -7081772, -13077756, -17886831, -323126, -716039, 15693155, -5045064, -13373962),
+        },
+        {
+            FE_CONST(-7737563, -5869402, -14566319, -7406919, 11385654, 13201616, 31730678, -10962840, -3918636, -9669325),
+            FE_CONST(10188286, -15770834, -7336361, 13427543, 22223443, 14896287, 30743455, 7116568, -21786507, 5427593),
+            FE_CONST(696102, 13206899, 27047647, -10632082, 15285305, -9853179, 10798490, -4578720, 19236243, 12477404),
+        },
+        {
+            FE_CONST(-11229439, 11243796, -17054270, -8040865, -788228, -8167967, -3897669, 11180504, -23169516, 7733644),
+            FE_CONST(17800790, -14036179, -27000429, -11766671, 23887827, 3149671, 23466177, -10538171, 10322027, 15313801),
+            FE_CONST(26246234, 11968874, 32263343, -5468728, 6830755, -13323031, -15794704, -101982, -24449242, 10890804),
+        },
+        {
+            FE_CONST(-31365647, 10271363, -12660625, -6267268, 16690207, -13062544, -14982212, 16484931, 25180797, -5334884),
+            FE_CONST(-586574, 10376444, -32586414, -11286356, 19801893, 10997610, 2276632, 9482883, 316878, 13820577),
+            FE_CONST(-9882808, -4510367, -2115506, 16457136, -11100081, 11674996, 30756178, -7515054, 30696930, -3712849),
+        },
+        {
+            FE_CONST(32988917, -9603412, 12499366, 7910787, -10617257, -11931514, -7342816, -9985397, -32349517, 7392473),
+            FE_CONST(-8855661, 15927861, 9866406, -3649411, -2396914, -16655781, -30409476, -9134995, 25112947, -2926644),
+            FE_CONST(-2504044, -436966, 25621774, -5678772, 15085042, -5479877, -24884878, -13526194, 5537438, -13914319),
+        },
+    },
+    {
+        {
+            FE_CONST(5874757, 7110952, 27386301, -11380547, -8031533, -8796840, 32909584, -16548809, -6486255, 10014663),
+            FE_CONST(30546551, -2712447, -23426461, -15295030, -20774639, -10622243, 16328175, -944709, -26611440, 1916188),
+            FE_CONST(25925923, 13655488, 2627647, 14901375, -23353213, -11221248, 16380834, 1006284, -26273228, -8704564),
+        },
+        {
+            FE_CONST(15231383, 12075450, -26181667, -211323, -27161394, 453616, 2361173, 5902990, 26037340, 929186),
+            FE_CONST(-27657394, -9910583, 10876067, 12148310, 2458574, -13347637, -23595449, 212407, -32749716, 14727325),
+            FE_CONST(-20033370, 7423843, 19471986, -3313303, 12913475, -14366080, -22213312, -2811030, 11899473, 8829674),
+        },
+        {
+            FE_CONST(556835, -11698116, -17790351, -3222549, 19994722, 2058336, 25292634, -14832290, 6039490, 2682971),
+            FE_CONST(-12561104, 5164340, 22996126, 5380164, 15799209, 435330, -18707584, -15881285, -7827279, 4602596),
+            FE_CONST(9731920, -14219789, -28351747, -13281777, -13427785, 15765079, 4810584, 7175148, -31275396, -14407984),
+        },
+        {
+            FE_CONST(7337550, 5873052, 10988340, 15232053, 4384079, 6032278, 7402343, -7533815, -26138751, 11939300),
+            FE_CONST(-119159, -14583143, -27421804, 8942753, -17273154, 16514684, 30754115, -9596433, 33487209, 4113918),
+            FE_CONST(-3960789, -9335892, 15011643, 9719616, 31254661, -16703303, 24322161, -11683727, -15224142, 2537614),
+        },
+        {
+            FE_CONST(20099555, 14936171, 23364117, 14619580, -5852236, -12719856, -21635044, -13445871, 31316564, -6566537),
+            FE_CONST(-28506033, 8800916, 3299181, -15204017, 13808514, 16431851, -30593835, -11169019, 28158336, -4820438),
+            FE_CONST(10056483, -10043703, -5907888, -542847, 7266178, -13710209, -6056197, -4651659, 16140026, 788077),
+        },
+        {
+            FE_CONST(-21767061, 7111994, 32290273, -5411863, 16635343, 664496, 15516680, 12515843, -27740733, 14986639),
+            FE_CONST(-28097075, 6401366, -30588780, 8775201, -4481640, 16460358, -29763012, 10636564, -633193, 14808880),
+            FE_CONST(508440, 15431463, 7325714, 11512214, -15362312, -8175573, 32931467, 6671483, 11465440, -8009555),
+        },
+        {
+            FE_CONST(30084687, 2004320, 19741398, 3590690, 10764224, 14473759, 374027, -3464947, -9068434, -11164853),
+            FE_CONST(12404655, 11190203, 6365186, -2562397, 22448540, -9976020, 32879621, 8732224, 5022657, 15043813),
+            FE_CONST(-13119500, -13753593, -14782046, -15193663, 1497751, -7874215, 14549596, -1270179, -28725800, -5263739),
+        },
+        {
+            FE_CONST(-678578, -12898735, 29248392, 15218180, -26007912, -7777208, 20041027, -345609, -25108726, -9825940),
+            FE_CONST(28422467, -8382679, 28591009, -3932530, 28651951, -196633, -20235478, -2839073, -24371998, 2486440),
+            FE_CONST(32216266, 6254487, -7796323, -3906683, 14893713, -9842537, -9999791, 16283784, -33192, 2640168),
+        },
+    },
+    {
+        {
+            FE_CONST(-11225584, 2320285, -9584280, 10149187, -33444663, 5808648, -14876251, -1729667, 31234590, 6090599),
+            FE_CONST(-9633316, 116426, 26083934, 2897444, -6364437, -2688086, 609721, 15878753, -6970405, -9034768),
+            FE_CONST(-27757857, 247744, -15194774, -9002551, 23288161, -10011936, -23869595, 6503646, 20650474, 1804084),
+        },
+        {
+            FE_CONST(-27589786, 15456424, 8972517, 8469608, 15640622, 4439847, 3121995, -10329713, 27842616, -202328),
+            FE_CONST(-15306973, 2839644, 22530074, 10026331, 4602058, 5048462, 28248656, 5031932, -11375082, 12714369),
+            FE_CONST(20807691, -7270825, 29286141, 11421711, -27876523, -13868230, -21227475, 1035546, -19733229, 12796920),
+        },
+        {
+            FE_CONST(12076899, -14301286, -8785001, -11848922, -25012791, 16400684, -17591495, -12899438, 3480665, -15182815),
+            FE_CONST(-32361549, 5457597, 28548107, 7833186, 7303070, -11953545, -24363064, -15921875, -33374054, 2771025),
+            FE_CONST(-21389266, 421932, 26597266, 6860826, 22486084, -6737172, -17137485, -4210226, -24552282, 15673397),
+        },
+        {
+            FE_CONST(-20184622, 2338216, 19788685, -9620956, -4001265, -8740893, -20271184, 4733254, 3727144, -12934448),
+            FE_CONST(6120119, 814863, -11794402, -622716, 6812205, -15747771, 2019594, 7975683, 31123697, -10958981),
+            FE_CONST(30069250, -11435332, 30434654, 2958439, 18399564, -976289, 12296869, 9204260, -16432438, 9648165),
+        },
+        {
+            FE_CONST(32705432, -1550977, 30705658, 7451065, -11805606, 9631813, 3305266, 5248604, -26008332, -11377501),
+            FE_CONST(17219865, 2375039, -31570947, -5575615, -19459679, 9219903, 294711, 15298639, 2662509, -16297073),
+            FE_CONST(-1172927, -7558695, -4366770, -4287744, -21346413, -8434326, 32087529, -1222777, 32247248, -14389861),
+        },
+        {
+            FE_CONST(14312628, 1221556, 17395390, -8700143, -4945741, -8684635, -28197744, -9637817, -16027623, -13378845),
+            FE_CONST(-1428825, -9678990, -9235681, 6549687, -7383069, -468664, 23046502, 9803137, 17597934, 2346211),
+            FE_CONST(18510800, 15337574, 26171504, 981392, -22241552, 7827556, -23491134, -11323352, 3059833, -11782870),
+        },
+        {
+            FE_CONST(10141598, 6082907, 17829293, -1947643, 9830092, 13613136, -25556636, -5544586, -33502212, 3592096),
+            FE_CONST(33114168, -15889352, -26525686, -13343397, 33076705, 8716171, 1151462, 1521897, -982665, -6837803),
+            FE_CONST(-32939165, -4255815, 23947181, -324178, -33072974, -12305637, -16637686, 3891704, 26353178, 693168),
+        },
+        {
+            FE_CONST(30374239, 1595580, -16884039, 13186931, 4600344, 406904, 9585294, -400668, 31375464, 14369965),
+            FE_CONST(-14370654, -7772529, 1510301, 6434173, -18784789, -6262728, 32732230, -13108839, 17901441, 16011505),
+            FE_CONST(18171223, -11934626, -12500402, 15197122, -11038147, -15230035, -19172240, -16046376, 8764035, 12309598),
+        },
+    },
+    {
+        {
+            FE_CONST(7184873, -15884065, -4733995, -8847922, -1636825, 6148438, 65127, -3521018, 32228732, 10657574),
+            FE_CONST(18746717, -11476172, -27193064, 6954600, 12791172, -7111732, 17243081, 4299795, 28465943, -15375283),
+            FE_CONST(13737629, -10164614, 8386336, 6074657, -29227449, -3718492, 10775460, 9999959, -26378316, 14666953),
+        },
+        {
+            FE_CONST(2208029, 4805874, 3925618, 1183512, 26981643, 4334333, -1701752, 13754574, 1841441, 12708077),
+            FE_CONST(23031304, -6170131, -12566090, -6629118, 19467983, 11504761, 19740480, 16022638, 18286074, 4057599),
+            FE_CONST(-21668621, 14107100, -28618275, -176019, 12522715, 11978472, 12683246, -1419312, 5777339, -11161151),
+        },
+        {
+            FE_CONST(-769018, 14942347, -22636759, -525178, -22065010, 16280891, 5550205, -2330944, 28058403, 12392111),
+            FE_CONST(-18229046, 13917377, -23260731, -11983815, -7367542, 11100342, -2180186, -4900950, 27025099, -4379386),
+            FE_CONST(15698557, -2997070, 30133302, -909349, -6930796, -2873392, -1691976, 4028086, -25042463, -5681587),
+        },
+        {
+            FE_CONST(9716706, -4112507, -4529664, 13382375, 21965595, -14757449, 2982314, 7579175, -3486448, -10413430),
+            FE_CONST(30535305, 9719401, 19996283, -1573733, -33221354, 14780613, 18347648, -12081172, 22919350, 4015328),
+            FE_CONST(-21985513, -9213176, 20417023, 11306903, 27239114, -8717671, 10333970, -15316863, -19369844, 3474736),
+        },
+        {
+            FE_CONST(21678587, 1746058, 16240689, 3058346, 9197741, -9348733, -2219518, 8401562, 28390588, -12341697),
+            FE_CONST(17724937, -6252161, 14744055, -12198777, -7246599, -447365, 22310736, 6008392, 1651488, -6198072),
+            FE_CONST(-21810976, -3165770, 33437719, 3709309, -32272096, 10870498, 28944738, 5918309, -15030323, -9047564),
+        },
+        {
+            FE_CONST(-9198219, 4214695, 14427770, 12207969, -28740675, -12156839, -26015121, 8852736, 21096874, -1915925),
+            FE_CONST(-28659806, 13742047, -25020953, -10327545, -18998248, 8132068, -7981723, -5660118, -22375286, 16570687),
+            FE_CONST(17151112, -5698437, -7350293, -10165685, -23801958, -826085, -23734332, -7963379, 367975, 591360),
+        },
+        {
+            FE_CONST(-13047276, -12378252, -11090681, 365708, 32617327, -9403657, -1581245, 3937693, -21353062, -13328105),
+            FE_CONST(-8758281, 1965993, 30865878, 1518895, -9596740, -15568711, -9936220, 5478493, 22253125, -14825767),
+            FE_CONST(7368945, 14678033, -17041558, 1797803, -13722351, 56268, -19815525, 16718455, -26238979, -13915408),
+        },
+        {
+            FE_CONST(11127026, 5058353, 29814084, 14964337, -1055756, -15621957, 24216141, -9191423, -32064374, 1161450),
+            FE_CONST(14219148, 288656, 29501638, 2745224, -25138577, -15671942, -23751995, 10266894, -12734414, 7975199),
+            FE_CONST(3737297, -7008068, -3849571, 10951446, 19400309, -4050745, -26216889, 12815642, -330056, -791047),
+        },
+    },
+    {
+        {
+            FE_CONST(5975908, -5243188, -19459362, -9681747, -11541277, 14015782, -23665757, 1228319, 17544096, -10593782),
+            FE_CONST(5811932, -1715293, 3442887, -2269310, -18367348, -8359541, -18044043, -15410127, -5565381, 12348900),
+            FE_CONST(-31399660, 11407555, 25755363, 6891399, -3256938, 14872274, -24849353, 8141295, -10632534, -585479),
+        },
+        {
+            FE_CONST(-12675304, 694026, -5076145, 13300344, 14015258, -14451394, -9698672, -11329050, 30944593, 1130208),
+            FE_CONST(8247766, -6710942, -26562381, -7709309, -14401939, -14648910, 4652152, 2488540, 23550156, -271232),
+            FE_CONST(17294316, -3788438, 7026748, 15626851, 22990044, 113481, 2267737, -5908146, -408818, -137719),
+        },
+        {
+            FE_CONST(16091085, -16253926, 18599252, 7340678, 2137637, -1221657, -3364161, 14550936, 3260525, -7166271),
+            FE_CONST(-4910104, -13332887, 18550887, 10864893, -16459325, -7291596, -23028869, -13204905, -12748722, 2701326),
+            FE_CONST(-8574695, 16099415, 4629974, -16340524, -20786213, -6005432, -10018363, 9276971, 11329923, 1862132),
+        },
+        {
+            FE_CONST(14763076, -15903608, -30918270, 3689867, 3511892, 10313526, -21951088, 12219231, -9037963, -940300),
+            FE_CONST(8894987, -3446094, 6150753, 3013931, 301220, 15693451, -31981216, -2909717, -15438168, 11595570),
+            FE_CONST(15214962, 3537601, -26238722, -14058872, 4418657, -15230761, 13947276, 10730794, -13489462, -4363670),
+        },
+        {
+            FE_CONST(-2538306, 7682793, 32759013, 263109, -29984731, -7955452, -22332124, -10188635, 977108, 699994),
+            FE_CONST(-12466472, 4195084, -9211532, 550904, -15565337, 12917920, 19118110, -439841, -30534533, -14337913),
+            FE_CONST(31788461, -14507657, 4799989, 7372237, 8808585, -14747943, 9408237, -10051775, 12493932, -5409317),
+        },
+        {
+            FE_CONST(-25680606, 5260744, -19235809, -6284470, -3695942, 16566087, 27218280, 2607121, 29375955, 6024730),
+            FE_CONST(842132, -2794693, -4763381, -8722815, 26332018, -12405641, 11831880, 6985184, -9940361, 2854096),
+            FE_CONST(-4847262, -7969331, 2516242, -5847713, 9695691, -7221186, 16512645, 960770, 12121869, 16648078),
+        },
+        {
+            FE_CONST(-15218652, 14667096, -13336229, 2013717, 30598287, -464137, -31504922, -7882064, 20237806, 2838411),
+            FE_CONST(-19288047, 4453152, 15298546, -16178388, 22115043, -15972604, 12544294, -13470457, 1068881, -12499905),
+            FE_CONST(-9558883, -16518835, 33238498, 13506958, 30505848, -1114596, -8486907, -2630053, 12521378, 4845654),
+        },
+        {
+            FE_CONST(-28198521, 10744108, -2958380, 10199664, 7759311, -13088600, 3409348, -873400, -6482306, -12885870),
+            FE_CONST(-23561822, 6230156, -20382013, 10655314, -24040585, -11621172, 10477734, -1240216, -3113227, 13974498),
+            FE_CONST(12966261, 15550616, -32038948, -1615346, 21025980, -629444, 5642325, 7188737, 18895762, 12629579),
+        },
+    },
+    {
+        {
+            FE_CONST(32848944, 14869187, -32304465, 5534472, 11039196, 5740254, -2934758, -8833159, 27856026, 9081406),
+            FE_CONST(-12649604, 4231155, 22186379, 13513185, 28360494, -3678076, 13136226, 10172232, -18198137, 3756407),
+            FE_CONST(20950123, -9423069, 25144688, -10012895, 22175542, 54021, -4289030, 2542214, -1029927, -16422958),
+        },
+        {
+            FE_CONST(-2996167, -12228049, 23768721, 4029825, 31214093, -6119041, 18178853, 1976855, 18066803, 1578133),
+            FE_CONST(31661618, -10911218, -3537898, 11280430, -2066321, 14335082, -14668934, -13713663, 21817116, 5458167),
+            FE_CONST(-22904939, 6521443, -33251769, -2339570, 28698123, -11677108, 10502673, 3702605, -17157584, -3756454),
+        },
+        {
+            FE_CONST(-25126552, 2261441, 7484961, -11511266, 17746384, 427757, 28563327, 10336595, -511137, -8291405),
+            FE_CONST(32310012, 16136403, 5588409, -10302599, 4540368, 207066, 19571111, -10201196, -1498094, 14015039),
+            FE_CONST(3408964, 170331, -7999388, -12814547, -25217594, -13627509, -30367815, 6237883, -17428652, -1424193),
+        },
+        {
+            FE_CONST(-30583401, -2890881, -27163480, 172985, 9933425, -9760510, 2716365, -7782376, -18662473, 13577818),
+            FE_CONST(-19129770, -15329384, 15177281, -9255746, -25413540, 7358525, 23090983, -13120656, 14859744, -7788452),
+            FE_CONST(-15636196, 655648, 9235246, 14742194, -32888048, 2192264, 12508915, 7376392, -17843516, -3647329),
+        },
+        {
+            FE_CONST(17510178, 2486032, 17342374, -12734851, -3767945, -11023755, 5050104, -14660571, 26982434, 9534086),
+            FE_CONST(-13193752, 979170, -31059206, -8509034, 12341387, -16663612, -12254535, -727211, -8489734, -13479500),
+            FE_CONST(13924363, -14050722, -248356, -2013044, 6447849, 834904, 33341881, 6961646, -26506410, -6330292),
+        },
+        {
+            FE_CONST(-20434804, -4393756, -23763600, -10252451, -32882848, -16373058, -31614109, 2633744, -8185196, 3332403),
+            FE_CONST(12414490, -499219, -3240435, 1982096, 28982280, 13130288, -11200612, 15815289, 32757594, -2578956),
+            FE_CONST(-11770997, 4132053, 17573382, 15149583, -18510479, -5060823, 13950829, -4627781, -29411466, -14381829),
+        },
+        {
+            FE_CONST(10429614, 6389639, -28151961, 11340058, 20929227, 14634338, 27445773, 10590678, -17480994, -5890050),
+            FE_CONST(29359181, 15089315, -24466350, -9524626, -8077419, 15880854, -16191507, -9814408, 14476776, -7721904),
+            FE_CONST(-8161988, 9457828, -13440772, -1821864, 25976571, -15034327, 28156319, -10110121, -29022080, 1914421),
+        },
+        {
+            FE_CONST(14881928, 1929648, -23688957, -6876926, 8802471, -14140571, 31769881, 16723524, 11747879, 13665112),
+            FE_CONST(785476, -625839, 33222759, -15894132, 30045363, -13885328, 5395004, -13118456, -16537803, -15204164),
+            FE_CONST(-104950, 9353132, -20340908, 10673924, 31496315, -15318013, -33222888, 7514244, 23570557, -9721287),
+        },
+    },
+    {
+        {
+            FE_CONST(14741879, -14946887, 22177208, -11721237, 1279741, 8058600, 11758140, 789443, 32195181, 3895677),
+            FE_CONST(10758205, 15755439, -4509950, 9243698, -4879422, 6879879, -2204575, -3566119, -8982069, 4429647),
+            FE_CONST(-2453894, 15725973, -20436342, -10410672, -5803908, -11040220, -7135870, -11642895, 18047436, -15281743),
+        },
+        {
+            FE_CONST(-25173001, -11307165, 29759956, 11776784, -22262383, -15820455, 10993114, -12850837, -17620701, -9408468),
+            FE_CONST(21987233, 700364, -24505048, 14972008, -7774265, -5718395, 32155026, 2581431, -29958985, 8773375),
+            FE_CONST(-25568350, 454463, -13211935, 16126715, 25240068, 8594567, 20656846, 12017935, -7874389, -13920155),
+        },
+        {
+            FE_CONST(6028182, 6263078, -31011806, -11301710, -818919, 2461772, -31841174, -5468042, -1721788, -2776725),
+            FE_CONST(-12278994, 16624277, 987579, -5922598, 32908203, 1248608, 7719845, -4166698, 28408820, 6816612),
+            FE_CONST(-10358094, -8237829, 19549651, -12169222, 22082623, 16147817, 20613181, 13982702, -10339570, 5067943),
+        },
+        {
+            FE_CONST(-30505967, -3821767, 12074681, 13582412, -19877972, 2443951, -19719286, 12746132, 5331210, -10105944),
+            FE_CONST(30528811, 3601899, -1957090, 4619785, -27361822, -15436388, 24180793, -12570394, 27679908, -1648928),
+            FE_CONST(9402404, -13957065, 32834043, 10838634, -26580150, -13237195, 26653274, -8685565, 22611444, -12715406),
+        },
+        {
+            FE_CONST(22190590, 1118029, 22736441, 15130463, -30460692, -5991321, 19189625, -4648942, 4854859, 6622139),
+            FE_CONST(-8310738, -2953450, -8262579, -3388049, -10401731, -271929, 13424426, -3567227, 26404409, 13001963),
+            FE_CONST(-31241838, -15415700, -2994250, 8939346, 11562230, -12840670, -26064365, -11621720, -15405155, 11020693),
+        },
+        {
+            FE_CONST(1866042, -7949489, -7898649, -10301010, 12483315, 13477547, 3175636, -12424163, 28761762, 1406734),
+            FE_CONST(-448555, -1777666, 13018551, 3194501, -9580420, -11161737, 24760585, -4347088, 25577411, -13378680),
+            FE_CONST(-24290378, 4759345, -690653, -1852816, 2066747, 10693769, -29595790, 9884936, -9368926, 4745410),
+        },
+        {
+            FE_CONST(-9141284, 6049714, -19531061, -4341411, -31260798, 9944276, -15462008, -11311852, 10931924, -11931931),
+            FE_CONST(-16561513, 14112680, -8012645, 4817318, -8040464, -11414606, -22853429, 10856641, -20470770, 13434654),
+            FE_CONST(22759489, -10073434, -16766264, -1871422, 13637442, -10168091, 1765144, -12654326, 28445307, -5364710),
+        },
+        {
+            FE_CONST(29875063, 12493613, 2795536, -3786330, 1710620, 15181182, -10195717, -8788675, 9074234, 1167180),
+            FE_CONST(-26205683, 11014233, -9842651, -2635485, -26908120, 7532294, -18716888, -9535498, 3843903, 9367684),
+            FE_CONST(-10969595, -6403711, 9591134, 9582310, 11349256, 108879, 16235123, 8601684, -139197, 4242895),
+        },
+    },
+    {
+        {
+            FE_CONST(-6069670, -5052251, -5462350, -15363256, -21086622, 10493066, -4240204, 10782758, 19715924, -10609716),
+            FE_CONST(-20837039, 11879200, -28543308, -9107892, -15126666, -36018, 4729185, -11056419, -9260288, -14375140),
+            FE_CONST(-32242881, -1949709, -2333073, -12442631, -3258303, -14955346, -33321070, 15757667, 12526404, -13498899),
+        },
+        {
+            FE_CONST(738455, 15209961, 21522471, 13794043, -18272072, 14800413, 30429911, -7705559, 27832414, -1931956),
+            FE_CONST(7453038, 1368394, -29924865, -10811872, -8062337, -13351933, -22238829, 9010656, -16295049, 2678542),
+            FE_CONST(-19900866, -8627185, 3435928, -7976663, -29672159, -8117016, 32080383, 11402077, -29170196, -3492341),
+        },
+        {
+            FE_CONST(-16626749, 2417754, 33249389, -9811327, -29776058, 6245162, 24518258, -8872034, 32127821, 1670554),
+            FE_CONST(-17078794, -6058641, -25942028, 4690837, 15161979, 16163792, 6736582, -3297897, 1522395, 6083038),
+            FE_CONST(20110157, 2863573, -9031360, -14541031, -18766188, -5769962, -4019862, -8320702, -3996712, 6731694),
+        },
+        {
+            FE_CONST(-3991660, -9527471, 10802081, -222831, 9552676, 1668152, 32465931, -9801628, 25695594, 10570178),
+            FE_CONST(-1386077, 3332181, 7198948, -358053, 22465318, 168113, 28159978, -2337220, -15485647, 12543796),
+            FE_CONST(-551221, -11413806, 32145656, 10133860, -11854144, -14354305, -23987682, 3851704, 24621200, -6994241),
+        },
+        {
+            FE_CONST(30788031, 9648360, 9186580, -1538053, -17965427, -2943377, -10018285, 4678129, 9767830, -10927632),
+            FE_CONST(11190930, -5329963, -12253015, -10119901, -2369088, 2871273, -24269397, -15996154, -13033224, -15547248),
+            FE_CONST(24198774, -4444684, -7437759, 13151704, 13959055, 14276941, -25834619, -10853590, -3171068, -7607434),
+        },
+        {
+            FE_CONST(-3258969, -1107846, 13617051, -11682071, -13259561, -10031320, 5628962, 14824464, -17458055, -4514030),
+            FE_CONST(26779764, -10117419, -3884841, 7631434, 24902215, -14153592, -6937947, 1596055, 10102388, 8633413),
+            FE_CONST(-16144222, -1353508, -3168799, 7414019, -31826021, 3514682, -8518921, -15534058, 25911198, 5742629),
+        },
+        {
+            FE_CONST(-5217833, 8080727, 14682554, -8609568, 17526836, -7982066, 3072255, 8940582, 19981658, -10826958),
+            FE_CONST(4072283, -8659133, 31253685, -135014, 28370694, -3816665, -26174953, -1623825, -7790558, 544083),
+            FE_CONST(-20986443, -1611350, 7152575, -5964046, 773770, -6057817, 32307559, 7108196, -4688051, -1080814),
+        },
+        {
+            FE_CONST(-16254428, -4363307, 22954637, -1086624, -33161422, -5987332, -17684638, -6201010, -10761944, -3138478),
+            FE_CONST(-12626493, 7542435, -28044909, -14024969, 1591133, 11995702, 13303707, 12795301, 21854370, 8234601),
+            FE_CONST(-1578358, 10796253, -12174098, 9852963, 10851551, -14200866, 3317610, -13843590, 4680659, 12478641),
+        },
+    },
+    {
+        {
+            FE_CONST(22092954, -13191123, -2042793, -11968512, 32186753, -11517388, -6574341, 2470660, -27417366, 16625501),
+            FE_CONST(-11057722, 3042016, 13770083, -9257922, 584236, -544855, -7770857, 2602725, -27351616, 14247413),
+            FE_CONST(6314175, -10264892, -32772502, 15957557, -10157730, 168750, -8618807, 14290061, 27108877, -1180880),
+        },
+        {
+            FE_CONST(-8586597, -7170966, 13241782, 10960156, -32991015, -13794596, 33547976, -11058889, -27148451, 981874),
+            FE_CONST(22833440, 9293594, -32649448, -13618667, -9136966, 14756819, -22928859, -13970780, -10479804, -16197962),
+            FE_CONST(-7768587, 3326786, -28111797, 10783824, 19178761, 14905060, 22680049, 13906969, -15933690, 3797899),
+        },
+        {
+            FE_CONST(21721356, -4212746, -12206123, 9310182, -3882239, -13653110, 23740224, -2709232, 20491983, -8042152),
+            FE_CONST(9209270, -15135055, -13256557, -6167798, -731016, 15289673, 25947805, 15286587, 30997318, -6703063),
+            FE_CONST(7392032, 16618386, 23946583, -8039892, -13265164, -1533858, -14197445, -2321576, 17649998, -250080),
+        },
+        {
+            FE_CONST(-9301088, -14193827, 30609526, -3049543, -25175069, -1283752, -15241566, -9525724, -2233253, 7662146),
+            FE_CONST(-17558673, 1763594, -33114336, 15908610, -30040870, -12174295, 7335080, -8472199, -3174674, 3440183),
+            FE_CONST(-19889700, -5977008, -24111293, -9688870, 10799743, -16571957, 40450, -4431835, 4862400, 1133),
+        },
+        {
+            FE_CONST(-32856209, -7873957, -5422389, 14860950, -16319031, 7956142, 7258061, 311861, -30594991, -7379421),
+            FE_CONST(-3773428, -1565936, 28985340, 7499440, 24445838, 9325937, 29727763, 16527196, 18278453, 15405622),
+            FE_CONST(-4381906, 8508652, -19898366, -3674424, -5984453, 15149970, -13313598, 843523, -21875062, 13626197),
+        },
+        {
+            FE_CONST(2281448, -13487055, -10915418, -2609910, 1879358, 16164207, -10783882, 3953792, 13340839, 15928663),
+            FE_CONST(31727126, -7179855, -18437503, -8283652, 2875793, -16390330, -25269894, -7014826, -23452306, 5964753),
+            FE_CONST(4100420, -5959452, -17179337, 6017714, -18705837, 12227141, -26684835, 11344144, 2538215, -7570755),
+        },
+        {
+            FE_CONST(-9433605, 6123113, 11159803, -2156608, 30016280, 14966241, -20474983, 1485421, -629256, -15958862),
+            FE_CONST(-26804558, 4260919, 11851389, 9658551, -32017107, 16367492, -20205425, -13191288, 11659922, -11115118),
+            FE_CONST(26180396, 10015009, -30844224, -8581293, 5418197, 9480663, 2231568, -10170080, 33100372, -1306171),
+        },
+        {
+            FE_CONST(15121113, -5201871, -10389905, 15427821, -27509937, -15992507, 21670947, 4486675, -5931810, -14466380),
+            FE_CONST(16166486, -9483733, -11104130, 6023908, -31926798, -1364923, 2340060, -16254968, -10735770, -10039824),
+            FE_CONST(28042865, -3557089, -12126526, 12259706, -3717498, -6945899, 6766453, -8689599, 18036436, 5803270),
+        },
+    },
+    {
+        {
+            FE_CONST(22514622, -9142449, 2166950, -6940349, 11376442, 13509235, -33293707, -9958222, 5161867, 2412512),
+            FE_CONST(-5883134, 12235213, 11132467, 15344146, 11665129, -6953919, 4018212, 2010037, -31830517, -16465592),
+            FE_CONST(21587062, 14311011, 24712437, 16246189, -33257813, -11299725, -32933954, 10704060, 6677587, 2094364),
+        },
+        {
+            FE_CONST(-18290749, 8672615, 5547528, -11754940, -3537207, -8236827, 30807836, -14773950, 9784229, 338920),
+            FE_CONST(26029005, 986953, -18351861, 7174918, 6031977, -9816191, -1774815, -10191038, -6059200, 7371135),
+            FE_CONST(-5020052, 6668295, 26687846, 9592831, 13369729, 8921916, -7811955, 7111975, -10234643, 10773009),
+        },
+        {
+            FE_CONST(1750782, -11669265, 4726644, 10119869, 718929, 10871286, -6681860, 3219099, -16724792, -10120239),
+            FE_CONST(4959226, -15072905, 26746984, 15903927, 11556605, -6611653, -8187301, -2579591, 17439217, 16480865),
+            FE_CONST(17393683, 8963403, 20110473, 13337651, 24126229, 11533166, -19200733, -5162010, 2065776, -10599081),
+        },
+        {
+            FE_CONST(1566649, 5953730, -33237314, -15081047, -33410651, 13562370, 21765546, 6858313, 8692869, -11599288),
+            FE_CONST(-18822673, 9680709, 5436102, 7311888, 18492958, 16085950, 18594642, -14335181, -15144673, 7995124),
+            FE_CONST(30126015, -16441220, -23283109, -5010676, 9204919, 10837144, -21288079, 12501360, 25340489, 16405875),
+        },
+        {
+            FE_CONST(29047378, 8190936, -14166681, -14060087, -29700094, 12656501, -13146596, 9696956, 23228220, -6998534),
+            FE_CONST(-19835853, -2828400, -32211822, -11506796, -12462683, 14574472, 32050901, 12494879, 8189001, 5282082),
+            FE_CONST(8203499, -13371561, 26688685, 16169406, -32785729, -413524, -1199767, -4756447, 3883865, 2993835),
+        },
+        {
+            FE_CONST(-16733893, 11449742, -26319863, 10408893, -17301361, -12929270, -8281294, 8542988, 4786208, 75191),
+            FE_CONST(-31261013, -7671070, -30019747, 11957701, 18733193, 14943924, 21585529, 10494795, 24661569, -744192),
+            FE_CONST(-25271456, -13753487, 10584975, -13342556, 1909073, 903984, -16925281, -10193879, 28588036, 4329724),
+        },
+        {
+            FE_CONST(-14391122, -2503815, 19937966, -9593691, -12096980, -9908242, 28081993, 4004783, 13948268, -816869),
+            FE_CONST(-10324259, 4265294, -6604609, 7256867, -13015978, -13210822, -13719409, 14193247, -18536807, 4545838),
+            FE_CONST(-8339866, -15981664, -26020065, 5875023, 24965859, -3396820, 11591322, 13509397, -5002833, -3931880),
+        },
+        {
+            FE_CONST(27093406, -911231, -3329016, -15936755, 9290559, -8241685, -14841576, 9033888, -17137912, 7629846),
+            FE_CONST(1807870, 5197188, 9490047, -3507334, -1327922, -15342237, 12169160, -4969782, 17140545, -94266),
+            FE_CONST(23852594, -7238535, 5530489, 8614556, -11671892, -12577138, 6471427, -14906965, -30915538, -10909350),
+        },
+    },
+    {
+        {
+            FE_CONST(-817581, 6763912, 11803561, 1585585, 10958447, -2671165, 23855391, 4598332, -6159431, -14117438),
+            FE_CONST(-31031306, -14256194, 17332029, -2383520, 31312682, -5967183, 696309, 50292, -20095739, 11763584),
+            FE_CONST(-594563, -2514283, -32234153, 12643980, 12650761, 14811489, 665117, -12613632, -19773211, -10713562),
+        },
+        {
+            FE_CONST(30464590, -11262872, -4127476, -12734478, 19835327, -7105613, -24396175, 2075773, -17020157, 992471),
+            FE_CONST(18357185, -6994433, 7766382, 16342475, -29324918, 411174, 14578841, 8080033, -11574335, -10601610),
+            FE_CONST(19598397, 10334610, 12555054, 2555664, 18821899, -10339780, 21873263, 16014234, 26224780, 16452269),
+        },
+        {
+            FE_CONST(-30223925, 5145196, 5944548, 16385966, 3976735, 2009897, -11377804, -7618186, -20533829, 3698650),
+            FE_CONST(14187449, 3448569, -10636236, -10810935, -22663880, -3433596, 7268410, -10890444, 27394301, 12015369),
+            FE_CONST(19695761, 16087646, 28032085, 12999827, 6817792, 11427614, 20244189, -1312777, -13259127, -3402461),
+        },
+        {
+            FE_CONST(30860103, 12735208, -1888245, -4699734, -16974906, 2256940, -8166013, 12298312, -8550524, -10393462),
+            FE_CONST(-5719826, -11245325, -1910649, 15569035, 26642876, -7587760, -5789354, -15118654, -4976164, 12651793),
+            FE_CONST(-2848395, 9953421, 11531313, -5282879, 26895123, -12697089, -13118820, -16517902, 9768698, -2533218),
+        },
+        {
+            FE_CONST(-24719459, 1894651, -287698, -4704085, 15348719, -8156530, 32767513, 12765450, 4940095, 10678226),
+            FE_CONST(18860224, 15980149, -18987240, -1562570, -26233012, -11071856, -7843882, 13944024, -24372348, 16582019),
+            FE_CONST(-15504260, 4970268, -29893044, 4175593, -20993212, -2199756, -11704054, 15444560, -11003761, 7989037),
+        },
+        {
+            FE_CONST(31490452, 5568061, -2412803, 2182383, -32336847, 4531686, -32078269, 6200206, -19686113, -14800171),
+            FE_CONST(-17308668, -15879940, -31522777, -2831, -32887382, 16375549, 8680158, -16371713, 28550068, -6857132),
+            FE_CONST(-28126887, -5688091, 16837845, -1820458, -6850681, 12700016, -30039981, 4364038, 1155602, 5988841),
+        },
+        {
+            FE_CONST(21890435, -13272907, -12624011, 12154349, -7831873, 15300496, 23148983, -4470481, 24618407, 8283181),
+            FE_CONST(-33136107, -10512751, 9975416, 6841041, -31559793, 16356536, 3070187, -7025928, 1466169, 10740210),
+            FE_CONST(-1509399, -15488185, -13503385, -10655916, 32799044, 909394, -13938903, -5779719, -32164649, -15327040),
+        },
+        {
+            FE_CONST(3960823, -14267803, -28026090, -15918051, -19404858, 13146868, 15567327, 951507, -3260321, -573935),
+            FE_CONST(24740841, 5052253, -30094131, 8961361, 25877428, 6165135, -24368180, 14397372, -7380369, -6144105),
+            FE_CONST(-28888365, 3510803, -28103278, -1158478, -11238128, -10631454, -15441463, -14453128, -1625486, -6494814),
+        },
+    },
+    {
+        {
+            FE_CONST(30119711, -9784270, 21311901, -11731286, 4545195, -5268616, -7194613, -13285313, -24895243, 8364851),
+            FE_CONST(529615, -9340280, -18344979, -16036583, -32500516, -3623762, -9921389, 12824930, -16870557, 131951),
+            FE_CONST(837674, 6366159, -3502508, 1326053, 14882179, 5587264, -26143641, -5363199, -32492502, 1085539),
+        },
+        {
+            FE_CONST(8479303, 1252296, -17667299, -4777089, -29963573, -12038778, 12659471, -8719634, 16278315, 2131977),
+            FE_CONST(-786593, -8743829, -15249100, -13009385, -26325342, 7257437, 6671327, -9722489, 4813412, 4535646),
+            FE_CONST(-14947165, 7266075, -26298784, -9554087, 22340862, -4791061, -23852980, -2854366, 14275706, 7033170),
+        },
+        {
+            FE_CONST(-1442074, -419004, -14601202, 58052, -22950679, -423596, 10928135, 4916762, -9667792, -16303774),
+            FE_CONST(10111229, 10446862, -18622037, -11217982, -20037997, 14388845, 12258710, 8943835, 29136865, 14105927),
+            FE_CONST(-26165195, -15797898, -25113802, 8706189, -5531152, -8900645, 6223962, 1200883, 2084980, -7046968),
+        },
+        {
+            FE_CONST(-16994639, 15280136, 22189231, -8986236, 31096112, 248622, 8877467, 5184062, 31974465, -16619719),
+            FE_CONST(-13580849, -10411780, 25270984, 11606798, 20140754, 8660652, 7503954, -2261550, -3044331, 2872438),
+            FE_CONST(-28237316, 6525923, 33293145, 2547665, 32946773, 4394489, 5572331, -610204, -28130141, -6698486),
+        },
+        {
+            FE_CONST(21420854, 2996234, -11078219, 13883690, 7353236, 14501979, 6565171, -10751863, -27457930, -229631),
+            FE_CONST(7063979, -7832266, 33378537, -870413, -19582481, -5389779, 17961664, -5824273, -29254767, 7001328),
+            FE_CONST(27174589, -7944692, -31761634, 4313360, 79392, 3821387, -11202876, -6125701, -26346080, -13179249),
+        },
+        {
+            FE_CONST(-4752261, 12594931, -16172245, -11235444, -8981998, 2677172, -8366241, -1585249, 29908274, -9206623),
+            FE_CONST(27002709, -1274130, 32461213, -9558104, 14096220, -6598461, -15242889, -4968508, 24021301, 14205308),
+            FE_CONST(11582971, -5911706, -3447241, 3499319, 32917532, 9069983, 25721928, 4635854, -26280464, -12326133),
+        },
+        {
+            FE_CONST(-17544753, 13050302, -23354069, 5306454, 21416865, 9327901, 15046741, 13391872, 26496835, -5725363),
+            FE_CONST(-7860371, 15367383, 16277114, 6739999, -4739052, -1003101, -11792387, 9737491, -21314077, -14249287),
+            FE_CONST(10961139, 12893057, 3048727, -1253772, 5293295, 12651584, -19205516, -5542305, 26438365, -852282),
+        },
+        {
+            FE_CONST(3598048, 5152435, 31306191, -14947645, -1578273, 14808293, -3454627, 9422666, -1051148, 7361217),
+            FE_CONST(-7767763, 7827611, 13407330, 3592841, 7127763, -15398823, -4348312, 8454549, 32616457, 7835919),
+            FE_CONST(11031204, -14748603, -25828563, -7306841, 22994355, -6459910, 15573512, 9596005, 25601393, -8662791),
+        },
+    },
+    {
+        {
+            FE_CONST(793299, -9230478, 8836302, -6235707, -27360908, -2369593, 33152843, -4885251, -9906200, -621852),
+            FE_CONST(5666233, 525582, 20782575, -8038419, -24538499, 14657740, 16099374, 1468826, -6171428, -15186581),
+            FE_CONST(-4859255, -3779343, -2917758, -6748019, 7778750, 11688288, -30404353, -9871238, -1558923, -9863646),
+        },
+        {
+            FE_CONST(10896332, -7719704, 824275, 472601, -19460308, 3009587, 25248958, 14783338, -30581476, -15757844),
+            FE_CONST(10566929, 12612572, -31944212, 11118703, -12633376, 12362879, 21752402, 8822496, 24003793, 14264025),
+            FE_CONST(27713862, -7355973, -11008240, 9227530, 27050101, 2504721, 23886875, -13117525, 13958495, -5732453),
+        },
+        {
+            FE_CONST(-23481610, 4867226, -27247128, 3900521, 29838369, -8212291, -31889399, -10041781, 7340521, -15410068),
+            FE_CONST(4646514, -8011124, -22766023, -11532654, 23184553, 8566613, 31366726, -1381061, -15066784, -10375192),
+            FE_CONST(-17270517, 12723032, -16993061, 14878794, 21619651, -6197576, 27584817, 3093888, -8843694, 3849921),
+        },
+        {
+            FE_CONST(-9064912, 2103172, 25561640, -15125738, -5239824, 9582958, 32477045, -9017955, 5002294, -15550259),
+            FE_CONST(-12057553, -11177906, 21115585, -13365155, 8808712, -12030708, 16489530, 13378448, -25845716, 12741426),
+            FE_CONST(-5946367, 10645103, -30911586, 15390284, -3286982, -7118677, 24306472, 15852464, 28834118, -7646072),
+        },
+        {
+            FE_CONST(-17335748, -9107057, -24531279, 9434953, -8472084, -583362, -13090771, 455841, 20461858, 5491305),
+            FE_CONST(13669248, -16095482, -12481974, -10203039, -14569770, -11893198, -24995986, 11293807, -28588204, -9421832),
+            FE_CONST(28497928, 6272777, -33022994, 14470570, 8906179, -1225630, 18504674, -14165166, 29867745, -8795943),
+        },
+        {
+            FE_CONST(-16207023, 13517196, -27799630, -13697798, 24009064, -6373891, -6367600, -13175392, 22853429, -4012011),
+            FE_CONST(24191378, 16712145, -13931797, 15217831, 14542237, 1646131, 18603514, -11037887, 12876623, -2112447),
+            FE_CONST(17902668, 4518229, -411702, -2829247, 26878217, 5258055, -12860753, 608397, 16031844, 3723494),
+        },
+        {
+            FE_CONST(-28632773, 12763728, -20446446, 7577504, 33001348, -13017745, 17558842, -7872890, 23896954, -4314245),
+            FE_CONST(-20005381, -12011952, 31520464, 605201, 2543521, 5991821, -2945064, 7229064, -9919646, -8826859),
+            FE_CONST(28816045, 298879, -28165016, -15920938, 19000928, -1665890, -12680833, -2949325, -18051778, -2082915),
+        },
+        {
+            FE_CONST(16000882, -344896, 3493092, -11447198, -29504595, -13159789, 12577740, 16041268, -19715240, 7847707),
+            FE_CONST(10151868, 10572098, 27312476, 7922682, 14825339, 4723128, -32855931, -6519018, -10020567, 3852848),
+            FE_CONST(-11430470, 15697596, -21121557, -4420647, 5386314, 15063598, 16514493, -15932110, 29330899, -15076224),
+        },
+    },
+    {
+        {
+            FE_CONST(23839531, -1616502, 30191244, 10928297, -26946045, 3795407, -19357780, 3675677, -24296558, -12062547),
+            FE_CONST(-4379010, -4481858, -1454303, 11568342, 1526211, -12474204, -25222435, 5304748, -26097292, -15529886),
+            FE_CONST(31631775, -768539, 5383026, -16164005, 7420284, 2405746, 7571514, -10957978, -24853259, -4608392),
+        },
+        {
+            FE_CONST(831643, -15219650, 2764144, 14858017, 30256467, 15702468, -15707421, -1550249, -20170233, -8572415),
+            FE_CONST(-14818991, 9958291, 310270, 4131042, -10418429, 7642248, -27663318, -4250453, 26806497, 11838609),
+            FE_CONST(17257197, -9290657, 16782189, -3785737, -31427699, -10290716, -24479698, -5695369, 22801425, -6572681),
+        },
+        {
+            FE_CONST(-3537795, -8588685, 32341526, 6267561, -33091893, 7561108, 17340066, 9542139, 7856640, 8162947),
+            FE_CONST(-5109603, 2650243, -25014361, -15944089, -33420076, 9949972, -8010186, -1828715, -4182008, 12235747),
+            FE_CONST(29103472, -11428103, -26108345, 1076694, 1002340, 16375966, 21844350, -7731990, -14036148, 2163452),
+        },
+        {
+            FE_CONST(-13114133, -13100320, 26827179, 4173643, -30210690, -10912305, -28977046, 104197, -33159356, 9546751),
+            FE_CONST(1094279, -8467081, -28070098, 7005184, 10247599, -5093115, -22940572, 5165032, -31908780, 791511),
+            FE_CONST(-1813727, 2333247, -33143045, 4589243, -31971883, -11924170, 25819077, 6597075, -20613827, 9871603),
+        },
+        {
+            FE_CONST(22197986, -2520498, 13595618, 7358881, 13593976, 655068, -23947797, 1654761, -10727314, 1767492),
+            FE_CONST(-19392911, 9163324, 31932932, -15049634, 25755397, 2222320, -30538527, 12977091, 33335170, -835946),
+            FE_CONST(-30788494, -8033682, -2522285, 11686552, 8918065, 12324350, 20726420, 14922996, 10592750, -8779300),
+        },
+        {
+            FE_CONST(-30172044, 12190353, -10699520, -13287424, 13655366, 4230318, -13725810, 12437137, -20576836, 11741793),
+            FE_CONST(25782876, 9724139, -27343192, -2147221, -6185748, 10706789, -8835127, 2114957, -4999061, 2572605),
+            FE_CONST(25017985, -11055802, -753754, -11247832, 8515772, 5957912, 32271769, -5782334, 24278850, -1521292),
+        },
+        {
+            FE_CONST(-30800022, 10436704, 19651994, 16298418, -10608222, -7195674, -15894455, -3372459, -15221989, 11083384),
+            FE_CONST(23985653, -5345548, 17119751, 12461245, -24636067, -973208, -26954924, 3150286, -7265380, -13308822),
+            FE_CONST(-2414832, -4480115, -7031860, 16168482, 6447443, 7438648, -32415031, -2919292, -7715930, 10401109),
+        },
+        {
+            FE_CONST(-28899460, 10442980, 735595, -16186098, -29958834, -1180211, -15784250, 15968916, -9108559, 2098511),
+            FE_CONST(20254068, -4762939, 3597545, 4682921, -12517585, -7966005, -14996214, -12821234, -530471, -12305822),
+            FE_CONST(-29436957, -5806909, 14965685, -7443707, 16048572, -5615898, -2708385, 15030531, 22347379, 9370165),
+        },
+    },
+    {
+        {
+            FE_CONST(-25499735, -4378794, -15222908, -6901211, 16615731, 2051784, 3303702, 15490, -27548796, 12314391),
+            FE_CONST(15683520, -6003043, 18109120, -9980648, 15337968, -5997823, -16717435, 15921866, 16103996, -3731215),
+            FE_CONST(-23169824, -10781249, 13588192, -1628807, -3798557, -1074929, -19273607, 5402699, -29815713, -9841101),
+        },
+        {
+            FE_CONST(23190676, 2384583, -32714340, 3462154, -29903655, -1529132, -11266856, 8911517, -25205859, 2739713),
+            FE_CONST(21374101, -3554250, -33524649, 9874411, 15377179, 11831242, -33529904, 6134907, 4931255, 11987849),
+            FE_CONST(-7732, -2978858, -16223486, 7277597, 105524, -322051, -31480539, 13861388, -30076310, 10117930),
+        },
+        {
+            FE_CONST(-29501170, -10744872, -26163768, 13051539, -25625564, 5089643, -6325503, 6704079, 12890019, 15728940),
+            FE_CONST(-21972360, -11771379, -951059, -4418840, 14704840, 2695116, 903376, -10428139, 12885167, 8311031),
+            FE_CONST(-17516482, 5352194, 10384213, -13811658, 7506451, 13453191, 26423267, 4384730, 1888765, -5435404),
+        },
+        {
+            FE_CONST(-25817338, -3107312, -13494599, -3182506, 30896459, -13921729, -32251644, -12707869, -19464434, -3340243),
+            FE_CONST(-23607977, -2665774, -526091, 4651136, 5765089, 4618330, 6092245, 14845197, 17151279, -9854116),
+            FE_CONST(-24830458, -12733720, -15165978, 10367250, -29530908, -265356, 22825805, -7087279, -16866484, 16176525),
+        },
+        {
+            FE_CONST(-23583256, 6564961, 20063689, 3798228, -4740178, 7359225, 2006182, -10363426, -28746253, -10197509),
+            FE_CONST(-10626600, -4486402, -13320562, -5125317, 3432136, -6393229, 23632037, -1940610, 32808310, 1099883),
+            FE_CONST(15030977, 5768825, -27451236, -2887299, -6427378, -15361371, -15277896, -6809350, 2051441, -15225865),
+        },
+        {
+            FE_CONST(-3362323, -7239372, 7517890, 9824992, 23555850, 295369, 5148398, -14154188, -22686354, 16633660),
+            FE_CONST(4577086, -16752288, 13249841, -15304328, 19958763, -14537274, 18559670, -10759549, 8402478, -9864273),
+            FE_CONST(-28406330, -1051581, -26790155, -907698, -17212414, -11030789, 9453451, -14980072, 17983010, 9967138),
+        },
+        {
+            FE_CONST(-25762494, 6524722, 26585488, 9969270, 24709298, 1220360, -1677990, 7806337, 17507396, 3651560),
+            FE_CONST(-10420457, -4118111, 14584639, 15971087, -15768321, 8861010, 26556809, -5574557, -18553322, -11357135),
+            FE_CONST(2839101, 14284142, 4029895, 3472686, 14402957, 12689363, -26642121, 8459447, -5605463, -7621941),
+        },
+        {
+            FE_CONST(-4839289, -3535444, 9744961, 2871048, 25113978, 3187018, -25110813, -849066, 17258084, -7977739),
+            FE_CONST(18164541, -10595176, -17154882, -1542417, 19237078, -9745295, 23357533, -15217008, 26908270, 12150756),
+            FE_CONST(-30264870, -7647865, 5112249, -7036672, -1499807, -6974257, 43168, -5537701, -32302074, 16215819),
+        },
+    },
+    {
+        {
+            FE_CONST(4863460, 14069888, 16285550, 1692464, 13072445, -14101095, -20389917, 10588017, -27305040, -11077015),
+            FE_CONST(-294417, 2704020, 1566698, 4841377, -20479788, 11152593, 21433955, -12053643, -31481288, 13143650),
+            FE_CONST(-2409006, 1487693, -21216864, -1833630, 280270, -7803925, 23803448, -8804078, -15314800, -2344265),
+        },
+        {
+            FE_CONST(5271993, 15573096, -1614278, 13741208, 8920470, 8512526, 11834556, 15322080, 15231907, 5962612),
+            FE_CONST(-28407331, 8288280, -14225270, -138294, -16675828, 10897757, 20597419, 8350628, 30016864, 2529749),
+            FE_CONST(2570165, -13429813, -18846758, 6385254, 17751672, 12860915, 286247, 14157436, 984918, 1771233),
+        },
+        {
+            FE_CONST(-16613265, -5791769, -20443842, 5415913, -13631990, 4393321, 30684377, -13744206, 13893159, -15016221),
+            FE_CONST(-7800713, 2716073, -19558703, 10941846, 697776, -7591176, 16359822, -2437991, 22366751, 14197005),
+            FE_CONST(-25236493, 4727232, -24707792, -13010293, 20113840, -9504023, -32815703, -6872159, 17054083, -8747804),
+        },
+        {
+            FE_CONST(30650370, 13564213, 17829349, 13324366, -20991793, 12371149, -4599212, -13541268, -24877534, 9115365),
+            FE_CONST(7352052, 9905981, -26891998, 16537902, 18121436, 2092926, 9966376, -10131869, 24939823, -6965722),
+            FE_CONST(-12744391, 3293073, -3532437, -9218964, -31030483, -278949, 21670277, 2150201, 23910396, 3246488),
+        },
+        {
+            FE_CONST(-764732, -991617, -17944068, -7893722, 18257574, 13850901, 17791965, 3298706, 30048706, -16039389),
+            FE_CONST(7976498, -5373294, 4039680, -9283887, 26106314, 8398266, -2602597, 15795833, 7289905, -14914941),
+            FE_CONST(1462681, 8637928, 6844923, -4307705, 2845550, 7727136, 33488484, 14476319, -25116128, 7588603),
+        },
+        {
+            FE_CONST(-20954814, -10779007, 18862854, 2022087, -29103822, 11635649, 24829550, -7552968, 16914092, -6178766),
+            FE_CONST(-10353985, -8620115, -11224996, 5150484, -28665864, 651732, -14386306, -13946973, 5323717, -2946256),
+            FE_CONST(21206458, -9521431, 13452278, -16420755, -19896309, -6063096, 16436318, 6404067, -20061052, -5747997),
+        },
+        {
+            FE_CONST(-22090894, 16211975, 17706791, -11138420, 166531, -14600524, 28955024, -1884908, 9423135, -14505246),
+            FE_CONST(30709209, 12224462, -4219109, 7508729, 23375972, -6742757, -27360667, -6882446, -29521679, 4710391),
+            FE_CONST(3208225, -2120554, -8339324, -11809999, 46515, -16487890, -28312426, 8007900, 19443785, -2617982),
+        },
+        {
+            FE_CONST(22678277, 4340058, 7435910, -12228163, 28491836, -11308159, 23820114, 4492251, 21720515, 16553995),
+            FE_CONST(-32704058, 13660549, 11756599, 9893485, -5584216, 10783541, -6913787, -9627595, -25262124, 8746293),
+            FE_CONST(-3477092, 9563543, 13261078, 1936790, 19258999, -1252638, 12606955, 471348, -29561714, 5227107),
+        },
+    },
+    {
+        {
+            FE_CONST(-6898905, 9824394, -12304779, -4401089, -31397141, -6276835, 32574489, 12532905, -7503072, -8675347),
+            FE_CONST(-27343522, -16515468, -27151524, -10722951, 946346, 16291093, 254968, 7168080, 21676107, -1943028),
+            FE_CONST(21260961, -8424752, -16831886, -11920822, -23677961, 3968121, -3651949, -6215466, -3556191, -7913075),
+        },
+        {
+            FE_CONST(16544754, 13250366, -16804428, 15546242, -4583003, 12757258, -2462308, -8680336, -18907032, -9662799),
+            FE_CONST(-2415239, -15577728, 18312303, 4964443, -15272530, -12653564, 26820651, 16690659, 25459437, -4564609),
+            FE_CONST(-25144690, 11425020, 28423002, -11020557, -6144921, -15826224, 9142795, -2391602, -6432418, -1644817),
+        },
+        {
+            FE_CONST(-23104652, 6253476, 16964147, -3768872, -25113972, -12296437, -27457225, -16344658, 6335692, 7249989),
+            FE_CONST(-30333227, 13979675, 7503222, -12368314, -11956721, -4621693, -30272269, 2682242, 25993170, -12478523),
+            FE_CONST(4364628, 5930691, 32304656, -10044554, -8054781, 15091131, 22857016, -10598955, 31820368, 15075278),
+        },
+        {
+            FE_CONST(31879134, -8918693, 17258761, 90626, -8041836, -4917709, 24162788, -9650886, -17970238, 12833045),
+            FE_CONST(19073683, 14851414, -24403169, -11860168, 7625278, 11091125, -19619190, 2074449, -9413939, 14905377),
+            FE_CONST(24483667, -11935567, -2518866, -11547418, -1553130, 15355506, -25282080, 9253129, 27628530, -7555480),
+        },
+        {
+            FE_CONST(17597607, 8340603, 19355617, 552187, 26198470, -3176583, 4593324, -9157582, -14110875, 15297016),
+            FE_CONST(510886, 14337390, -31785257, 16638632, 6328095, 2713355, -20217417, -11864220, 8683221, 2921426),
+            FE_CONST(18606791, 11874196, 27155355, -5281482, -24031742, 6265446, -25178240, -1278924, 4674690, 13890525),
+        },
+        {
+            FE_CONST(13609624, 13069022, -27372361, -13055908, 24360586, 9592974, 14977157, 9835105, 4389687, 288396),
+            FE_CONST(9922506, -519394, 13613107, 5883594, -18758345, -434263, -12304062, 8317628, 23388070, 16052080),
+            FE_CONST(12720016, 11937594, -31970060, -5028689, 26900120, 8561328, -20155687, -11632979, -14754271, -10812892),
+        },
+        {
+            FE_CONST(15961858, 14150409, 26716931, -665832, -22794328, 13603569, 11829573, 7467844, -28822128, 929275),
+            FE_CONST(11038231, -11582396, -27310482, -7316562, -10498527, -16307831, -23479533, -9371869, -21393143, 2465074),
+            FE_CONST(20017163, -4323226, 27915242, 1529148, 12396362, 15675764, 13817261, -9658066, 2463391, -4622140),
+        },
+        {
+            FE_CONST(-16358878, -12663911, -12065183, 4996454, -1256422, 1073572, 9583558, 12851107, 4003896, 12673717),
+            FE_CONST(-1731589, -15155870, -3262930, 16143082, 19294135, 13385325, 14741514, -9103726, 7903886, 2348101),
+            FE_CONST(24536016, -16515207, 12715592, -3862155, 1511293, 10047386, -3842346, -7129159, -28377538, 10048127),
+        },
+    },
+    {
+        {
+            FE_CONST(-11299124, 15664638, 15253659, 12490691, 27761291, -12670010, 5164283, 12212424, -10276126, -8288808),
+            FE_CONST(-3240036, 13514210, 17935985, -15594547, -19359388, -11456146, 29773433, 12133902, -579801, -14398926),
+            FE_CONST(21030896, 5096381, -32200700, -5435505, 2376540, -16336889, -27957586, 4630727, -11103153, -5707879),
+        },
+        {
+            FE_CONST(302749, 6657501, -22715468, -15939598, -1100357, 5387943, 31893606, 14439993, -2885244, 8223521),
+            FE_CONST(-7277574, -11169736, 12407514, 7790545, 28371416, -1884988, 32998573, -3472226, -1756973, -16113030),
+            FE_CONST(-24327307, 13168845, 31273439, 4123707, -21165432, -333929, 32337455, -1432545, -21992454, 9468050),
+        },
+        {
+            FE_CONST(-25117768, 12527257, -16699435, 9936927, 9083964, -226016, -14656114, 8242746, -10581035, 11475289),
+            FE_CONST(24025353, -6056469, 828733, 4217393, 20072835, -14763189, 4396883, 1239008, -313127, -9499874),
+            FE_CONST(23834003, -8968214, 16489755, -1118006, -6930746, -15179868, -23497421, -16380669, -5229400, 8353201),
+        },
+        {
+            FE_CONST(30996412, 15313227, 22541186, 6420462, 11988094, 587701, -15130577, -12799292, -31736211, -14474619),
+            FE_CONST(31201534, -13065451, 24879437, 13212879, -7373190, 14870099, -31354440, -8270026, 3386957, 14155263),
+            FE_CONST(23356504, 5676822, -20791416, 12454214, -12021045, -280301, -18553725, -693241, 19350570, -16032092),
+        },
+        {
+            FE_CONST(-12737073, -14528027, -12741323, 7739212, 19489352, -1725364, 4194314, 2683611, 24425611, -15410613),
+            FE_CONST(-17355034, 8714491, -23270964, 13770087, 27152992, 11864267, -29462729, 10903531, 30478283, -4213657),
+            FE_CONST(5610607, -2660758, -3892305, 456706, -3102587, 9603687, 32576749, 4557380, -5844081, 1637659),
+        },
+        {
+            FE_CONST(-13342412, -15782450, -24582351, 3786309, -23257108, 4534399, -20965167, 858482, 15128623, -6421442),
+            FE_CONST(-11311449, 9478744, -10118566, 2757789, -14102901, -2246307, -2698396, -5524722, 4388627, -9939792),
+            FE_CONST(-30900793, 14937909, -2988067, -15201022, 30089039, -6805926, 32786015, 8415886, 18190875, -3370327),
+        },
+        {
+            FE_CONST(2315486, 16627386, -11684444, -11160903, 27625793, -7456815, -24437902, 2487149, 6101555, -9260736),
+            FE_CONST(3980942, 5291291, 577711, -7718522, -24687213, 3948992, -9663895, 12206994, -31527059, 2155398),
+            FE_CONST(31693079, 5583674, 17355160, 6039283, 23914512, -4301458, 5443161, -2074469, -4355998, -16519642),
+        },
+        {
+            FE_CONST(-21952652, -4845097, -18293584, -16548214, 29691257, -16624078, -4118681, -3185018, 32147346, -13870944),
+            FE_CONST(-18991199, -9788391, -19124071, 26861, 17331860, 9585369, 21174325, 1789712, 10916049, 15825177),
+            FE_CONST(-8309868, 4224323, 17111608, 9156467, -8677316, 4154378, -12301924, -16170601, -27299851, -7991530),
+        },
+    },
+    {
+        {
+            FE_CONST(-12622226, -6204820, 30718825, 2591312, -10617028, 12192840, 18873298, -7297090, -32297756, 15221632),
+            FE_CONST(-26478122, -11103864, 11546244, -1852483, 9180880, 7656409, -21343950, 2095755, 29769758, 6593415),
+            FE_CONST(-31994208, -2907461, 4176912, 3264766, 12538965, -868111, 26312345, -6118678, 30958054, 8292160),
+        },
+        {
+            FE_CONST(31429822, -13959116, 29173532, 15632448, 12174511, -2760094, 32808831, 3977186, 26143136, -3148876),
+            FE_CONST(22648901, 1402143, -22799984, 13746059, 7936347, 365344, -8668633, -1674433, -3758243, -2304625),
+            FE_CONST(-15491917, 8012313, -2514730, -12702462, -23965846, -10254029, -1612713, -1535569, -16664475, 8194478),
+        },
+        {
+            FE_CONST(27338066, -7507420, -7414224, 10140405, -19026427, -6589889, 27277191, 8855376, 28572286, 3005164),
+            FE_CONST(26287124, 4821776, 25476601, -4145903, -3764513, -15788984, -18008582, 1182479, -26094821, -13079595),
+            FE_CONST(-7171154, 3178080, 23970071, 6201893, -17195577, -4489192, -21876275, -13982627, 32208683, -1198248),
+        },
+        {
+            FE_CONST(-16657702, 2817643, -10286362, 14811298, 6024667, 13349505, -27315504, -10497842, -27672585, -11539858),
+            FE_CONST(15941029, -9405932, -21367050, 8062055, 31876073, -238629, -15278393, -1444429, 15397331, -4130193),
+            FE_CONST(8934485, -13485467, -23286397, -13423241, -32446090, 14047986, 31170398, -1441021, -27505566, 15087184),
+        },
+        {
+            FE_CONST(-18357243, -2156491, 24524913, -16677868, 15520427, -6360776, -15502406, 11461896, 16788528, -5868942),
+            FE_CONST(-1947386, 16013773, 21750665, 3714552, -17401782, -16055433, -3770287, -10323320, 31322514, -11615635),
+            FE_CONST(21426655, -5650218, -13648287, -5347537, -28812189, -4920970, -18275391, -14621414, 13040862, -12112948),
+        },
+        {
+            FE_CONST(11293895, 12478086, -27136401, 15083750, -29307421, 14748872, 14555558, -13417103, 1613711, 4896935),
+            FE_CONST(-25894883, 15323294, -8489791, -8057900, 25967126, -13425460, 2825960, -4897045, -23971776, -11267415),
+            FE_CONST(-15924766, -5229880, -17443532, 6410664, 3622847, 10243618, 20615400, 12405433, -23753030, -8436416),
+        },
+        {
+            FE_CONST(-7091295, 12556208, -20191352, 9025187, -17072479, 4333801, 4378436, 2432030, 23097949, -566018),
+            FE_CONST(4565804, -16025654, 20084412, -7842817, 1724999, 189254, 24767264, 10103221, -18512313, 2424778),
+            FE_CONST(366633, -11976806, 8173090, -6890119, 30788634, 5745705, -7168678, 1344109, -3642553, 12412659),
+        },
+        {
+            FE_CONST(-24001791, 7690286, 14929416, -168257, -32210835, -13412986, 24162697, -15326504, -3141501, 11179385),
+            FE_CONST(18289522, -14724954, 8056945, 16430056, -21729724, 7842514, -6001441, -1486897, -18684645, -11443503),
+            FE_CONST(476239, 6601091, -6152790, -9723375, 17503545, -4863900, 27672959, 13403813, 11052904, 5219329),
+        },
+    },
+    {
+        {
+            FE_CONST(7030396, 10563936, 1008588, -2147605, -15213978, -8859037, -1266598, -9563795, -22536999, 16130906),
+            FE_CONST(207890, -9611941, -12101257, -4634292, -8534457, -1211972, -4615337, 8304704, -4813856, -3754077),
+            FE_CONST(5166985, -6380344, 29708655, 6094085, 30981931, -3258233, -661961, -626972, 22609670, 13681032),
+        },
+        {
+            FE_CONST(-25480761, 8798667, 188316, -5418308, 20310898, -12086492, 20665156, -8560168, 30539173, -4868491),
+            FE_CONST(32882505, -9934344, 1203212, -9526373, 10032630, -3394826, -27771974, -413956, 23711190, 2717266),
+            FE_CONST(28344707, 6906554, -15637418, -7468318, -633022, -16120552, 9550659, 7066928, -5523469, 13426995),
+        },
+        {
+            FE_CONST(-31356019, -15163766, 25962104, 16661824, -5635384, -12673305, 5805452, 733835, -2039053, 1935647),
+            FE_CONST(10667976, -1533437, 33245070, 2325938, 7160328, 3266270, 26889770, -7258774, 16169082, -11935026),
+            FE_CONST(1455981, 4291973, 24414812, -4969121, -5087555, -5866441, -10845422, -10476323, 24067408, -9190495),
+        },
+        {
+            FE_CONST(28525224, -5010353, -16918570, 14426478, -13726323, -8449040, -30207935, 12115218, -22747283, 7229667),
+            FE_CONST(-18298188, 5905607, -27738407, 16145021, 24674768, 13483070, -23203130, -4266571, -31024783, 12023803),
+            FE_CONST(-26279123, 1957766, 6623562, -7832131, 1699048, -15745674, -18558207, -14638299, -10696895, -4725034),
+        },
+        {
+            FE_CONST(13295188, -993582, 5119388, 16617876, 27926812, 10492778, 19206688, -1757567, 23069622, -14911138),
+            FE_CONST(-606769, 4606538, 3754072, -3014165, -29473210, -6414494, -30592186, -935036, -8368447, 5658642),
+            FE_CONST(15546303, -5313301, 27089747, -5289724, 32018575, 11451106, -30533604, -3808102, -16923173, -12382885),
+        },
+        {
+            FE_CONST(-13518473, -10012729, -10585602, 2909481, -3007834, 9183109, 12137205, -8387951, 31011501, -2021041),
+            FE_CONST(29557528, -13643568, -4603588, 9181377, -4528104, 1976738, 14706542, 11933743, 9466867, 7798254),
+            FE_CONST(16533792, 8288197, -219725, 6693453, 31142616, -3211261, 26631667, 1922178, -30060800, 16666465),
+        },
+        {
+            FE_CONST(31541624, -16468898, -1319594, -6430880, -112384, 6540840, -13503997, 12577119, -25093537, 4148743),
+            FE_CONST(-33239400, 16374312, -26726352, 15737395, 27147996, 8973740, 16959411, -13412942, 20263601, -9007805),
+            FE_CONST(3596135, -5555415, -19063221, -12225713, 4337030, -10681492, 12805558, -1440741, -6296021, -6986401),
+        },
+        {
+            FE_CONST(184492, 5252852, -13314120, 2993767, 26843145, 14583276, 12509821, -1986490, 11971966, 784973),
+            FE_CONST(16909071, 2891754, -30902827, -11033825, -1953318, 7895649, 4305694, 9765558, 21505658, 2337476),
+            FE_CONST(-4724108, -12828620, 5610988, -6484390, 9053657, 15893986, -16373145, -11879782, 4759879, 12649008),
+        },
+    },
+    {
+        {
+            FE_CONST(20678546, -8375738, -32671898, 8849123, -5009758, 14574752, 31186971, -3973730, 9014762, -8579056),
+            FE_CONST(-13644050, -10350239, -15962508, 5075808, -1514661, -11534600, -33102500, 9160280, 8473550, -3256838),
+            FE_CONST(24900749, 14435722, 17209120, -15292541, -22592275, 9878983, -7689309, -16335821, -24568481, 11788948),
+        },
+        {
+            FE_CONST(-3118155, -11395194, -13802089, 14797441, 9652448, -6845904, -20037437, 10410733, -24568470, -1458691),
+            FE_CONST(-15659161, 16736706, -22467150, 10215878, -9097177, 7563911, 11871841, -12505194, -18513325, 8464118),
+            FE_CONST(-23400612, 8348507, -14585951, -861714, -3950205, -6373419, 14325289, 8628612, 33313881, -8370517),
+        },
+        {
+            FE_CONST(-20186973, -4967935, 22367356, 5271547, -1097117, -4788838, -24805667, -10236854, -8940735, -5818269),
+            FE_CONST(-6948785, -1795212, -32625683, -16021179, 32635414, -7374245, 15989197, -12838188, 28358192, -4253904),
+            FE_CONST(-23561781, -2799059, -32351682, -1661963, -9147719, 10429267, -16637684, 4072016, -5351664, 5596589),
+        },
+        {
+            FE_CONST(-28236598, -3390048, 12312896, 6213178, 3117142, 16078565, 29266239, 2557221, 1768301, 15373193),
+            FE_CONST(-7243358, -3246960, -4593467, -7553353, -127927, -912245, -1090902, -4504991, -24660491, 3442910),
+            FE_CONST(-30210571, 5124043, 14181784, 8197961, 18964734, -11939093, 22597931, 7176455, -18585478, 13365930),
+        },
+        {
+            FE_CONST(-7877390, -1499958, 8324673, 4690079, 6261860, 890446, 24538107, -8570186, -9689599, -3031667),
+            FE_CONST(25008904, -10771599, -4305031, -9638010, 16265036, 15721635, 683793, -11823784, 15723479, -15163481),
+            FE_CONST(-9660625, 12374379, -27006999, -7026148, -7724114, -12314514, 11879682, 5400171, 519526, -1235876),
+        },
+        {
+            FE_CONST(22258397, -16332233, -7869817, 14613016, -22520255, -2950923, -20353881, 7315967, 16648397, 7605640),
+            FE_CONST(-8081308, -8464597, -8223311, 9719710, 19259459, -15348212, 23994942, -5281555, -9468848, 4763278),
+            FE_CONST(-21699244, 9220969, -15730624, 1084137, -25476107, -2852390, 31088447, -7764523, -11356529, 728112),
+        },
+        {
+            FE_CONST(26047220, -11751471, -6900323, -16521798, 24092068, 9158119, -4273545, -12555558, -29365436, -5498272),
+            FE_CONST(17510331, -322857, 5854289, 8403524, 17133918, -3112612, -28111007, 12327945, 10750447, 10014012),
+            FE_CONST(-10312768, 3936952, 9156313, -8897683, 16498692, -994647, -27481051, -666732, 3424691, 7540221),
+        },
+        {
+            FE_CONST(30322361, -6964110, 11361005, -4143317, 7433304, 4989748, -7071422, -16317219, -9244265, 15258046),
+            FE_CONST(13054562, -2779497, 19155474, 469045, -12482797, 4566042, 5631406, 2711395, 1062915, -5136345),
+            FE_CONST(-19240248, -11254599, -29509029, -7499965, -5835763, 13005411, -6066489, 12194497, 32960380, 1459310),
+        },
+    },
+    {
+        {
+            FE_CONST(33464231, 6447153, -21430216, -11826305, -13265506, -6971257, 2286057, -13610964, -14259000, -4674051),
+            FE_CONST(-29884627, -13249106, -31941316, 8277056, -5164846, -276552, -20364550, -11470373, 7945759, 13374677),
+            FE_CONST(-3975518, 596542, 26638736, 1100986, -25712918, -4713631, -7254437, -11774601, -5833748, -15497210),
+        },
+        {
+            FE_CONST(-20287776, 736494, 1593599, -997467, 23084581, 320855, 9962387, -8150863, 2452762, -5067349),
+            FE_CONST(14333831, 11129045, 6510744, -1936008, -29788879, 8621848, -32380639, 10311406, 16158158, -2987994),
+            FE_CONST(12705395, -514037, -18121828, -356821, 825752, -12927253, -31885180, 12633474, 21813176, -5627776),
+        },
+        {
+            FE_CONST(-11539583, 7626540, 9730594, 1415637, 1322729, 11824176, 10886775, -5332246, 11648040, -11338898),
+            FE_CONST(7634888, 10796969, 24196261, 4783405, -9418095, 4695247, -19618340, -7742714, 15290669, -13246537),
+            FE_CONST(-1959780, 3690846, 8957689, -11010866, -24145474, -13413564, -26221513, 13968937, 31966241, 15358294),
+        },
+        {
+            FE_CONST(12233317, 14834208, -25048942, 2593837, 20079295, 5523638, 22269394, -3146263, 17455019, -11934956),
+            FE_CONST(2806510, -12366339, -8478133, 2409744, -30547072, -7779149, 25411866, -6190166, 14935193, 729401),
+            FE_CONST(21760935, -9167606, -600918, -3737400, -2788069, -5340313, -630073, 2932238, -26732275, -10348194),
+        },
+        {
+            FE_CONST(31612118, 867343, -23930901, -8997877, -18735325, 8513683, -24048310, -890335, 27227940, -6454348),
+            FE_CONST(-17862377, -3896249, -27723121, 595189, 21024964, -15361129, -17776049, -13029549, 28882387, 9512534),
+            FE_CONST(3531104, 15265259, 707795, -142303, 12268509, 8408839, -32535584, 10281822, 3245423, 3562224),
+        },
+        {
+            FE_CONST(7669236, -11719629, -28240325, -6244837, 13317121, -10304867, -11354108, -8447641, -7194719, -9438809),
+            FE_CONST(29699458, 3120605, 22488675, -5593467, 20110739, 7814545, -6384666, -15641222, 4723251, 15717190),
+            FE_CONST(10572222, -5578850, -18062584, 5032010, -17848765, 13099830, 12498725, -974866, -13476038, -13536393),
+        },
+        {
+            FE_CONST(-5637886, -12428806, 13617903, -1934630, 11591672, -8930746, 11738393, 6649420, -7486763, 15261050),
+            FE_CONST(26257131, -5385384, -23291873, -14586424, 8628743, -13543584, -21512500, -8112872, 2501320, 13551448),
+            FE_CONST(21880317, 7982027, 16322600, 12785200, -6575110, -12800047, 21113900, 6866040, -17498217, -15014626),
+        },
+        {
+            FE_CONST(22558130, -11266301, 9265731, 4186438, 11042895, -1415602, 5298117, -3939180, -7728847, -15727911),
+            FE_CONST(-7332260, -22252, -17809020, -4649946, 11283903, -15410296, -14207, 2645169, -10192806, 14437437),
+            FE_CONST(-18015805, 7199014, -28965056, -7902828, 13074475, -3533391, 21244866, -2561471, 7711948, 1747686),
+        },
+    },
+    {
+        {
+            FE_CONST(19852034, 7027924, 23669353, 10020366, 8586503, -6657907, 394197, -6101885, 18638003, -11174937),
+            FE_CONST(31395534, 15098109, 26581030, 8030562, -16527914, -5007134, 9012486, -7584354, -6643087, -5442636),
+            FE_CONST(-9192165, -2347377, -1997099, 4529534, 25766844, 607986, -13222, 9677543, -32294889, -6456008),
+        },
+        {
+            FE_CONST(-2444496, -149937, 29348902, 8186665, 1873760, 12489863, -30934579, -7839692, -7852844, -8138429),
+            FE_CONST(-15236356, -15433509, 7766470, 746860, 26346930, -10221762, -27333451, 10754588, -9431476, 5203576),
+            FE_CONST(31834314, 14135496, -770007, 5159118, 20917671, -16768096, -7467973, -7337524, 31809243, 7347066),
+        },
+        {
+            FE_CONST(-9606723, -11874240, 20414459, 13033986, 13716524, -11691881, 19797970, -12211255, 15192876, -2087490),
+            FE_CONST(-12663563, -2181719, 1168162, -3804809, 26747877, -14138091, 10609330, 12694420, 33473243, -13382104),
+            FE_CONST(33184999, 11180355, 15832085, -11385430, -1633671, 225884, 15089336, -11023903, -6135662, 14480053),
+        },
+        {
+            FE_CONST(31308717, -5619998, 31030840, -1897099, 15674547, -6582883, 5496208, 13685227, 27595050, 8737275),
+            FE_CONST(-20318852, -15150239, 10933843, -16178022, 8335352, -7546022, -31008351, -12610604, 26498114, 66511),
+            FE_CONST(22644454, -8761729, -16671776, 4884562, -3105614, -13559366, 30540766, -4286747, -13327787, -7515095),
+        },
+        {
+            FE_CONST(-28017847, 9834845, 18617207, -2681312, -3401956, -13307506, 8205540, 13585437, -17127465, 15115439),
+            FE_CONST(23711543, -672915, 31206561, -8362711, 6164647, -9709987, -33535882, -1426096, 8236921, 16492939),
+            FE_CONST(-23910559, -13515526, -26299483, -4503841, 25005590, -7687270, 19574902, 10071562, 6708380, -6222424),
+        },
+        {
+            FE_CONST(2101391, -4930054, 19702731, 2367575, -15427167, 1047675, 5301017, 9328700, 29955601, -11678310),
+            FE_CONST(3096359, 9271816, -21620864, -15521844, -14847996, -7592937, -25892142, -12635595, -9917575, 6216608),
+            FE_CONST(-32615849, 338663, -25195611, 2510422, -29213566, -13820213, 24822830, -6146567, -26767480, 7525079),
+        },
+        {
+            FE_CONST(-23066649, -13985623, 16133487, -7896178, -3389565, 778788, -910336, -2782495, -19386633, 11994101),
+            FE_CONST(21691500, -13624626, -641331, -14367021, 3285881, -3483596, -25064666, 9718258, -7477437, 13381418),
+            FE_CONST(18445390, -4202236, 14979846, 11622458, -1727110, -3582980, 23111648, -6375247, 28535282, 15779576),
+        },
+        {
+            FE_CONST(30098053, 3089662, -9234387, 16662135, -21306940, 11308411, -14068454, 12021730, 9955285, -16303356),
+            FE_CONST(9734894, -14576830, -7473633, -9138735, 2060392, 11313496, -18426029, 9924399, 20194861, 13380996),
+            FE_CONST(-26378102, -7965207, -22167821, 15789297, -18055342, -6168792, -1984914, 15707771, 26342023, 10146099),
+        },
+    },
+    {
+        {
+            FE_CONST(2645815, -14611604, 18609641, 8535934, -31634334, 2135963, -26195716, 11481775, -33122795, 3726902),
+            FE_CONST(20621035, 10751310, -29776383, -7534242, 11354181, 9683490, -312328, -9064604, -7558269, -15980792),
+            FE_CONST(-16295339, 10771553, -287937, 9656325, 19885419, 4058894, 14063211, -15798523, 9920468, 1982229),
+        },
+        {
+            FE_CONST(3385738, 1234670, -26862528, -10392990, 17948024, 11331859, 19006271, 1386324, -29533984, 10262724),
+            FE_CONST(8884032, -1096438, 3420412, 15266977, 5052635, -9223773, -1791853, -6878749, 12243607, -8919499),
+            FE_CONST(13175655, -1838021, -21807507, 14192674, -4193002, -10962788, 19914268, -13253426, -22594958, -15951981),
+        },
+        {
+            FE_CONST(-9833040, -15161676, -8479323, 7793366, 11085939, 11720315, -18542677, 8758951, 17054491, -9031261),
+            FE_CONST(-12831578, -9323567, -15176528, 16516832, 26533242, -13161042, -23682258, -14096128, -6842648, -14312786),
+            FE_CONST(-4969699, 13325177, 236998, -10963677, -10405527, -7625755, -31704188, 8843013, -12483346, -2116485),
+        },
+        {
+            FE_CONST(-23925459, -11469272, -13057268, -11013575, -20895620, 15744848, -2145197, -8672972, -17577894, -9032651),
+            FE_CONST(1587635, -13086776, -30656517, -15601168, -21250048, -10674204, 25327670, -8907061, -5065168, -11828712),
+            FE_CONST(21820090, 1997481, 14475848, -11009831, -10710632, -8718338, 31358693, -6271736, -21668179, 1348305),
+        },
+        {
+            FE_CONST(-8216916, 3615591, -12970109, -12210260, 9353717, -13090253, -16181963, -7260055, -13730485, 6915139),
+            FE_CONST(5523395, -11046983, 12443554, 13650176, 28553428, 7698891, -29613525, -12012747, -31363456, -10008309),
+            FE_CONST(-26634305, 13621946, -13334032, -11423550, 27338201, -16075483, -17866548, 11062577, 10341151, -11792006),
+        },
+        {
+            FE_CONST(21364261, 9385891, 5918875, 13050407, -17495288, -8505959, 13319184, 5657866, -695954, -2553051),
+            FE_CONST(-11316261, 15520182, -3909263, 6124169, -789815, -16062736, -28925845, -9717387, -27308163, 10194668),
+            FE_CONST(26605796, 16165329, -2718620, 6040534, -8805838, 5845615, -28882162, -15251463, 10575004, 2931151),
+        },
+        {
+            FE_CONST(29375061, -1053730, -10886712, 2778587, 12705468, -12721249, -22469906, -10552647, 1341093, 358819),
+            FE_CONST(25120806, 13699632, -7013673, -14689579, -25507383, -15088059, 30572941, 12606575, 14375334, 8861920),
+            FE_CONST(420427, -11922296, 31356987, 9546629, -27950855, 7047758, -13839471, -4640667, 9566447, -8955356),
+        },
+        {
+            FE_CONST(20000919, 9004137, 17712032, -8998600, -14109397, -15991519, 9814680, 15274196, -6629414, -10773743),
+            FE_CONST(-2897834, -14600272, -28796554, 4561664, 5804813, -6509305, 4646191, -8579329, 14298159, 15481181),
+            FE_CONST(-21120282, -12594607, -1099551, -15362319, 24676024, 5438168, -19269205, -8897236, -8851313, 2132693),
+        },
+    },
+    {
+        {
+            FE_CONST(-26016874, -219943, 21339191, -41388, 19745256, -2878700, -29637280, 2227040, 21612326, -545728),
+            FE_CONST(-13077387, 1184228, 23562814, -5970442, -20351244, -6348714, 25764461, 12243797, -20856566, 11649658),
+            FE_CONST(-10031494, 11262626, 27384172, 2271902, 26947504, -15997771, 39944, 6114064, 33514190, 2333242),
+        },
+        {
+            FE_CONST(-21433588, -12421821, 8119782, 7219913, -21830522, -9016134, -6679750, -12670638, 24350578, -13450001),
+            FE_CONST(-4116307, -11271533, -23886186, 4843615, -30088339, 690623, -31536088, -10406836, 8317860, 12352766),
+            FE_CONST(18200138, -14475911, -33087759, -2696619, -23702521, -9102511, -23552096, -2287550, 20712163, 6719373),
+        },
+        {
+            FE_CONST(26656208, 6075253, -7858556, 1886072, -28344043, 4262326, 11117530, -3763210, 26224235, -3297458),
+            FE_CONST(-17168938, -14854097, -3395676, -16369877, -19954045, 14050420, 21728352, 9493610, 18620611, -16428628),
+            FE_CONST(-13323321, 13325349, 11432106, 5964811, 18609221, 6062965, -5269471, -9725556, -30701573, -16479657),
+        },
+        {
+            FE_CONST(-23860538, -11233159, 26961357, 1640861, -32413112, -16737940, 12248509, -5240639, 13735342, 1934062),
+            FE_CONST(25089769, 6742589, 17081145, -13406266, 21909293, -16067981, -15136294, -3765346, -21277997, 5473616),
+            FE_CONST(31883677, -7961101, 1083432, -11572403, 22828471, 13290673, -7125085, 12469656, 29111212, -5451014),
+        },
+        {
+            FE_CONST(24244947, -15050407, -26262976, 2791540, -14997599, 16666678, 24367466, 6388839, -10295587, 452383),
+            FE_CONST(-25640782, -3417841, 5217916, 16224624, 19987036, -4082269, -24236251, -5915248, 15766062, 8407814),
+            FE_CONST(-20406999, 13990231, 15495425, 16395525, 5377168, 15166495, -8917023, -4388953, -8067909, 2276718),
+        },
+        {
+            FE_CONST(30157918, 12924066, -17712050, 9245753, 19895028, 3368142, -23827587, 5096219, 22740376, -7303417),
+            FE_CONST(2041139, -14256350, 7783687, 13876377, -25946985, -13352459, 24051124, 13742383, -15637599, 13295222),
+            FE_CONST(33338237, -8505733, 12532113, 7977527, 9106186, -1715251, -17720195, -4612972, -4451357, -14669444),
+        },
+        {
+            FE_CONST(-20045281, 5454097, -14346548, 6447146, 28862071, 1883651, -2469266, -4141880, 7770569, 9620597),
+            FE_CONST(23208068, 7979712, 33071466, 8149229, 1758231, -10834995, 30945528, -1694323, -33502340, -14767970),
+            FE_CONST(1439958, -16270480, -1079989, -793782, 4625402, 10647766, -5043801, 1220118, 30494170, -11440799),
+        },
+        {
+            FE_CONST(-5037580, -13028295, -2970559, -3061767, 15640974, -6701666, -26739026, 926050, -1684339, -13333647),
+            FE_CONST(13908495, -3549272, 30919928, -6273825, -21521863, 7989039, 9021034, 9078865, 3353509, 4033511),
+            FE_CONST(-29663431, -15113610, 32259991, -344482, 24295849, -12912123, 23161163, 8839127, 27485041, 7356032),
+        },
+    },
+    {
+        {
+            FE_CONST(12926894, -4621803, -92124, 612986, 27798555, 11958898, -33046416, 8250987, 3985534, 5752383),
+            FE_CONST(8181413, -14871953, -4457237, -11061318, 4090619, 8617513, 938880, 3172702, 30667196, -7426963),
+            FE_CONST(2684044, -12461844, 13362767, 174928, 1574941, -11969704, 32246114, 1161895, 28861941, 2212274),
+        },
+        {
+            FE_CONST(11801177, 4640846, 5077395, 9665750, 9498225, -3429443, -5986596, -6285506, -2291665, -8460019),
+            FE_CONST(20200978, -14112049, 12779120, -9697954, 6959529, 13434826, 15735530, 3617225, -18109923, -14495312),
+            FE_CONST(26483408, 7918962, 32543625, 15966796, -18494165, 6700637, 33515571, 1468472, -7434639, 3882936),
+        },
+        {
+            FE_CONST(20985698, -2287366, 20524682, -9146394, -2201032, -1782300, 20073259, 8823495, 14362703, 15566306),
+            FE_CONST(13922540, 12838887, 69320, 14492027, -19354830, -5395105, 1359405, 1049363, -19171131, -2218123),
+            FE_CONST(24049349, 9045571, 25122372, -7195022, -22730341, -16028472, 13876520, -15079208, -84172, -16196812),
+        },
+        {
+            FE_CONST(-25723383, 749559, -19675269, 6315202, 29803999, -15976807, -12439101, 4072354, 28610093, -9845167),
+            FE_CONST(22405748, -3140797, 23752851, 13509993, 28416399, -5679308, -2593577, 15179142, -32711793, 9985925),
+            FE_CONST(5983061, 1013072, 10563044, 2131346, 13237016, 2787398, -29812650, -9612409, -4120577, -2131800),
+        },
+        {
+            FE_CONST(13554397, -8068101, -9219988, 10441906, -30246212, 1445543, -2105255, -15574740, -12920712, -10651236),
+            FE_CONST(-4753240, -15338911, -31091178, -11616267, 21968691, -14722596, 22817408, -4879304, -15790616, 15231156),
+            FE_CONST(9423693, 952818, 1446704, 4799222, 13724062, -9688091, -3872640, -15316813, -28186869, -7609846),
+        },
+        {
+            FE_CONST(25827808, 9068954, 21900720, -16013636, -9281400, 13311816, 3119355, -7722955, 2870698, 13933703),
+            FE_CONST(33496055, 12104150, 1499403, 4839538, 5391639, -887943, -787136, -11356019, 11361396, -12862660),
+            FE_CONST(20957573, 10900616, -18298618, 6927441, 4333372, 12671653, 19978419, -8113718, 4386085, 11889846),
+        },
+        {
+            FE_CONST(23774534, -766138, -3839017, -10036218, 14534868, 16100900, -26739138, -6448087, -6536165, -12018956),
+            FE_CONST(-2892060, -330117, -13729702, -4601839, -11441018, 3187128, -8648193, 14175919, -6671121, -10860836),
+            FE_CONST(-1723065, -6611831, -19976386, -4974201, 29195586, -7676695, 32568503, -8356434, 31578317, 10424168),
+        },
+        {
+            FE_CONST(-15795703, 760921, 31196422, 1661734, -16035192, -10317121, 1054758, -1900255, -5602642, -8443438),
+            FE_CONST(-1946508, 8121488, -4182057, 16298638, 16335826, -8024598, -6722031, 2041813, 24492929, 6086127),
+            FE_CONST(2461349, 8450263, 27141221, -10265000, -31733527, 4464999, -20543849, 12937142, -3491992, 1221197),
+        },
+    },
+    {
+        {
+            FE_CONST(9661027, 705443, 11980065, -5370154, -1628543, 14661173, -6346142, 2625015, 28431036, -16771834),
+            FE_CONST(-23839233, -8311415, -25945511, 7480958, -17681669, -8354183, -22545972, 14150565, 15970762, 4099461),
+            FE_CONST(29262576, 16756590, 26350592, -8793563, 8529671, -11208050, 13617293, -9937143, 11465739, 8317062),
+        },
+        {
+            FE_CONST(-25493081, -6962928, 32500200, -9419051, -23038724, -2302222, 14898637, 3848455, 20969334, -5157516),
+            FE_CONST(-20384450, -14347713, -18336405, 13884722, -33039454, 2842114, -21610826, -3649888, 11177095, 14989547),
+            FE_CONST(-24496721, -11716016, 16959896, 2278463, 12066309, 10137771, 13515641, 2581286, -28487508, 9930240),
+        },
+        {
+            FE_CONST(-17751622, -2097826, 16544300, -13009300, -15914807, -14949081, 18345767, -13403753, 16291481, -5314038),
+            FE_CONST(-33229194, 2553288, 32678213, 9875984, 8534129, 6889387, -9676774, 6957617, 4368891, 9788741),
+            FE_CONST(16660756, 7281060, -10830758, 12911820, 20108584, -8101676, -21722536, -8613148, 16250552, -11111103),
+        },
+        {
+            FE_CONST(-19765507, 2390526, -16551031, 14161980, 1905286, 6414907, 4689584, 10604807, -30190403, 4782747),
+            FE_CONST(-1354539, 14736941, -7367442, -13292886, 7710542, -14155590, -9981571, 4383045, 22546403, 437323),
+            FE_CONST(31665577, -12180464, -16186830, 1491339, -18368625, 3294682, 27343084, 2786261, -30633590, -14097016),
+        },
+        {
+            FE_CONST(-14467279, -683715, -33374107, 7448552, 19294360, 14334329, -19690631, 2355319, -19284671, -6114373),
+            FE_CONST(15121312, -15796162, 6377020, -6031361, -10798111, -12957845, 18952177, 15496498, -29380133, 11754228),
+            FE_CONST(-2637277, -13483075, 8488727, -14303896, 12728761, -1622493, 7141596, 11724556, 22761615, -10134141),
+        },
+        {
+            FE_CONST(16918416, 11729663, -18083579, 3022987, -31015732, -13339659, -28741185, -12227393, 32851222, 11717399),
+            FE_CONST(11166634, 7338049, -6722523, 4531520, -29468672, -7302055, 31474879, 3483633, -1193175, -4030831),
+            FE_CONST(-185635, 9921305, 31456609, -13536438, -12013818, 13348923, 33142652, 6546660, -19985279, -3948376),
+        },
+        {
+            FE_CONST(-32460596, 11266712, -11197107, -7899103, 31703694, 3855903, -8537131, -12833048, -30772034, -15486313),
+            FE_CONST(-18006477, 12709068, 3991746, -6479188, -21491523, -10550425, -31135347, -16049879, 10928917, 3011958),
+            FE_CONST(-6957757, -15594337, 31696059, 334240, 29576716, 14796075, -30831056, -12805180, 18008031, 10258577),
+        },
+        {
+            FE_CONST(-22448644, 15655569, 7018479, -4410003, -30314266, -1201591, -1853465, 1367120, 25127874, 6671743),
+            FE_CONST(29701166, -14373934, -10878120, 9279288, -17568, 13127210, 21382910, 11042292, 25838796, 4642684),
+            FE_CONST(-20430234, 14955537, -24126347, 8124619, -5369288, -5990470, 30468147, -13900640, 18423289, 4177476),
+        },
+    },
+    {
+        {
+            FE_CONST(-14936374, -8966633, 16035159, -12459047, -28113932, -11200577, 9309498, -699242, 17539307, -14268189),
+            FE_CONST(-14913844, 2041963, 16152106, -1002060, -17493443, 8032684, -16924778, -2611573, 31650478, -2759542),
+            FE_CONST(-21329046, -14969697, 9403807, 3956363, 5669425, -9408529, 14897968, 1748830, -7404637, -7530518),
+        },
+        {
+            FE_CONST(30994596, 15923823, -27241862, 14674108, -9677648, -15226762, -17942848, -2109512, 13169703, 16280007),
+            FE_CONST(1435572, 12474308, 5012448, 15551904, 31734544, -1437433, 17256602, -15128153, -25283664, -11281360),
+            FE_CONST(12238178, -14092060, 17201416, -13101938, -33310834, -8847163, 1861226, -771824, -30282702, 11632385),
+        },
+        {
+            FE_CONST(-29004168, 12137537, -9291644, 939684, -31652565, 11993054, 24206801, 123570, -41951, -2660533),
+            FE_CONST(-16544926, 10765766, 32522199, -15839497, -7059235, -15890379, -887889, -8862829, -6144572, -6111558),
+            FE_CONST(-31004644, 7150990, 31173499, -4856575, -31041115, -1017932, 9215665, 9314632, 2100453, 12738185),
+        },
+        {
+            FE_CONST(-23739239, 12175642, -20909012, -6181563, 5010829, 13707831, 17477840, 7104010, -19240197, -10895057),
+            FE_CONST(-477089, 10341682, -31642904, -1045100, -3864955, 15033511, 14090074, -5701542, 19720252, -13711114),
+            FE_CONST(-17231175, -15554091, -31910418, -10042564, 24746366, -3617448, -19512878, -11548281, 68185, 11397287),
+        },
+        {
+            FE_CONST(-16775058, 4360432, -1079696, 16202168, -21022135, 4793045, 7551089, 12806060, -15402656, 4668026),
+            FE_CONST(12701398, 2088436, -27322240, -4860379, -30130045, 6937264, -32183617, -6551970, -10888864, -10072030),
+            FE_CONST(1424065, -4340490, 4949044, 15352543, -3865319, 5323858, -31201753, 7499179, -1708220, 6104219),
+        },
+        {
+            FE_CONST(-1441215, -9108123, 31115231, -15698297, 24310535, -13095796, 19359620, 3518970, -19894898, -4288325),
+            FE_CONST(6018510, -5456257, -31705412, -11071807, -28611939, -14017446, -26743204, -12282375, 1309731, -14289438),
+            FE_CONST(-9226446, -6253944, 15129679, 14842587, 33420224, 16402151, 1044866, -7155772, -30050295, -2004773),
+        },
+        {
+            FE_CONST(22117334, -15686121, -19988255, 4027178, 27997531, 5928803, 20758988, 12935188, -5353178, -12214336),
+            FE_CONST(-16691925, -1081511, -17731508, 14902587, -14595878, 744945, -1666002, -7214234, 12943433, 4893829),
+            FE_CONST(-11287370, -5605308, -12413014, 16537161, 5885809, 13376186, 861973, -12274401, -7191757, 13542570),
+        },
+        {
+            FE_CONST(26159853, 5695496, -13021323, 3774590, -12595062, 13031688, 19183275, -3499173, 24071151, -11664630),
+            FE_CONST(-6722558, 8201802, -18197574, 13042281, 3329729, -3134402, -12301504, -2743312, -24332108, 12474634),
+            FE_CONST(-24539875, -3555046, -1092694, 13129722, 16000542, -2442683, -8801996, 13867540, 31961542, -2259691),
+        },
+    },
+};
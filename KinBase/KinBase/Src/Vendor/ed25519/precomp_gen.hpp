@@ -0,0 +1,293 @@
+#ifndef PRECOMP_GEN_HPP
+#define PRECOMP_GEN_HPP
+
+/*
+    Compile-time generator for the ge_precomp tables, a C++20 counterpart
+    of gen_base_table.py.
+
+        base_table<window, passes>()  base[i][j] = (j+1)*2^(window*passes*i)*B
+        odd_table<window>()           Bi[i] = (2i+1)*B
+
+    Entries are (y+x, y-x, 2dxy) as ten radix 2^25.5 limbs centered around
+    zero, exactly what the FE_CONST initializers of the C tables hold, so a
+    table for any window or comb layout can be built where it's used instead
+    of being generated and checked in. precomp_gen_check.cpp asserts that
+    the tables shipped with the library match.
+
+    Points are added in extended coordinates and all entries of a table are
+    made affine with one batched inversion. Even so a full base table takes
+    well over the default constant evaluation limits, see the flags in
+    precomp_gen_check.cpp.
+*/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace precomp_gen {
+
+/* integers mod p = 2^255 - 19, eight little-endian 32-bit words, always reduced */
+using field = std::array<std::uint32_t, 8>;
+
+constexpr field P = {
+    0xffffffed, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x7fffffff
+};
+
+/* d = -121665/121666 and the base point (x, 4/5) */
+constexpr field D = {
+    0x135978a3, 0x75eb4dca, 0x4141d8ab, 0x00700a4d, 0x7779e898, 0x8cc74079, 0x2b6ffe73, 0x52036cee
+};
+
+constexpr field BX = {
+    0x8f25d51a, 0xc9562d60, 0x9525a7b2, 0x692cc760, 0xfdd6dc5c, 0xc0a4e231, 0xcd6e53fe, 0x216936d3
+};
+
+constexpr field BY = {
+    0x66666658, 0x66666666, 0x66666666, 0x66666666, 0x66666666, 0x66666666, 0x66666666, 0x66666666
+};
+
+constexpr field from_int(std::uint32_t v) {
+    field r{};
+    r[0] = v;
+    return r;
+}
+
+constexpr bool geq(const field &a, const field &b) {
+    for (int i = 7; i >= 0; --i) {
+        if (a[i] != b[i]) {
+            return a[i] > b[i];
+        }
+    }
+
+    return true;
+}
+
+/* a - b without reduction, requires a >= b */
+constexpr field sub_raw(const field &a, const field &b) {
+    field r{};
+    std::int64_t borrow = 0;
+
+    for (int i = 0; i < 8; ++i) {
+        std::int64_t t = (std::int64_t) a[i] - b[i] - borrow;
+        borrow = t < 0;
+        r[i] = (std::uint32_t) t;
+    }
+
+    return r;
+}
+
+constexpr field reduce(field a) {
+    while (geq(a, P)) {
+        a = sub_raw(a, P);
+    }
+
+    return a;
+}
+
+constexpr field add(const field &a, const field &b) {
+    field r{};
+    std::uint64_t carry = 0;
+
+    /* both are below 2^255, so the sum fits in 256 bits */
+    for (int i = 0; i < 8; ++i) {
+        carry += (std::uint64_t) a[i] + b[i];
+        r[i] = (std::uint32_t) carry;
+        carry >>= 32;
+    }
+
+    return reduce(r);
+}
+
+constexpr field sub(const field &a, const field &b) {
+    return geq(a, b) ? sub_raw(a, b) : add(a, sub_raw(P, b));
+}
+
+constexpr field mul(const field &a, const field &b) {
+    std::uint64_t t[16] = {};
+    std::uint64_t carry;
+    field r{};
+
+    for (int i = 0; i < 8; ++i) {
+        carry = 0;
+
+        for (int j = 0; j < 8; ++j) {
+            carry += t[i + j] + (std::uint64_t) a[i] * b[j];
+            t[i + j] = (std::uint32_t) carry;
+            carry >>= 32;
+        }
+
+        t[i + 8] = carry;
+    }
+
+    /* 2^256 = 38 mod p */
+    carry = 0;
+
+    for (int i = 0; i < 8; ++i) {
+        carry += t[i] + 38 * t[i + 8];
+        r[i] = (std::uint32_t) carry;
+        carry >>= 32;
+    }
+
+    while (carry) {
+        carry *= 38;
+
+        for (int i = 0; i < 8; ++i) {
+            carry += r[i];
+            r[i] = (std::uint32_t) carry;
+            carry >>= 32;
+        }
+    }
+
+    return reduce(r);
+}
+
+constexpr field invert(const field &a) {
+    field e = sub_raw(P, from_int(2));
+    field r = from_int(1);
+
+    for (int i = 255; i >= 0; --i) {
+        r = mul(r, r);
+
+        if ((e[i / 32] >> (i % 32)) & 1) {
+            r = mul(r, a);
+        }
+    }
+
+    return r;
+}
+
+/* extended coordinates (X:Y:Z:T) on -x^2 + y^2 = 1 + d x^2 y^2 */
+struct point {
+    field X, Y, Z, T;
+};
+
+constexpr point base_point() {
+    return { BX, BY, from_int(1), mul(BX, BY) };
+}
+
+/* complete for this curve, so it doubles as well */
+constexpr point add(const point &p, const point &q) {
+    field a = mul(sub(p.Y, p.X), sub(q.Y, q.X));
+    field b = mul(add(p.Y, p.X), add(q.Y, q.X));
+    field c = mul(mul(p.T, q.T), add(D, D));
+    field d = mul(add(p.Z, p.Z), q.Z);
+    field e = sub(b, a);
+    field f = sub(d, c);
+    field g = add(d, c);
+    field h = add(b, a);
+
+    return { mul(e, f), mul(g, h), mul(f, g), mul(e, h) };
+}
+
+/* the limbs of gen_base_table.py */
+using limbs = std::array<std::int32_t, 10>;
+
+struct precomp {
+    limbs yplusx, yminusx, xy2d;
+};
+
+constexpr limbs to_limbs(field v) {
+    limbs out{};
+    std::int64_t carry = 0;
+
+    for (int i = 0; i < 10; ++i) {
+        int bits = i % 2 == 0 ? 26 : 25;
+        std::int64_t l = (std::int64_t) (v[0] & ((1u << bits) - 1)) + carry;
+
+        /* v >>= bits */
+        for (int k = 0; k < 8; ++k) {
+            v[k] = (v[k] >> bits) | (k < 7 ? v[k + 1] << (32 - bits) : 0);
+        }
+
+        carry = l >= ((std::int64_t) 1 << (bits - 1));
+        out[i] = (std::int32_t) (l - (carry << bits));
+    }
+
+    out[0] += (std::int32_t) (19 * carry);
+    return out;
+}
+
+/* affine (y+x, y-x, 2dxy) for count points, sharing one inversion */
+template <std::size_t N>
+constexpr std::array<precomp, N> to_precomp(const std::array<point, N> &points) {
+    std::array<field, N> prefix{};
+    std::array<precomp, N> out{};
+    field inv{};
+
+    for (std::size_t i = 0; i < N; ++i) {
+        prefix[i] = i == 0 ? points[0].Z : mul(prefix[i - 1], points[i].Z);
+    }
+
+    inv = invert(prefix[N - 1]);
+
+    for (std::size_t i = N; i-- > 0;) {
+        field zinv = i == 0 ? inv : mul(inv, prefix[i - 1]);
+        field x = mul(points[i].X, zinv);
+        field y = mul(points[i].Y, zinv);
+
+        inv = mul(inv, points[i].Z);
+        out[i] = { to_limbs(add(y, x)), to_limbs(sub(y, x)), to_limbs(mul(mul(add(D, D), x), y)) };
+    }
+
+    return out;
+}
+
+template <int Window, int Passes>
+struct base_layout {
+    static constexpr std::size_t digits = (256 + Window - 1) / Window;
+    static constexpr std::size_t positions = (digits + Passes - 1) / Passes;
+    static constexpr std::size_t entries = std::size_t(1) << (Window - 1);
+};
+
+template <int Window, int Passes>
+using base_table_t = std::array<std::array<precomp, base_layout<Window, Passes>::entries>, base_layout<Window, Passes>::positions>;
+
+template <int Window, int Passes>
+constexpr base_table_t<Window, Passes> base_table() {
+    using layout = base_layout<Window, Passes>;
+    std::array<point, layout::positions * layout::entries> points{};
+    base_table_t<Window, Passes> table{};
+    point p = base_point();
+
+    for (std::size_t i = 0; i < layout::positions; ++i) {
+        point q = p;
+
+        for (std::size_t j = 0; j < layout::entries; ++j) {
+            points[i * layout::entries + j] = q;
+            q = add(q, p);
+        }
+
+        for (int k = 0; k < Window * Passes; ++k) {
+            p = add(p, p);
+        }
+    }
+
+    auto flat = to_precomp(points);
+
+    for (std::size_t i = 0; i < layout::positions; ++i) {
+        for (std::size_t j = 0; j < layout::entries; ++j) {
+            table[i][j] = flat[i * layout::entries + j];
+        }
+    }
+
+    return table;
+}
+
+template <int Window>
+constexpr std::array<precomp, std::size_t(1) << (Window - 2)> odd_table() {
+    std::array<point, std::size_t(1) << (Window - 2)> points{};
+    point b = base_point();
+    point b2 = add(b, b);
+    point q = b;
+
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        points[i] = q;
+        q = add(q, b2);
+    }
+
+    return to_precomp(points);
+}
+
+}
+
+#endif
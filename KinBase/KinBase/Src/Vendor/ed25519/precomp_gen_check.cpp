@@ -0,0 +1,87 @@
+/*
+    Checks at compile time that precomp_gen.hpp reproduces the shipped
+    tables bit for bit. Nothing is linked, compiling is the test:
+
+        g++ -std=c++20 -fsyntax-only -fconstexpr-ops-limit=2147483647 precomp_gen_check.cpp
+        clang++ -std=c++20 -fsyntax-only -fconstexpr-steps=2147483647 precomp_gen_check.cpp
+
+    Neither file is part of the pod, which only builds the C sources.
+*/
+
+#include "precomp_gen.hpp"
+
+/* compare against the radix 2^25.5 limbs, as written in the tables */
+#define ED25519_NO_FE51
+#include "ge.h"
+
+#define BASE_TABLE_ALIGN
+
+/* the tables are plain static const arrays, make them usable in constant expressions */
+#define static static constexpr
+
+namespace shipped {
+#include "precomp_data.h"
+}
+
+namespace shipped_64k {
+#include "precomp_base_64k.h"
+}
+
+namespace shipped_128k {
+#include "precomp_base_128k.h"
+}
+
+#undef static
+
+namespace {
+
+constexpr bool same(const fe &a, const precomp_gen::limbs &b) {
+    for (int i = 0; i < 10; ++i) {
+        if (a[i] != b[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+constexpr bool same(const ge_precomp &a, const precomp_gen::precomp &b) {
+    return same(a.yplusx, b.yplusx) && same(a.yminusx, b.yminusx) && same(a.xy2d, b.xy2d);
+}
+
+template <std::size_t N, typename T>
+constexpr bool same(const ge_precomp (&a)[N], const T &b) {
+    if (N != b.size()) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < N; ++i) {
+        if (!same(a[i], b[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <std::size_t N, std::size_t M, typename T>
+constexpr bool same(const ge_precomp (&a)[N][M], const T &b) {
+    if (N != b.size()) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < N; ++i) {
+        if (!same(a[i], b[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}
+
+static_assert(same(shipped::Bi, precomp_gen::odd_table<8>()), "Bi differs from odd_table<8>");
+static_assert(same(shipped::base, precomp_gen::base_table<4, 2>()), "base differs from base_table<4, 2>");
+static_assert(same(shipped_64k::base, precomp_gen::base_table<4, 1>()), "64K base differs from base_table<4, 1>");
+static_assert(same(shipped_128k::base, precomp_gen::base_table<5, 1>()), "128K base differs from base_table<5, 1>");
@@ -1,6 +1,8 @@
 #include "fixedint.h"
 #include "sc.h"
 
+#ifndef ED25519_SC64
+
 static uint64_t load_3(const unsigned char *in) {
     uint64_t result;
 
@@ -807,3 +809,13 @@ void sc_muladd(unsigned char *s, const unsigned char *a, const unsigned char *b,
     s[30] = (unsigned char) (s11 >> 9);
     s[31] = (unsigned char) (s11 >> 17);
 }
+
+#endif /* ED25519_SC64 */
+
+void sc_reduce_n(unsigned char *s, size_t count) {
+    size_t i;
+
+    for (i = 0; i < count; ++i) {
+        sc_reduce(s + 64 * i);
+    }
+}
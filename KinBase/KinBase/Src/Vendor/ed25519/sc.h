@@ -1,12 +1,26 @@
 #ifndef SC_H
 #define SC_H
 
+#include <stddef.h>
+
 /*
 The set of scalars is \Z/l
 where l = 2^252 + 27742317777372353535851937790883648493.
 */
 
+/*
+    Compilers with 128-bit integers get the 64-bit limb implementation in
+    sc64.c, define ED25519_NO_SC64 to force the portable one in sc.c.
+*/
+
+#if !defined(ED25519_SC64) && !defined(ED25519_NO_SC64) && defined(__SIZEOF_INT128__)
+    #define ED25519_SC64
+#endif
+
 void sc_reduce(unsigned char *s);
 void sc_muladd(unsigned char *s, const unsigned char *a, const unsigned char *b, const unsigned char *c);
 
+/* sc_reduce on count consecutive 64-byte buffers, each result in its first 32 bytes */
+void sc_reduce_n(unsigned char *s, size_t count);
+
 #endif
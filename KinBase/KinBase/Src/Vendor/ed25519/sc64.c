@@ -0,0 +1,241 @@
+#include "fixedint.h"
+#include "sc.h"
+
+#ifdef ED25519_SC64
+
+/*
+    Scalar arithmetic with 64-bit limbs for targets with 128-bit integers.
+
+    Values are little endian arrays of 64-bit limbs. Reduction mod l uses
+    Barrett's method with b = 2^64 and k = 4 (HAC 14.42), followed by two
+    masked subtractions, so every step runs in constant time.
+*/
+
+typedef unsigned __int128 uint128_t;
+
+/* l = 2^252 + 27742317777372353535851937790883648493 */
+static const uint64_t L[4] = {
+    UINT64_C(0x5812631a5cf5d3ed), UINT64_C(0x14def9dea2f79cd6),
+    UINT64_C(0x0000000000000000), UINT64_C(0x1000000000000000)
+};
+
+/* mu = floor(2^512 / l) */
+static const uint64_t MU[5] = {
+    UINT64_C(0xed9ce5a30a2c131b), UINT64_C(0x2106215d086329a7),
+    UINT64_C(0xffffffffffffffeb), UINT64_C(0xffffffffffffffff),
+    UINT64_C(0x000000000000000f)
+};
+
+static uint64_t load_8(const unsigned char *in) {
+    uint64_t result;
+
+    result = (uint64_t) in[0];
+    result |= ((uint64_t) in[1]) << 8;
+    result |= ((uint64_t) in[2]) << 16;
+    result |= ((uint64_t) in[3]) << 24;
+    result |= ((uint64_t) in[4]) << 32;
+    result |= ((uint64_t) in[5]) << 40;
+    result |= ((uint64_t) in[6]) << 48;
+    result |= ((uint64_t) in[7]) << 56;
+
+    return result;
+}
+
+static void store_8(unsigned char *out, uint64_t in) {
+    out[0] = (unsigned char) in;
+    out[1] = (unsigned char) (in >> 8);
+    out[2] = (unsigned char) (in >> 16);
+    out[3] = (unsigned char) (in >> 24);
+    out[4] = (unsigned char) (in >> 32);
+    out[5] = (unsigned char) (in >> 40);
+    out[6] = (unsigned char) (in >> 48);
+    out[7] = (unsigned char) (in >> 56);
+}
+
+/*
+    Column-wise (Comba) products. Within a column the low and high halves of
+    the 128-bit partial products are summed separately so nothing overflows;
+    acc carries into the next column.
+*/
+
+#define MAC(a, b) \
+    t = (uint128_t) (a) * (b); \
+    acc += (uint64_t) t; \
+    hi += (uint64_t) (t >> 64);
+
+#define COL_END(out) \
+    out = (uint64_t) acc; \
+    acc = (acc >> 64) + hi; \
+    hi = 0;
+
+/* r = a - b - borrow */
+#define SBB(r, a, b) \
+    d = (uint128_t) (a) - (b) - borrow; \
+    r = (uint64_t) d; \
+    borrow = (uint64_t) (d >> 64) & 1;
+
+/* r = r - l if r >= l, without branching on r */
+static void sub_l_if_greater(uint64_t *r) {
+    uint64_t t0, t1, t2, t3;
+    uint64_t borrow = 0;
+    uint64_t mask;
+    uint128_t d;
+
+    SBB(t0, r[0], L[0]);
+    SBB(t1, r[1], L[1]);
+    SBB(t2, r[2], L[2]);
+    SBB(t3, r[3], L[3]);
+
+    mask = borrow - 1; /* all ones if there was no borrow */
+
+    r[0] = (t0 & mask) | (r[0] & ~mask);
+    r[1] = (t1 & mask) | (r[1] & ~mask);
+    r[2] = (t2 & mask) | (r[2] & ~mask);
+    r[3] = (t3 & mask) | (r[3] & ~mask);
+}
+
+/* out = x mod l for x < 2^512 in 8 limbs */
+static void barrett_reduce(uint64_t *out, const uint64_t *x) {
+    const uint64_t *q1 = x + 3; /* floor(x / b^3) */
+    uint64_t q3[4]; /* limb 4 would only reach limb 4 of q3 * l */
+    uint64_t r2[4];
+    uint64_t unused;
+    uint64_t borrow = 0;
+    uint128_t acc = 0;
+    uint128_t hi = 0;
+    uint128_t t;
+    uint128_t d;
+
+    /* q3 = floor(q1 * mu / b^5), the low columns only provide carries */
+    MAC(q1[0], MU[0]);
+    COL_END(unused);
+    MAC(q1[0], MU[1]); MAC(q1[1], MU[0]);
+    COL_END(unused);
+    MAC(q1[0], MU[2]); MAC(q1[1], MU[1]); MAC(q1[2], MU[0]);
+    COL_END(unused);
+    MAC(q1[0], MU[3]); MAC(q1[1], MU[2]); MAC(q1[2], MU[1]); MAC(q1[3], MU[0]);
+    COL_END(unused);
+    MAC(q1[0], MU[4]); MAC(q1[1], MU[3]); MAC(q1[2], MU[2]); MAC(q1[3], MU[1]); MAC(q1[4], MU[0]);
+    COL_END(unused);
+    MAC(q1[1], MU[4]); MAC(q1[2], MU[3]); MAC(q1[3], MU[2]); MAC(q1[4], MU[1]);
+    COL_END(q3[0]);
+    MAC(q1[2], MU[4]); MAC(q1[3], MU[3]); MAC(q1[4], MU[2]);
+    COL_END(q3[1]);
+    MAC(q1[3], MU[4]); MAC(q1[4], MU[3]);
+    COL_END(q3[2]);
+    MAC(q1[4], MU[4]);
+    COL_END(q3[3]);
+    (void) unused;
+
+    /* r2 = q3 * l mod b^4, with l = L[0] + L[1] b + 2^252 */
+    acc = 0;
+    MAC(q3[0], L[0]);
+    COL_END(r2[0]);
+    MAC(q3[0], L[1]); MAC(q3[1], L[0]);
+    COL_END(r2[1]);
+    MAC(q3[1], L[1]); MAC(q3[2], L[0]);
+    COL_END(r2[2]);
+    MAC(q3[2], L[1]); MAC(q3[3], L[0]);
+    acc += q3[0] << 60;
+    r2[3] = (uint64_t) acc;
+
+    /* r = x - q3 l is below 3l < b^4, so computing it mod b^4 is exact */
+    SBB(out[0], x[0], r2[0]);
+    SBB(out[1], x[1], r2[1]);
+    SBB(out[2], x[2], r2[2]);
+    SBB(out[3], x[3], r2[3]);
+
+    sub_l_if_greater(out);
+    sub_l_if_greater(out);
+}
+
+/*
+Input:
+  s[0]+256*s[1]+...+256^63*s[63] = s
+
+Output:
+  s[0]+256*s[1]+...+256^31*s[31] = s mod l
+  where l = 2^252 + 27742317777372353535851937790883648493.
+  Overwrites s in place.
+*/
+
+void sc_reduce(unsigned char *s) {
+    uint64_t x[8];
+    uint64_t r[4];
+
+    x[0] = load_8(s);
+    x[1] = load_8(s + 8);
+    x[2] = load_8(s + 16);
+    x[3] = load_8(s + 24);
+    x[4] = load_8(s + 32);
+    x[5] = load_8(s + 40);
+    x[6] = load_8(s + 48);
+    x[7] = load_8(s + 56);
+
+    barrett_reduce(r, x);
+
+    store_8(s, r[0]);
+    store_8(s + 8, r[1]);
+    store_8(s + 16, r[2]);
+    store_8(s + 24, r[3]);
+}
+
+/*
+Input:
+  a[0]+256*a[1]+...+256^31*a[31] = a
+  b[0]+256*b[1]+...+256^31*b[31] = b
+  c[0]+256*c[1]+...+256^31*c[31] = c
+
+Output:
+  s[0]+256*s[1]+...+256^31*s[31] = (ab+c) mod l
+  where l = 2^252 + 27742317777372353535851937790883648493.
+*/
+
+void sc_muladd(unsigned char *s, const unsigned char *a, const unsigned char *b, const unsigned char *c) {
+    uint64_t al[4];
+    uint64_t bl[4];
+    uint64_t x[8];
+    uint64_t r[4];
+    uint128_t acc = 0;
+    uint128_t hi = 0;
+    uint128_t t;
+
+    al[0] = load_8(a);
+    al[1] = load_8(a + 8);
+    al[2] = load_8(a + 16);
+    al[3] = load_8(a + 24);
+    bl[0] = load_8(b);
+    bl[1] = load_8(b + 8);
+    bl[2] = load_8(b + 16);
+    bl[3] = load_8(b + 24);
+
+    /* x = ab + c < 2^512, c enters as the low limbs of the first columns */
+    acc = load_8(c);
+    MAC(al[0], bl[0]);
+    COL_END(x[0]);
+    acc += load_8(c + 8);
+    MAC(al[0], bl[1]); MAC(al[1], bl[0]);
+    COL_END(x[1]);
+    acc += load_8(c + 16);
+    MAC(al[0], bl[2]); MAC(al[1], bl[1]); MAC(al[2], bl[0]);
+    COL_END(x[2]);
+    acc += load_8(c + 24);
+    MAC(al[0], bl[3]); MAC(al[1], bl[2]); MAC(al[2], bl[1]); MAC(al[3], bl[0]);
+    COL_END(x[3]);
+    MAC(al[1], bl[3]); MAC(al[2], bl[2]); MAC(al[3], bl[1]);
+    COL_END(x[4]);
+    MAC(al[2], bl[3]); MAC(al[3], bl[2]);
+    COL_END(x[5]);
+    MAC(al[3], bl[3]);
+    COL_END(x[6]);
+    x[7] = (uint64_t) acc;
+
+    barrett_reduce(r, x);
+
+    store_8(s, r[0]);
+    store_8(s + 8, r[1]);
+    store_8(s + 16, r[2]);
+    store_8(s + 24, r[3]);
+}
+
+#endif /* ED25519_SC64 */
@@ -1,40 +1,315 @@
+/* O_CLOEXEC is POSIX 2008, hidden under a strict -std=c11 */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+/* which on Apple platforms hides getentropy unless asked for */
+#if defined(__APPLE__) && !defined(_DARWIN_C_SOURCE)
+#define _DARWIN_C_SOURCE
+#endif
+
 #include "kined25519.h"
+#include "stats.h"
 
 #ifndef ED25519_NO_SEED
 
+/*
+    Seeds come from a per-thread ChaCha20 generator keyed from the operating
+    system. After every request the generator replaces its key with fresh
+    keystream, so earlier output can't be recovered from its state. It
+    rekeys from the system every DRBG_RESEED_BYTES bytes, and in the child
+    after a fork.
+
+    Windows keeps using CryptGenRandom directly.
+*/
+
 #ifdef _WIN32
 #include <windows.h>
 #include <wincrypt.h>
 #else
-#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <string.h>
+#include "fixedint.h"
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/random.h>
+#endif
 #endif
 
-int ed25519_create_seed(unsigned char *seed) {
 #ifdef _WIN32
+
+static int os_random(unsigned char *out, size_t len) {
     HCRYPTPROV prov;
 
     if (!CryptAcquireContext(&prov, NULL, NULL, PROV_RSA_FULL, CRYPT_VERIFYCONTEXT))  {
         return 1;
     }
 
-    if (!CryptGenRandom(prov, 32, seed))  {
+    if (!CryptGenRandom(prov, (DWORD) len, out))  {
         CryptReleaseContext(prov, 0);
         return 1;
     }
 
     CryptReleaseContext(prov, 0);
+    return 0;
+}
+
+static int generate_seeds(size_t count, unsigned char *seeds) {
+    return os_random(seeds, count * 32);
+}
+
 #else
-    FILE *f = fopen("/dev/urandom", "rb");
 
-    if (f == NULL) {
+#define DRBG_RESEED_BYTES (1 << 20)
+#define DRBG_CHUNK_BYTES (64 * 1024) /* rekeyed from keystream after each chunk */
+
+typedef struct {
+    uint32_t key[8];
+    size_t generated; /* bytes since the last system reseed */
+    unsigned long fork_generation;
+    int seeded;
+} drbg_state;
+
+static _Thread_local drbg_state drbg;
+static volatile unsigned long fork_generation = 0;
+static pthread_once_t fork_once = PTHREAD_ONCE_INIT;
+
+static void on_fork_child(void) {
+    fork_generation++;
+}
+
+static void register_fork_handler(void) {
+    pthread_atfork(NULL, NULL, on_fork_child);
+}
+
+static int urandom(unsigned char *out, size_t len) {
+    ssize_t n;
+    int fd;
+
+    do {
+        fd = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+    } while (fd < 0 && errno == EINTR);
+
+    if (fd < 0) {
         return 1;
     }
 
-    fread(seed, 1, 32, f);
-    fclose(f);
+    while (len > 0) {
+        n = read(fd, out, len);
+
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if (n <= 0) {
+            close(fd);
+            return 1;
+        }
+
+        out += n;
+        len -= (size_t) n;
+    }
+
+    close(fd);
+    return 0;
+}
+
+static int os_random(unsigned char *out, size_t len) {
+#if defined(__linux__)
+    ssize_t n;
+
+    while (len > 0) {
+        n = getrandom(out, len, 0);
+
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if (n < 0) {
+            return urandom(out, len); /* kernels before 3.17 */
+        }
+
+        out += n;
+        len -= (size_t) n;
+    }
+
+    return 0;
+#elif defined(__APPLE__)
+    size_t n;
+
+    /* getentropy is iOS 10 and macOS 10.12; older systems read /dev/urandom */
+    if (!__builtin_available(iOS 10.0, macOS 10.12, tvOS 10.0, watchOS 3.0, *)) {
+        return urandom(out, len);
+    }
+
+    /* getentropy returns at most 256 bytes per call */
+    while (len > 0) {
+        n = len < 256 ? len : 256;
+
+        if (getentropy(out, n) != 0) {
+            return urandom(out, len);
+        }
+
+        out += n;
+        len -= n;
+    }
+
+    return 0;
+#else
+    return urandom(out, len);
 #endif
+}
+
+#define ROTL32(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+
+#define QUARTERROUND(a, b, c, d) \
+    a += b; d ^= a; d = ROTL32(d, 16); \
+    c += d; b ^= c; b = ROTL32(b, 12); \
+    a += b; d ^= a; d = ROTL32(d, 8); \
+    c += d; b ^= c; b = ROTL32(b, 7)
 
+/* one 64-byte ChaCha20 block with a zero nonce */
+static void chacha20_block(unsigned char *out, const uint32_t *key, uint64_t counter) {
+    uint32_t input[16];
+    uint32_t x[16];
+    int i;
+
+    input[0] = 0x61707865;
+    input[1] = 0x3320646e;
+    input[2] = 0x79622d32;
+    input[3] = 0x6b206574;
+
+    for (i = 0; i < 8; ++i) {
+        input[4 + i] = key[i];
+    }
+
+    input[12] = (uint32_t) counter;
+    input[13] = (uint32_t) (counter >> 32);
+    input[14] = 0;
+    input[15] = 0;
+
+    for (i = 0; i < 16; ++i) {
+        x[i] = input[i];
+    }
+
+    for (i = 0; i < 10; ++i) {
+        QUARTERROUND(x[0], x[4], x[8], x[12]);
+        QUARTERROUND(x[1], x[5], x[9], x[13]);
+        QUARTERROUND(x[2], x[6], x[10], x[14]);
+        QUARTERROUND(x[3], x[7], x[11], x[15]);
+        QUARTERROUND(x[0], x[5], x[10], x[15]);
+        QUARTERROUND(x[1], x[6], x[11], x[12]);
+        QUARTERROUND(x[2], x[7], x[8], x[13]);
+        QUARTERROUND(x[3], x[4], x[9], x[14]);
+    }
+
+    for (i = 0; i < 16; ++i) {
+        x[i] += input[i];
+        out[4 * i + 0] = (unsigned char) x[i];
+        out[4 * i + 1] = (unsigned char) (x[i] >> 8);
+        out[4 * i + 2] = (unsigned char) (x[i] >> 16);
+        out[4 * i + 3] = (unsigned char) (x[i] >> 24);
+    }
+}
+
+static void load_key(uint32_t *key, const unsigned char *in) {
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        key[i] = (uint32_t) in[4 * i] | ((uint32_t) in[4 * i + 1] << 8) |
+                 ((uint32_t) in[4 * i + 2] << 16) | ((uint32_t) in[4 * i + 3] << 24);
+    }
+}
+
+static void wipe(void *p, size_t len) {
+    volatile unsigned char *v = (volatile unsigned char *) p;
+
+    while (len--) {
+        *v++ = 0;
+    }
+}
+
+static int drbg_reseed(void) {
+    unsigned char key[32];
+
+    pthread_once(&fork_once, register_fork_handler);
+
+    if (os_random(key, sizeof(key)) != 0) {
+        return 1;
+    }
+
+    load_key(drbg.key, key);
+    wipe(key, sizeof(key));
+
+    drbg.generated = 0;
+    drbg.fork_generation = fork_generation;
+    drbg.seeded = 1;
     return 0;
 }
 
+/* fills out with keystream, then rekeys from the block that follows it */
+static void drbg_chunk(unsigned char *out, size_t len) {
+    unsigned char block[64];
+    uint64_t counter = 0;
+
+    while (len >= 64) {
+        chacha20_block(out, drbg.key, counter++);
+        out += 64;
+        len -= 64;
+    }
+
+    if (len > 0) {
+        chacha20_block(block, drbg.key, counter++);
+        memcpy(out, block, len);
+    }
+
+    chacha20_block(block, drbg.key, counter);
+    load_key(drbg.key, block);
+    wipe(block, sizeof(block));
+}
+
+static int generate_seeds(size_t count, unsigned char *seeds) {
+    size_t len = count * 32;
+    size_t n;
+
+    while (len > 0) {
+        if (!drbg.seeded || drbg.fork_generation != fork_generation || drbg.generated >= DRBG_RESEED_BYTES) {
+            if (drbg_reseed() != 0) {
+                return 1;
+            }
+        }
+
+        n = len < DRBG_CHUNK_BYTES ? len : DRBG_CHUNK_BYTES;
+        drbg_chunk(seeds, n);
+        drbg.generated += n;
+        seeds += n;
+        len -= n;
+    }
+
+    return 0;
+}
+
+#endif
+
+int ed25519_create_seeds(size_t count, unsigned char *seeds) {
+    int err;
+    STATS_START(timer);
+
+    /* count * 32 would wrap */
+    if (count > (size_t) -1 / 32) {
+        return 1;
+    }
+
+    err = generate_seeds(count, seeds);
+    STATS_STOP(timer, CREATE_SEEDS);
+    return err;
+}
+
+int ed25519_create_seed(unsigned char *seed) {
+    return ed25519_create_seeds(1, seed);
+}
+
 #endif
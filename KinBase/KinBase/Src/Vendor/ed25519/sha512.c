@@ -11,6 +11,8 @@
 
 #include "fixedint.h"
 #include "sha512.h"
+#include "cpu.h"
+#include "stats.h"
 
 /* the K array */
 static const uint64_t K[80] = {
@@ -88,7 +90,7 @@ static const uint64_t K[80] = {
 #endif
 
 /* compress 1024-bits */
-static int sha512_compress(sha512_context *md, unsigned char *buf)
+ED25519_INLINE int sha512_compress_body(sha512_context *md, const unsigned char *buf)
 {
     uint64_t S[8], W[80], t0, t1;
     int i;
@@ -139,6 +141,62 @@ static int sha512_compress(sha512_context *md, unsigned char *buf)
 }
 
 
+/*
+    sha512_compress goes through a kernel picked on first use, the BMI2
+    build lets the compiler use rorx for the rotations.
+*/
+
+typedef int (*sha512_compress_fn)(sha512_context *md, const unsigned char *buf);
+
+static int sha512_compress_generic(sha512_context *md, const unsigned char *buf)
+{
+    return sha512_compress_body(md, buf);
+}
+
+#ifdef ED25519_DISPATCH_X86
+ED25519_TARGET("bmi2") static int sha512_compress_bmi2(sha512_context *md, const unsigned char *buf)
+{
+    return sha512_compress_body(md, buf);
+}
+#endif
+
+static sha512_compress_fn sha512_compress_select(void)
+{
+#ifdef ED25519_DISPATCH_X86
+    if (ed25519_cpu_features() & ED25519_CPU_BMI2) {
+        return sha512_compress_bmi2;
+    }
+#endif
+
+    return sha512_compress_generic;
+}
+
+static int sha512_compress_resolve(sha512_context *md, const unsigned char *buf);
+
+static sha512_compress_fn sha512_compress_impl = sha512_compress_resolve;
+
+static int sha512_compress_resolve(sha512_context *md, const unsigned char *buf)
+{
+    sha512_compress_fn fn = sha512_compress_select();
+    DISPATCH_STORE(sha512_compress_impl, fn);
+    return fn(md, buf);
+}
+
+static int sha512_compress(sha512_context *md, const unsigned char *buf)
+{
+    int err;
+    STATS_START(timer);
+    err = DISPATCH_LOAD(sha512_compress_impl)(md, buf);
+    STATS_STOP(timer, SHA512_BLOCK);
+    return err;
+}
+
+const char *sha512_backend(void)
+{
+    return sha512_compress_select() == sha512_compress_generic ? "generic" : "bmi2";
+}
+
+
 /**
    Initialize the hash state
    @param md   The hash state you wish to initialize
@@ -273,3 +331,335 @@ int sha512(const unsigned char *message, size_t message_len, unsigned char *out)
     if ((ret = sha512_final(&ctx, out))) return ret;
     return 0;
 }
+
+/*
+    Multi-buffer hashing. With GCC/clang vector extensions the four lanes
+    run through one compression as 4 x 64-bit vectors. The portable build
+    splits them into 2 x 128-bit SSE2/NEON operations; on x86-64 AVX2 and
+    AVX-512VL (which has 64-bit rotates) kernels are picked at runtime.
+    Other compilers compress the lanes one at a time.
+*/
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(ED25519_NO_SHA512_SIMD)
+#define SHA512_SIMD
+#endif
+
+#ifdef SHA512_SIMD
+
+typedef uint64_t sha512_v4 __attribute__((vector_size(32)));
+
+#define V_ROR(x, n)     (((x) >> (n)) | ((x) << (64 - (n))))
+#define V_Ch(x,y,z)     (z ^ (x & (y ^ z)))
+#define V_Maj(x,y,z)    (((x | y) & z) | (x & y))
+#define V_Sigma0(x)     (V_ROR(x, 28) ^ V_ROR(x, 34) ^ V_ROR(x, 39))
+#define V_Sigma1(x)     (V_ROR(x, 14) ^ V_ROR(x, 18) ^ V_ROR(x, 41))
+#define V_Gamma0(x)     (V_ROR(x, 1) ^ V_ROR(x, 8) ^ ((x) >> 7))
+#define V_Gamma1(x)     (V_ROR(x, 19) ^ V_ROR(x, 61) ^ ((x) >> 6))
+
+ED25519_INLINE void sha512_compress_x4_body(sha512_context *const *md, const unsigned char *const *buf)
+{
+    sha512_v4 S[8], W[80], t0, t1, k;
+    uint64_t w;
+    int i, l;
+
+    for (i = 0; i < 8; i++) {
+        for (l = 0; l < SHA512_LANES; l++) {
+            S[i][l] = md[l]->state[i];
+        }
+    }
+
+    for (i = 0; i < 16; i++) {
+        for (l = 0; l < SHA512_LANES; l++) {
+            LOAD64H(w, buf[l] + (8*i));
+            W[i][l] = w;
+        }
+    }
+
+    for (i = 16; i < 80; i++) {
+        W[i] = V_Gamma1(W[i - 2]) + W[i - 7] + V_Gamma0(W[i - 15]) + W[i - 16];
+    }
+
+    #define RND(a,b,c,d,e,f,g,h,i) \
+    k = (sha512_v4) { K[i], K[i], K[i], K[i] }; \
+    t0 = h + V_Sigma1(e) + V_Ch(e, f, g) + k + W[i]; \
+    t1 = V_Sigma0(a) + V_Maj(a, b, c);\
+    d += t0; \
+    h  = t0 + t1;
+
+    for (i = 0; i < 80; i += 8) {
+       RND(S[0],S[1],S[2],S[3],S[4],S[5],S[6],S[7],i+0);
+       RND(S[7],S[0],S[1],S[2],S[3],S[4],S[5],S[6],i+1);
+       RND(S[6],S[7],S[0],S[1],S[2],S[3],S[4],S[5],i+2);
+       RND(S[5],S[6],S[7],S[0],S[1],S[2],S[3],S[4],i+3);
+       RND(S[4],S[5],S[6],S[7],S[0],S[1],S[2],S[3],i+4);
+       RND(S[3],S[4],S[5],S[6],S[7],S[0],S[1],S[2],i+5);
+       RND(S[2],S[3],S[4],S[5],S[6],S[7],S[0],S[1],i+6);
+       RND(S[1],S[2],S[3],S[4],S[5],S[6],S[7],S[0],i+7);
+   }
+
+   #undef RND
+
+    for (i = 0; i < 8; i++) {
+        for (l = 0; l < SHA512_LANES; l++) {
+            md[l]->state[i] += S[i][l];
+        }
+    }
+}
+
+typedef void (*sha512_compress_x4_fn)(sha512_context *const *md, const unsigned char *const *buf);
+
+static void sha512_compress_x4_vector(sha512_context *const *md, const unsigned char *const *buf)
+{
+    sha512_compress_x4_body(md, buf);
+}
+
+#ifdef ED25519_DISPATCH_X86
+ED25519_TARGET("avx2") static void sha512_compress_x4_avx2(sha512_context *const *md, const unsigned char *const *buf)
+{
+    sha512_compress_x4_body(md, buf);
+}
+
+ED25519_TARGET("avx512f,avx512vl") static void sha512_compress_x4_avx512vl(sha512_context *const *md, const unsigned char *const *buf)
+{
+    sha512_compress_x4_body(md, buf);
+}
+#endif
+
+static sha512_compress_x4_fn sha512_compress_x4_select(void)
+{
+#ifdef ED25519_DISPATCH_X86
+    unsigned int features = ed25519_cpu_features();
+
+    if (features & ED25519_CPU_AVX512VL) {
+        return sha512_compress_x4_avx512vl;
+    }
+
+    if (features & ED25519_CPU_AVX2) {
+        return sha512_compress_x4_avx2;
+    }
+#endif
+
+    return sha512_compress_x4_vector;
+}
+
+static void sha512_compress_x4_resolve(sha512_context *const *md, const unsigned char *const *buf);
+
+static sha512_compress_x4_fn sha512_compress_x4_impl = sha512_compress_x4_resolve;
+
+static void sha512_compress_x4_resolve(sha512_context *const *md, const unsigned char *const *buf)
+{
+    sha512_compress_x4_fn fn = sha512_compress_x4_select();
+    DISPATCH_STORE(sha512_compress_x4_impl, fn);
+    fn(md, buf);
+}
+
+static void sha512_compress_x4(sha512_context *const *md, const unsigned char *const *buf)
+{
+    STATS_START(timer);
+    DISPATCH_LOAD(sha512_compress_x4_impl)(md, buf);
+    STATS_STOP(timer, SHA512X4_BLOCK);
+}
+
+#endif
+
+/* compresses the lanes with a non-NULL block */
+static void sha512x4_compress(sha512x4_context *md, const unsigned char *const *blocks)
+{
+#ifdef SHA512_SIMD
+    static const unsigned char zero[128] = {0};
+    sha512_context dummy;
+    sha512_context *lanes[SHA512_LANES];
+    const unsigned char *in[SHA512_LANES];
+    int ready = 0;
+#endif
+    int l;
+
+#ifdef SHA512_SIMD
+    for (l = 0; l < SHA512_LANES; l++) {
+        ready += blocks[l] != NULL;
+    }
+
+    /* a single lane is cheaper on its own */
+    if (ready > 1) {
+        sha512_init(&dummy);
+
+        for (l = 0; l < SHA512_LANES; l++) {
+            lanes[l] = blocks[l] ? &md->lane[l] : &dummy;
+            in[l] = blocks[l] ? blocks[l] : zero;
+        }
+
+        sha512_compress_x4(lanes, in);
+        return;
+    }
+#endif
+
+    for (l = 0; l < SHA512_LANES; l++) {
+        if (blocks[l]) {
+            sha512_compress(&md->lane[l], blocks[l]);
+        }
+    }
+}
+
+const char *sha512x4_backend(void)
+{
+#ifdef SHA512_SIMD
+    sha512_compress_x4_fn fn = sha512_compress_x4_select();
+
+#ifdef ED25519_DISPATCH_X86
+    if (fn == sha512_compress_x4_avx512vl) return "avx512vl";
+    if (fn == sha512_compress_x4_avx2) return "avx2";
+#endif
+
+    (void) fn;
+    return "vector";
+#else
+    return "scalar";
+#endif
+}
+
+int sha512x4_init(sha512x4_context * md)
+{
+    int l;
+
+    if (md == NULL) return 1;
+
+    for (l = 0; l < SHA512_LANES; l++) {
+        sha512_init(&md->lane[l]);
+    }
+
+    return 0;
+}
+
+/**
+   Process one block of memory per lane, in[l] may be NULL if inlen[l] is 0
+   @param md     The hash state
+   @param in     The data to hash, one pointer per lane
+   @param inlen  The length of the data of each lane (octets)
+   @return 0 if successful
+*/
+int sha512x4_update(sha512x4_context * md, const unsigned char *const *in, const size_t *inlen)
+{
+    const unsigned char *p[SHA512_LANES];
+    const unsigned char *blocks[SHA512_LANES];
+    size_t left[SHA512_LANES];
+    size_t n, i;
+    int l, ready;
+
+    if (md == NULL) return 1;
+    if (in == NULL || inlen == NULL) return 1;
+
+    for (l = 0; l < SHA512_LANES; l++) {
+        if (in[l] == NULL && inlen[l] != 0) return 1;
+        if (md->lane[l].curlen >= sizeof(md->lane[l].buf)) return 1;
+        p[l] = in[l];
+        left[l] = inlen[l];
+    }
+
+    /* every round consumes a full block or all remaining input of each lane */
+    for (;;) {
+        ready = 0;
+
+        for (l = 0; l < SHA512_LANES; l++) {
+            sha512_context *lane = &md->lane[l];
+            blocks[l] = NULL;
+
+            if (lane->curlen == 0 && left[l] >= 128) {
+                blocks[l] = p[l];
+                p[l] += 128;
+                left[l] -= 128;
+            } else if (left[l] > 0) {
+                n = MIN(left[l], (128 - lane->curlen));
+
+                for (i = 0; i < n; i++) {
+                    lane->buf[i + lane->curlen] = p[l][i];
+                }
+
+                lane->curlen += n;
+                p[l] += n;
+                left[l] -= n;
+
+                if (lane->curlen == 128) {
+                    blocks[l] = lane->buf;
+                    lane->curlen = 0;
+                }
+            }
+
+            if (blocks[l]) {
+                lane->length += 8*128;
+                ready++;
+            }
+        }
+
+        if (!ready) {
+            break;
+        }
+
+        sha512x4_compress(md, blocks);
+    }
+
+    return 0;
+}
+
+/**
+   Terminate the hash of every lane
+   @param md   The hash state
+   @param out  [out] The destination of each lane's hash (64 bytes), may be NULL
+   @return 0 if successful
+*/
+int sha512x4_final(sha512x4_context * md, unsigned char *const *out)
+{
+    const unsigned char *blocks[SHA512_LANES];
+    sha512_context *lane;
+    int i, l, extra = 0;
+
+    if (md == NULL) return 1;
+    if (out == NULL) return 1;
+
+    /* the '1' bit, and a block of its own when the length doesn't fit */
+    for (l = 0; l < SHA512_LANES; l++) {
+        lane = &md->lane[l];
+        blocks[l] = NULL;
+
+        if (lane->curlen >= sizeof(lane->buf)) return 1;
+
+        lane->length += lane->curlen * UINT64_C(8);
+        lane->buf[lane->curlen++] = (unsigned char)0x80;
+
+        if (lane->curlen > 112) {
+            while (lane->curlen < 128) {
+                lane->buf[lane->curlen++] = (unsigned char)0;
+            }
+
+            blocks[l] = lane->buf;
+            lane->curlen = 0;
+            extra = 1;
+        }
+    }
+
+    if (extra) {
+        sha512x4_compress(md, blocks);
+    }
+
+    for (l = 0; l < SHA512_LANES; l++) {
+        lane = &md->lane[l];
+
+        while (lane->curlen < 120) {
+            lane->buf[lane->curlen++] = (unsigned char)0;
+        }
+
+        STORE64H(lane->length, lane->buf+120);
+        blocks[l] = lane->buf;
+    }
+
+    sha512x4_compress(md, blocks);
+
+    for (l = 0; l < SHA512_LANES; l++) {
+        if (out[l]) {
+            for (i = 0; i < 8; i++) {
+                STORE64H(md->lane[l].state[i], out[l]+(8*i));
+            }
+        }
+    }
+
+    return 0;
+}
@@ -18,4 +18,25 @@ int sha512_final(sha512_context * md, unsigned char *out);
 int sha512_update(sha512_context * md, const unsigned char *in, size_t inlen);
 int sha512(const unsigned char *message, size_t message_len, unsigned char *out);
 
+/*
+    Multi-buffer SHA-512 over four independent messages. Blocks of all lanes
+    are compressed together, so lanes with similar lengths hash in about the
+    time of one. Lanes that aren't needed can be fed nothing (NULL, 0) and
+    their output skipped by passing a NULL out pointer.
+*/
+
+#define SHA512_LANES 4
+
+typedef struct sha512x4_context_ {
+    sha512_context lane[SHA512_LANES];
+} sha512x4_context;
+
+int sha512x4_init(sha512x4_context * md);
+int sha512x4_update(sha512x4_context * md, const unsigned char *const *in, const size_t *inlen);
+int sha512x4_final(sha512x4_context * md, unsigned char *const *out);
+
+/* names of the compression kernels in use */
+const char *sha512_backend(void);
+const char *sha512x4_backend(void);
+
 #endif
@@ -1,31 +1,109 @@
+#include <stdlib.h>
+
 #include "kined25519.h"
 #include "sha512.h"
 #include "ge.h"
 #include "sc.h"
+#include "sign.h"
+#include "stats.h"
 
 
-void ed25519_sign(unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key, const unsigned char *private_key) {
-    sha512_context hash;
+static void sha512_update_iov(sha512_context *hash, const ed25519_iovec *iov, size_t iovcnt) {
+    size_t i;
+
+    for (i = 0; i < iovcnt; ++i) {
+        sha512_update(hash, iov[i].data, iov[i].len);
+    }
+}
+
+/* hash is the nonce state with the key prefix already absorbed */
+static void sign_iov(unsigned char *signature, sha512_context *hash, const ed25519_iovec *iov, size_t iovcnt, const unsigned char *public_key, const unsigned char *scalar) {
     unsigned char hram[64];
     unsigned char r[64];
     ge_p3 R;
 
+    STATS_START(timer);
 
-    sha512_init(&hash);
-    sha512_update(&hash, private_key + 32, 32);
-    sha512_update(&hash, message, message_len);
-    sha512_final(&hash, r);
+    sha512_update_iov(hash, iov, iovcnt);
+    sha512_final(hash, r);
 
     sc_reduce(r);
     ge_scalarmult_base(&R, r);
     ge_p3_tobytes(signature, &R);
 
-    sha512_init(&hash);
-    sha512_update(&hash, signature, 32);
-    sha512_update(&hash, public_key, 32);
-    sha512_update(&hash, message, message_len);
-    sha512_final(&hash, hram);
+    sha512_init(hash);
+    sha512_update(hash, signature, 32);
+    sha512_update(hash, public_key, 32);
+    sha512_update_iov(hash, iov, iovcnt);
+    sha512_final(hash, hram);
 
     sc_reduce(hram);
-    sc_muladd(signature + 32, hram, private_key, r);
+    sc_muladd(signature + 32, hram, scalar, r);
+    STATS_STOP(timer, SIGN);
+}
+
+void ed25519_sign(unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key, const unsigned char *private_key) {
+    ed25519_iovec iov;
+
+    iov.data = message;
+    iov.len = message_len;
+    ed25519_sign_iov(signature, &iov, 1, public_key, private_key);
+}
+
+void ed25519_sign_iov(unsigned char *signature, const ed25519_iovec *iov, size_t iovcnt, const unsigned char *public_key, const unsigned char *private_key) {
+    sha512_context hash;
+
+    sha512_init(&hash);
+    sha512_update(&hash, private_key + 32, 32);
+    sign_iov(signature, &hash, iov, iovcnt, public_key, private_key);
+}
+
+ed25519_signer *ed25519_signer_create(const unsigned char *public_key, const unsigned char *private_key) {
+    ed25519_signer *signer;
+    int i;
+
+    signer = (ed25519_signer *) malloc(sizeof(ed25519_signer));
+
+    if (signer == NULL) {
+        return NULL;
+    }
+
+    for (i = 0; i < 32; ++i) {
+        signer->scalar[i] = private_key[i];
+        signer->public_key[i] = public_key[i];
+    }
+
+    sha512_init(&signer->prefix);
+    sha512_update(&signer->prefix, private_key + 32, 32);
+    return signer;
+}
+
+void ed25519_signer_destroy(ed25519_signer *signer) {
+    volatile unsigned char *p = (volatile unsigned char *) signer;
+    size_t i;
+
+    if (signer == NULL) {
+        return;
+    }
+
+    /* the context holds the secret scalar and nonce prefix */
+    for (i = 0; i < sizeof(ed25519_signer); ++i) {
+        p[i] = 0;
+    }
+
+    free(signer);
+}
+
+void ed25519_signer_sign(const ed25519_signer *signer, unsigned char *signature, const unsigned char *message, size_t message_len) {
+    ed25519_iovec iov;
+
+    iov.data = message;
+    iov.len = message_len;
+    ed25519_signer_sign_iov(signer, signature, &iov, 1);
+}
+
+void ed25519_signer_sign_iov(const ed25519_signer *signer, unsigned char *signature, const ed25519_iovec *iov, size_t iovcnt) {
+    sha512_context hash = signer->prefix;
+
+    sign_iov(signature, &hash, iov, iovcnt, signer->public_key, signer->scalar);
 }
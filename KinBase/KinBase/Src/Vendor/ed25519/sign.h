@@ -0,0 +1,13 @@
+#ifndef SIGN_H
+#define SIGN_H
+
+#include "kined25519.h"
+#include "sha512.h"
+
+struct ed25519_signer {
+    unsigned char scalar[32];
+    unsigned char public_key[32];
+    sha512_context prefix; /* SHA-512 state with private_key[32..63] absorbed */
+};
+
+#endif
@@ -0,0 +1,104 @@
+#include "kined25519.h"
+#include "sha512.h"
+#include "ge.h"
+#include "sc.h"
+#include "sign.h"
+#include "pool.h"
+#include "stats.h"
+
+/*
+    Batch signing on an ed25519_pool, see pool.c. Each pool task signs up to
+    SHA512_LANES jobs, hashing their nonces r = H(prefix, M) and challenges
+    h = H(R, A, M) together with sha512x4 as batch_verify.c does. Each job
+    writes only its own signature, so results land in order, and nothing is
+    allocated.
+*/
+
+typedef struct {
+    const ed25519_sign_job *jobs;
+    size_t count;
+} sign_batch;
+
+static void sign_group(void *ctx, size_t index) {
+    const sign_batch *batch = (const sign_batch *) ctx;
+    const ed25519_sign_job *jobs = batch->jobs + index * SHA512_LANES;
+    const unsigned char *scalars[SHA512_LANES];
+    const unsigned char *public_keys[SHA512_LANES];
+    const unsigned char *signatures[SHA512_LANES];
+    const unsigned char *messages[SHA512_LANES];
+    unsigned char *out[SHA512_LANES];
+    unsigned char r[SHA512_LANES][64];
+    unsigned char hram[SHA512_LANES][64];
+    size_t point_lens[SHA512_LANES];
+    size_t message_lens[SHA512_LANES];
+    sha512x4_context hash;
+    ge_p3 R;
+    size_t count;
+    size_t l;
+
+    STATS_START(timer);
+
+    count = batch->count - index * SHA512_LANES;
+    count = count < SHA512_LANES ? count : SHA512_LANES;
+
+    for (l = 0; l < SHA512_LANES; ++l) {
+        if (l < count) {
+            const ed25519_sign_job *job = &jobs[l];
+
+            if (job->signer != NULL) {
+                hash.lane[l] = job->signer->prefix;
+                scalars[l] = job->signer->scalar;
+                public_keys[l] = job->signer->public_key;
+            } else {
+                sha512_init(&hash.lane[l]);
+                sha512_update(&hash.lane[l], job->private_key + 32, 32);
+                scalars[l] = job->private_key;
+                public_keys[l] = job->public_key;
+            }
+
+            signatures[l] = job->signature;
+            messages[l] = job->message;
+            point_lens[l] = 32;
+            message_lens[l] = job->message_len;
+            out[l] = r[l];
+        } else {
+            sha512_init(&hash.lane[l]);
+            public_keys[l] = signatures[l] = messages[l] = NULL;
+            point_lens[l] = message_lens[l] = 0;
+            out[l] = NULL;
+        }
+    }
+
+    sha512x4_update(&hash, messages, message_lens);
+    sha512x4_final(&hash, out);
+    sc_reduce_n(r[0], count);
+
+    for (l = 0; l < count; ++l) {
+        ge_scalarmult_base(&R, r[l]);
+        ge_p3_tobytes(jobs[l].signature, &R);
+        out[l] = hram[l];
+    }
+
+    sha512x4_init(&hash);
+    sha512x4_update(&hash, signatures, point_lens);
+    sha512x4_update(&hash, public_keys, point_lens);
+    sha512x4_update(&hash, messages, message_lens);
+    sha512x4_final(&hash, out);
+    sc_reduce_n(hram[0], count);
+
+    for (l = 0; l < count; ++l) {
+        sc_muladd(jobs[l].signature + 32, hram[l], scalars[l], r[l]);
+    }
+
+    STATS_STOP_N(timer, SIGN, count);
+}
+
+void ed25519_sign_batch(const ed25519_sign_job *jobs, size_t count, ed25519_pool *pool) {
+    sign_batch batch;
+    STATS_START(timer);
+
+    batch.jobs = jobs;
+    batch.count = count;
+    pool_run(pool, (count + SHA512_LANES - 1) / SHA512_LANES, sign_group, &batch);
+    STATS_STOP(timer, SIGN_BATCH);
+}
@@ -0,0 +1,348 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "kined25519.h"
+#include "sha512.h"
+#include "pool.h"
+#include "stats.h"
+
+/*
+    SLIP-0010 key derivation for ed25519.
+
+        I = HMAC-SHA512(key = "ed25519 seed", data = seed)               master
+        I = HMAC-SHA512(key = chain code, data = 0x00 || key || ser32(i)) child
+
+    with the node key in the left and the chain code in the right half of I.
+    ed25519 only defines hardened children, so there is no public derivation
+    and ed25519_add_scalar isn't involved: every public key comes from its
+    node key through ed25519_create_keypair.
+*/
+
+#define HMAC_BLOCK 128
+#define RANGE_CHUNK 64 /* children per pool task, sharing one batched key encoding */
+
+typedef struct {
+    sha512_context inner; /* key ^ ipad absorbed */
+    sha512_context outer; /* key ^ opad absorbed */
+} hmac_key;
+
+typedef struct {
+    int valid;
+    size_t depth;
+    uint32_t path[ED25519_HD_MAX_DEPTH];
+    ed25519_hd_node node;
+} cache_slot;
+
+struct ed25519_hd_cache {
+    ed25519_hd_node master;
+    size_t capacity;
+    cache_slot *slots;
+};
+
+typedef struct {
+    hmac_key chain_code;
+    const ed25519_hd_node *parent;
+    unsigned char *public_keys;
+    uint32_t start;
+    size_t count;
+} range_ctx;
+
+static void wipe(void *p, size_t len) {
+    volatile unsigned char *v = (volatile unsigned char *) p;
+
+    while (len--) {
+        *v++ = 0;
+    }
+}
+
+/* key_len <= HMAC_BLOCK */
+static void hmac_key_init(hmac_key *hk, const unsigned char *key, size_t key_len) {
+    unsigned char pad[HMAC_BLOCK];
+    size_t i;
+
+    for (i = 0; i < HMAC_BLOCK; ++i) {
+        pad[i] = (i < key_len ? key[i] : 0) ^ 0x36;
+    }
+
+    sha512_init(&hk->inner);
+    sha512_update(&hk->inner, pad, HMAC_BLOCK);
+
+    for (i = 0; i < HMAC_BLOCK; ++i) {
+        pad[i] ^= 0x36 ^ 0x5c;
+    }
+
+    sha512_init(&hk->outer);
+    sha512_update(&hk->outer, pad, HMAC_BLOCK);
+    wipe(pad, sizeof(pad));
+}
+
+static void hmac(unsigned char *out, const hmac_key *hk, const unsigned char *data, size_t data_len) {
+    sha512_context hash = hk->inner;
+    unsigned char inner[64];
+
+    sha512_update(&hash, data, data_len);
+    sha512_final(&hash, inner);
+
+    hash = hk->outer;
+    sha512_update(&hash, inner, 64);
+    sha512_final(&hash, out);
+    wipe(inner, sizeof(inner));
+}
+
+static void split(ed25519_hd_node *node, unsigned char *I) {
+    memcpy(node->key, I, 32);
+    memcpy(node->chain_code, I + 32, 32);
+    wipe(I, 64);
+}
+
+/* index must be hardened */
+static void derive_child(ed25519_hd_node *child, const hmac_key *chain_code, const ed25519_hd_node *parent, uint32_t index) {
+    unsigned char data[37];
+    unsigned char I[64];
+
+    STATS_START(timer);
+    data[0] = 0;
+    memcpy(data + 1, parent->key, 32);
+    data[33] = (unsigned char) (index >> 24);
+    data[34] = (unsigned char) (index >> 16);
+    data[35] = (unsigned char) (index >> 8);
+    data[36] = (unsigned char) index;
+
+    hmac(I, chain_code, data, sizeof(data));
+    split(child, I);
+    wipe(data, sizeof(data));
+    STATS_STOP(timer, HD_DERIVE);
+}
+
+void ed25519_hd_master(ed25519_hd_node *node, const unsigned char *seed, size_t seed_len) {
+    static const unsigned char curve[] = "ed25519 seed";
+    unsigned char I[64];
+    hmac_key hk;
+
+    hmac_key_init(&hk, curve, sizeof(curve) - 1);
+    hmac(I, &hk, seed, seed_len);
+    split(node, I);
+}
+
+int ed25519_hd_derive_child(ed25519_hd_node *child, const ed25519_hd_node *parent, uint32_t index) {
+    hmac_key hk;
+
+    if (!(index & ED25519_HD_HARDENED)) {
+        return -1;
+    }
+
+    hmac_key_init(&hk, parent->chain_code, 32);
+    derive_child(child, &hk, parent, index);
+    wipe(&hk, sizeof(hk));
+    return 0;
+}
+
+/*
+    "m/44'/501'/0'" style paths. Every component must be hardened, marked
+    with ', h or H. Returns the depth, or -1 for a malformed path.
+*/
+
+int ed25519_hd_parse_path(uint32_t *indices, size_t max_depth, const char *path) {
+    size_t depth = 0;
+    uint32_t index;
+    int digits;
+
+    if (path == NULL || *path++ != 'm') {
+        return -1;
+    }
+
+    while (*path != '\0') {
+        if (*path++ != '/' || depth == max_depth) {
+            return -1;
+        }
+
+        index = 0;
+        digits = 0;
+
+        while (*path >= '0' && *path <= '9') {
+            index = index * 10 + (uint32_t) (*path++ - '0');
+
+            if (index >= ED25519_HD_HARDENED) {
+                return -1;
+            }
+
+            ++digits;
+        }
+
+        if (digits == 0 || (*path != '\'' && *path != 'h' && *path != 'H')) {
+            return -1;
+        }
+
+        ++path;
+        indices[depth++] = index | ED25519_HD_HARDENED;
+    }
+
+    return (int) depth;
+}
+
+int ed25519_hd_derive_path(ed25519_hd_node *node, const ed25519_hd_node *master, const char *path) {
+    uint32_t indices[ED25519_HD_MAX_DEPTH];
+    int depth;
+    int i;
+
+    depth = ed25519_hd_parse_path(indices, ED25519_HD_MAX_DEPTH, path);
+
+    if (depth < 0) {
+        return -1;
+    }
+
+    *node = *master;
+
+    for (i = 0; i < depth; ++i) {
+        ed25519_hd_derive_child(node, node, indices[i]);
+    }
+
+    return 0;
+}
+
+static void derive_range_chunk(void *p, size_t chunk) {
+    range_ctx *ctx = (range_ctx *) p;
+    unsigned char seeds[RANGE_CHUNK * 32];
+    unsigned char private_keys[RANGE_CHUNK * 64];
+    ed25519_hd_node child;
+    size_t first = chunk * RANGE_CHUNK;
+    size_t n = ctx->count - first < RANGE_CHUNK ? ctx->count - first : RANGE_CHUNK;
+    size_t i;
+
+    for (i = 0; i < n; ++i) {
+        derive_child(&child, &ctx->chain_code, ctx->parent, (ctx->start + (uint32_t) (first + i)) | ED25519_HD_HARDENED);
+        memcpy(seeds + 32 * i, child.key, 32);
+    }
+
+    ed25519_create_keypairs_batch(n, ctx->public_keys + 32 * first, private_keys, seeds);
+
+    wipe(&child, sizeof(child));
+    wipe(seeds, sizeof(seeds));
+    wipe(private_keys, sizeof(private_keys));
+}
+
+/*
+    Public keys of the hardened children start' .. (start + count - 1)' of
+    parent, written to public_keys (count * 32 bytes) in order. The parent's
+    HMAC key is set up once for the whole range, and chunks of children are
+    spread over pool (which may be NULL).
+*/
+
+int ed25519_hd_derive_range(unsigned char *public_keys, const ed25519_hd_node *parent, uint32_t start, size_t count, ed25519_pool *pool) {
+    range_ctx ctx;
+
+    if (start >= ED25519_HD_HARDENED || count > ED25519_HD_HARDENED - start) {
+        return -1;
+    }
+
+    STATS_START(timer);
+    hmac_key_init(&ctx.chain_code, parent->chain_code, 32);
+    ctx.parent = parent;
+    ctx.public_keys = public_keys;
+    ctx.start = start;
+    ctx.count = count;
+
+    pool_run(pool, (count + RANGE_CHUNK - 1) / RANGE_CHUNK, derive_range_chunk, &ctx);
+
+    wipe(&ctx.chain_code, sizeof(ctx.chain_code));
+    STATS_STOP(timer, HD_DERIVE_RANGE);
+    return 0;
+}
+
+ed25519_hd_cache *ed25519_hd_cache_create(const unsigned char *seed, size_t seed_len, size_t capacity) {
+    ed25519_hd_cache *cache;
+
+    if (capacity == 0) {
+        return NULL;
+    }
+
+    cache = (ed25519_hd_cache *) malloc(sizeof(ed25519_hd_cache));
+
+    if (cache == NULL) {
+        return NULL;
+    }
+
+    cache->slots = (cache_slot *) calloc(capacity, sizeof(cache_slot));
+
+    if (cache->slots == NULL) {
+        free(cache);
+        return NULL;
+    }
+
+    cache->capacity = capacity;
+    ed25519_hd_master(&cache->master, seed, seed_len);
+    return cache;
+}
+
+void ed25519_hd_cache_destroy(ed25519_hd_cache *cache) {
+    if (cache == NULL) {
+        return;
+    }
+
+    wipe(cache->slots, cache->capacity * sizeof(cache_slot));
+    wipe(&cache->master, sizeof(cache->master));
+    free(cache->slots);
+    free(cache);
+}
+
+/* FNV-1a over the path prefix, picking the one slot it may live in */
+static cache_slot *slot_for(ed25519_hd_cache *cache, const uint32_t *path, size_t depth) {
+    uint64_t h = 14695981039346656037u;
+    size_t i;
+
+    for (i = 0; i < depth; ++i) {
+        h = (h ^ path[i]) * 1099511628211u;
+    }
+
+    h = (h ^ depth) * 1099511628211u;
+    return &cache->slots[h % cache->capacity];
+}
+
+static int slot_matches(const cache_slot *slot, const uint32_t *path, size_t depth) {
+    return slot->valid && slot->depth == depth && memcmp(slot->path, path, depth * sizeof(uint32_t)) == 0;
+}
+
+/*
+    Derives path from the cache's master seed, starting at the deepest
+    ancestor still in the cache and caching every node on the way down, so
+    siblings and descendants of a recent path skip the shared prefix.
+    The cache is direct mapped and not thread safe.
+*/
+
+int ed25519_hd_cache_derive(ed25519_hd_cache *cache, ed25519_hd_node *node, const char *path) {
+    uint32_t indices[ED25519_HD_MAX_DEPTH];
+    cache_slot *slot;
+    size_t depth;
+    size_t d;
+    int parsed;
+
+    parsed = ed25519_hd_parse_path(indices, ED25519_HD_MAX_DEPTH, path);
+
+    if (parsed < 0) {
+        return -1;
+    }
+
+    depth = (size_t) parsed;
+    *node = cache->master;
+
+    for (d = depth; d > 0; --d) {
+        slot = slot_for(cache, indices, d);
+
+        if (slot_matches(slot, indices, d)) {
+            *node = slot->node;
+            break;
+        }
+    }
+
+    for (; d < depth; ++d) {
+        ed25519_hd_derive_child(node, node, indices[d]);
+
+        slot = slot_for(cache, indices, d + 1);
+        slot->valid = 1;
+        slot->depth = d + 1;
+        memcpy(slot->path, indices, (d + 1) * sizeof(uint32_t));
+        slot->node = *node;
+    }
+
+    return 0;
+}
@@ -0,0 +1,163 @@
+#include <string.h>
+
+#include "stats.h"
+
+static const char *const stat_names[ED25519_STAT_COUNT] = {
+    "fe_mul",
+    "fe_sq",
+    "fe_invert",
+    "ge_add",
+    "ge_madd",
+    "ge_dbl",
+    "ge_frombytes",
+    "ge_scalarmult_base",
+    "ge_double_scalarmult",
+    "ge_multiscalarmult",
+    "sha512_block",
+    "sha512x4_block",
+    "create_seeds",
+    "create_keypair",
+    "create_keypairs_batch",
+    "sign",
+    "sign_batch",
+    "verify",
+    "verify_prepared",
+    "verify_batch",
+    "key_exchange",
+    "key_exchange_batch",
+    "add_scalar",
+    "hd_derive",
+    "hd_derive_range"
+};
+
+const char *ed25519_stat_name(int stat) {
+    if (stat < 0 || stat >= ED25519_STAT_COUNT) {
+        return NULL;
+    }
+
+    return stat_names[stat];
+}
+
+#ifdef ED25519_STATS
+
+#include <pthread.h>
+#include <stdlib.h>
+
+/*
+    Blocks of running threads are kept in a list, and a thread's counts are
+    folded into retired when it exits. Reading while other threads record
+    gives each counter's value at some point during the read, not one
+    consistent snapshot across counters.
+*/
+
+static pthread_mutex_t registry = PTHREAD_MUTEX_INITIALIZER;
+static stats_block *live = NULL;
+static ed25519_stats retired;
+static pthread_key_t exit_key;
+static pthread_once_t exit_key_once = PTHREAD_ONCE_INIT;
+
+_Thread_local stats_block *stats_local = NULL;
+
+static void detach(void *p) {
+    stats_block *block = (stats_block *) p;
+    int i;
+
+    pthread_mutex_lock(&registry);
+
+    for (i = 0; i < ED25519_STAT_COUNT; ++i) {
+        retired.calls[i] += STATS_LOAD(block->calls[i]);
+        retired.ticks[i] += STATS_LOAD(block->ticks[i]);
+    }
+
+    if (block->prev != NULL) {
+        block->prev->next = block->next;
+    } else {
+        live = block->next;
+    }
+
+    if (block->next != NULL) {
+        block->next->prev = block->prev;
+    }
+
+    pthread_mutex_unlock(&registry);
+
+    stats_local = NULL;
+    free(block);
+}
+
+static void create_exit_key(void) {
+    pthread_key_create(&exit_key, detach);
+}
+
+stats_block *stats_attach(void) {
+    stats_block *block;
+
+    pthread_once(&exit_key_once, create_exit_key);
+    block = (stats_block *) calloc(1, sizeof(stats_block));
+
+    if (block == NULL) {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&registry);
+    block->next = live;
+
+    if (live != NULL) {
+        live->prev = block;
+    }
+
+    live = block;
+    pthread_mutex_unlock(&registry);
+
+    pthread_setspecific(exit_key, block);
+    stats_local = block;
+    return block;
+}
+
+int ed25519_stats_read(ed25519_stats *stats) {
+    stats_block *block;
+    int i;
+
+    pthread_mutex_lock(&registry);
+    *stats = retired;
+
+    for (block = live; block != NULL; block = block->next) {
+        for (i = 0; i < ED25519_STAT_COUNT; ++i) {
+            stats->calls[i] += STATS_LOAD(block->calls[i]);
+            stats->ticks[i] += STATS_LOAD(block->ticks[i]);
+        }
+    }
+
+    pthread_mutex_unlock(&registry);
+    return 0;
+}
+
+/* counts recorded concurrently with a reset may survive it */
+void ed25519_stats_reset(void) {
+    stats_block *block;
+    int i;
+
+    pthread_mutex_lock(&registry);
+    memset(&retired, 0, sizeof(retired));
+
+    for (block = live; block != NULL; block = block->next) {
+        for (i = 0; i < ED25519_STAT_COUNT; ++i) {
+            STATS_STORE(block->calls[i], 0);
+            STATS_STORE(block->ticks[i], 0);
+        }
+    }
+
+    pthread_mutex_unlock(&registry);
+}
+
+#else
+
+int ed25519_stats_read(ed25519_stats *stats) {
+    memset(stats, 0, sizeof(ed25519_stats));
+    return -1;
+}
+
+void ed25519_stats_reset(void) {
+}
+
+#endif
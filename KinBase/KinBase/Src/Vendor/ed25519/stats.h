@@ -0,0 +1,100 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include "kined25519.h"
+#include "cpu.h"
+
+/*
+    Instrumentation for ed25519_stats_read, compiled in with ED25519_STATS.
+
+        STATS_START(t);
+        ...
+        STATS_STOP(t, FE_MUL);
+
+    counts one call of ED25519_STAT_FE_MUL and adds the ticks in between
+    (STATS_STOP_N counts n calls, for work done several at a time).
+    Ticks are inclusive, so an operation's total covers the operations it
+    calls, and on the smallest ones the timer reads are a good part of what
+    is measured. Without ED25519_STATS both macros expand to nothing.
+
+    Every thread writes only its own block of counters, which readers sum
+    under the registry lock in stats.c.
+*/
+
+#ifdef ED25519_STATS
+
+#ifdef _WIN32
+    #error "ED25519_STATS needs pthreads"
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+#elif !defined(STATS_CLOCK)
+    #define STATS_CLOCK
+#endif
+
+#ifdef STATS_CLOCK
+#include <time.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define STATS_LOAD(p) __atomic_load_n(&(p), __ATOMIC_RELAXED)
+    #define STATS_STORE(p, v) __atomic_store_n(&(p), (v), __ATOMIC_RELAXED)
+#else
+    #define STATS_LOAD(p) (p)
+    #define STATS_STORE(p, v) ((p) = (v))
+#endif
+
+typedef struct stats_block {
+    uint64_t calls[ED25519_STAT_COUNT];
+    uint64_t ticks[ED25519_STAT_COUNT];
+    struct stats_block *prev;
+    struct stats_block *next;
+} stats_block;
+
+extern _Thread_local stats_block *stats_local;
+
+/* registers a block for the calling thread, NULL if it can't be allocated */
+stats_block *stats_attach(void);
+
+/* cycle counter on x86, virtual timer on arm64, nanoseconds elsewhere */
+ED25519_INLINE uint64_t stats_ticks(void) {
+#if defined(STATS_CLOCK)
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+#elif defined(__aarch64__)
+    uint64_t v;
+
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(v));
+    return v;
+#else
+    return __builtin_ia32_rdtsc();
+#endif
+}
+
+ED25519_INLINE void stats_record(int stat, uint64_t start, uint64_t calls) {
+    uint64_t elapsed = stats_ticks() - start;
+    stats_block *block = stats_local;
+
+    if (block == NULL && (block = stats_attach()) == NULL) {
+        return;
+    }
+
+    STATS_STORE(block->calls[stat], STATS_LOAD(block->calls[stat]) + calls);
+    STATS_STORE(block->ticks[stat], STATS_LOAD(block->ticks[stat]) + elapsed);
+}
+
+#define STATS_START(t) uint64_t t = stats_ticks()
+#define STATS_STOP(t, stat) stats_record(ED25519_STAT_##stat, t, 1)
+#define STATS_STOP_N(t, stat, n) stats_record(ED25519_STAT_##stat, t, n)
+
+#else
+
+#define STATS_START(t)
+#define STATS_STOP(t, stat)
+#define STATS_STOP_N(t, stat, n)
+
+#endif
+
+#endif
@@ -1,7 +1,19 @@
+#include <stdlib.h>
+
 #include "kined25519.h"
 #include "sha512.h"
 #include "ge.h"
 #include "sc.h"
+#include "stats.h"
+
+/* sliding window width for the odd multiples kept in ed25519_pubkey_ctx */
+#define PREPARED_WINDOW 7
+#define PREPARED_ENTRIES (1 << (PREPARED_WINDOW - 2))
+
+struct ed25519_pubkey_ctx {
+    unsigned char public_key[32];
+    ge_cached Ai[PREPARED_ENTRIES]; /* -A,-3A,-5A,... */
+};
 
 static int consttime_equal(const unsigned char *x, const unsigned char *y) {
     unsigned char r = 0;
@@ -45,7 +57,16 @@ static int consttime_equal(const unsigned char *x, const unsigned char *y) {
 }
 
 int ed25519_verify(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key) {
+    ed25519_iovec iov;
+
+    iov.data = message;
+    iov.len = message_len;
+    return ed25519_verify_iov(signature, &iov, 1, public_key);
+}
+
+static int verify_iov(const unsigned char *signature, const ed25519_iovec *iov, size_t iovcnt, const unsigned char *public_key) {
     unsigned char h[64];
+    size_t i;
     unsigned char checker[32];
     sha512_context hash;
     ge_p3 A;
@@ -62,7 +83,11 @@ int ed25519_verify(const unsigned char *signature, const unsigned char *message,
     sha512_init(&hash);
     sha512_update(&hash, signature, 32);
     sha512_update(&hash, public_key, 32);
-    sha512_update(&hash, message, message_len);
+
+    for (i = 0; i < iovcnt; ++i) {
+        sha512_update(&hash, iov[i].data, iov[i].len);
+    }
+
     sha512_final(&hash, h);
     
     sc_reduce(h);
@@ -76,6 +101,14 @@ int ed25519_verify(const unsigned char *signature, const unsigned char *message,
     return 1;
 }
 
+int ed25519_verify_iov(const unsigned char *signature, const ed25519_iovec *iov, size_t iovcnt, const unsigned char *public_key) {
+    int valid;
+    STATS_START(timer);
+    valid = verify_iov(signature, iov, iovcnt, public_key);
+    STATS_STOP(timer, VERIFY);
+    return valid;
+}
+
 int ed25519_on_curve(const unsigned char *public_key) {
     ge_p3 A;
     if (ge_frombytes_negate_vartime(&A, public_key) == 0) {
@@ -83,3 +116,65 @@ int ed25519_on_curve(const unsigned char *public_key) {
     }
     return 0;
 }
+
+ed25519_pubkey_ctx *ed25519_pubkey_ctx_create(const unsigned char *public_key) {
+    ed25519_pubkey_ctx *ctx;
+    ge_p3 A;
+    int i;
+
+    if (ge_frombytes_negate_vartime(&A, public_key) != 0) {
+        return NULL;
+    }
+
+    ctx = (ed25519_pubkey_ctx *) malloc(sizeof(ed25519_pubkey_ctx));
+
+    if (ctx == NULL) {
+        return NULL;
+    }
+
+    for (i = 0; i < 32; ++i) {
+        ctx->public_key[i] = public_key[i];
+    }
+
+    ge_p3_odd_multiples(ctx->Ai, &A, PREPARED_ENTRIES);
+    return ctx;
+}
+
+void ed25519_pubkey_ctx_destroy(ed25519_pubkey_ctx *ctx) {
+    free(ctx);
+}
+
+static int verify_prepared(const ed25519_pubkey_ctx *ctx, const unsigned char *signature, const unsigned char *message, size_t message_len) {
+    unsigned char h[64];
+    unsigned char checker[32];
+    sha512_context hash;
+    ge_p2 R;
+
+    if (signature[63] & 224) {
+        return 0;
+    }
+
+    sha512_init(&hash);
+    sha512_update(&hash, signature, 32);
+    sha512_update(&hash, ctx->public_key, 32);
+    sha512_update(&hash, message, message_len);
+    sha512_final(&hash, h);
+
+    sc_reduce(h);
+    ge_double_scalarmult_vartime_cached(&R, h, ctx->Ai, PREPARED_WINDOW, signature + 32);
+    ge_tobytes(checker, &R);
+
+    if (!consttime_equal(checker, signature)) {
+        return 0;
+    }
+
+    return 1;
+}
+
+int ed25519_verify_prepared(const ed25519_pubkey_ctx *ctx, const unsigned char *signature, const unsigned char *message, size_t message_len) {
+    int valid;
+    STATS_START(timer);
+    valid = verify_prepared(ctx, signature, message, message_len);
+    STATS_STOP(timer, VERIFY_PREPARED);
+    return valid;
+}
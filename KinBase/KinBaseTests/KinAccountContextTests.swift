@@ -249,6 +249,113 @@ class KinAccountContextTests: XCTestCase {
         waitForExpectations(timeout: 1)
     }
 
+    func testSendPackedKinPaymentsSucceed() {
+        // Set up account in storage
+        let key = KeyPair(seed: StubObjects.seed1)
+        let expectAccount = KinAccount(
+            publicKey: key.publicKey, privateKey: key.privateKey,
+            balance: KinBalance(Kin(10000)),
+            status: .registered,
+            sequence: 1
+        )
+
+        mockKinStorage.stubGetAccountResult = expectAccount
+
+        sut = KinAccountContext(environment: mockEnv,
+                                account: key.publicKey)
+
+        // Set up the service to pack each payment into its own transaction
+        let payments = [
+            KinPaymentItem(amount: Kin(1000), destAccount: StubObjects.account1),
+            KinPaymentItem(amount: Kin(990), destAccount: StubObjects.account2),
+        ]
+        let memo = KinMemo.none
+        let stubInFlightTransaction = StubObjects.inFlightTransaction(from: StubObjects.transactionEnvelopeSigned)
+
+        mockKinService.stubPackPaymentsResult = .init(payments.map { [$0] })
+        mockKinService.stubBuildAndSignTransactionResult = .init(stubInFlightTransaction)
+        mockKinService.stubGetAccountResult = expectAccount
+
+        // Set up submited transaction on serivce
+        let stubAckedTransaction = StubObjects.ackedTransaction(from: StubObjects.transactionEnvelopeSigned)
+        mockKinService.stubSubmitTransactionResult = .init(stubAckedTransaction)
+        mockKinService.stubCanWhitelistTransactionResult = false
+        mockKinService.stubMinFee = Quark(100)
+
+        // Set up account updates in storage
+        mockKinStorage.stubUpdateAccountResult = expectAccount
+        mockKinStorage.stubAdvanceSequenceResult = expectAccount
+        mockKinStorage.stubDeductFromBalanceResult = expectAccount
+        mockKinStorage.stubInsertNewTransactionResult = [stubAckedTransaction]
+
+        // Test
+        let expect = expectation(description: "callback")
+        sut.sendPackedKinPayments(payments, memo: memo).then { payments in
+            XCTAssertEqual(payments, stubAckedTransaction.kinPayments + stubAckedTransaction.kinPayments)
+            expect.fulfill()
+        }
+
+        waitForExpectations(timeout: 1)
+    }
+
+    func testSendPackedKinPaymentsReturnsPartiallySent() {
+        // Set up account in storage
+        let key = KeyPair(seed: StubObjects.seed1)
+        let expectAccount = KinAccount(
+            publicKey: key.publicKey, privateKey: key.privateKey,
+            balance: KinBalance(Kin(10000)),
+            status: .registered,
+            sequence: 1
+        )
+
+        mockKinStorage.stubGetAccountResult = expectAccount
+
+        sut = KinAccountContext(environment: mockEnv,
+                                account: key.publicKey)
+
+        // Set up the service to pack each payment into its own transaction
+        let payments = [
+            KinPaymentItem(amount: Kin(1000), destAccount: StubObjects.account1),
+            KinPaymentItem(amount: Kin(990), destAccount: StubObjects.account2),
+        ]
+        let memo = KinMemo.none
+        let stubInFlightTransaction = StubObjects.inFlightTransaction(from: StubObjects.transactionEnvelopeSigned)
+
+        mockKinService.stubPackPaymentsResult = .init(payments.map { [$0] })
+        mockKinService.stubBuildAndSignTransactionResult = .init(stubInFlightTransaction)
+        mockKinService.stubGetAccountResult = expectAccount
+
+        // Set up the first transaction to go through and the second to fail
+        let stubAckedTransaction = StubObjects.ackedTransaction(from: StubObjects.transactionEnvelopeSigned)
+        mockKinService.stubSubmitTransactionResults = [
+            .init(stubAckedTransaction),
+            .init(KinServiceV4.Errors.insufficientBalance),
+        ]
+        mockKinService.stubCanWhitelistTransactionResult = false
+        mockKinService.stubMinFee = Quark(100)
+
+        // Set up account updates in storage
+        mockKinStorage.stubUpdateAccountResult = expectAccount
+        mockKinStorage.stubAdvanceSequenceResult = expectAccount
+        mockKinStorage.stubDeductFromBalanceResult = expectAccount
+        mockKinStorage.stubInsertNewTransactionResult = [stubAckedTransaction]
+
+        // Test
+        let expect = expectation(description: "callback")
+        sut.sendPackedKinPayments(payments, memo: memo).catch { error in
+            guard case let KinAccountContext.Errors.partiallySent(sent, underlying) = error else {
+                XCTFail()
+                return
+            }
+
+            XCTAssertEqual(sent, stubAckedTransaction.kinPayments)
+            XCTAssertEqual(underlying as? KinServiceV4.Errors, KinServiceV4.Errors.insufficientBalance)
+            expect.fulfill()
+        }
+
+        waitForExpectations(timeout: 1)
+    }
+
     func testSendKinPaymentSucceed() {
         // Set up account in storage
         let key = KeyPair(seed: StubObjects.seed1)
@@ -64,4 +64,101 @@ class MessageTests: XCTestCase {
         XCTAssertEqual(decodedMessage.recentBlockhash, hash)
         XCTAssertEqual(decodedMessage.instructions, instructions)
     }
+    
+    func testEncodeSegments() {
+        let keyPair = KeyPair.generate()!
+        let message = Message(
+            header: MessageHeader(
+                signatureCount: 1,
+                readOnlySignedCount: 0,
+                readOnlyCount: 1
+            ),
+            accounts: [keyPair.publicKey, KeyPair.generate()!.publicKey],
+            recentBlockhash: KeyPair.generate()!.publicKey,
+            instructions: [
+                CompiledInstruction(
+                    programIndex: 1,
+                    accountIndexes: [0],
+                    data: Data([1, 2, 3])
+                ),
+            ]
+        )
+        
+        let data = message.encode()
+        let segments = message.encodeSegments()
+        
+        XCTAssertEqual(segments.flatMap { $0 }, data.bytes)
+        XCTAssertEqual(Array(segments[1...3]), message.accounts.map { $0.bytes } + [message.recentBlockhash.bytes])
+        
+        let signature = keyPair.sign(segments: segments)
+        XCTAssertEqual(signature, keyPair.sign(data.bytes))
+        XCTAssertTrue(keyPair.publicKey.verify(signature: Signature(signature)!, segments: segments))
+        
+        var tampered = segments
+        tampered[tampered.count - 1][0] ^= 1
+        XCTAssertFalse(keyPair.publicKey.verify(signature: Signature(signature)!, segments: tampered))
+    }
+    
+    func testEncodeDecodeManyInstructions() throws {
+        let accounts = (0..<200).map { _ in KeyPair.generate()!.publicKey }
+        let instructions = (0..<40).map { index in
+            CompiledInstruction(
+                programIndex: Byte(index),
+                accountIndexes: (0..<index).map { Byte($0 * 5) },
+                data: Data(repeating: Byte(index), count: index * 4)
+            )
+        }
+        
+        let message = Message(
+            header: MessageHeader(
+                signatureCount: 1,
+                readOnlySignedCount: 0,
+                readOnlyCount: 1
+            ),
+            accounts: accounts,
+            recentBlockhash: KeyPair.generate()!.publicKey,
+            instructions: instructions
+        )
+        
+        let data = message.encode()
+        XCTAssertEqual(data.bytes, message.encodeSegments().flatMap { $0 })
+        XCTAssertEqual(try XCTUnwrap(Message(data: data)), message)
+    }
+    
+    func testDecodeRejectsMalformedMessages() {
+        let message = Message(
+            header: MessageHeader(
+                signatureCount: 1,
+                readOnlySignedCount: 0,
+                readOnlyCount: 1
+            ),
+            accounts: [KeyPair.generate()!.publicKey, KeyPair.generate()!.publicKey],
+            recentBlockhash: KeyPair.generate()!.publicKey,
+            instructions: [
+                CompiledInstruction(
+                    programIndex: 1,
+                    accountIndexes: [0],
+                    data: Data([1, 2, 3])
+                ),
+            ]
+        )
+        
+        let data = message.encode()
+        
+        // Every truncation ends inside a field
+        for length in 0..<data.count {
+            XCTAssertNil(Message(data: data.prefix(length)))
+        }
+        
+        // Program index past the account keys
+        var invalidProgram = data
+        invalidProgram[invalidProgram.count - 7] = 2
+        XCTAssertNil(Message(data: invalidProgram))
+        
+        // Non-canonical account count
+        var overlong = Data(data.prefix(3))
+        overlong.append(contentsOf: [0x82, 0x00])
+        overlong.append(data.suffix(from: 4))
+        XCTAssertNil(Message(data: overlong))
+    }
 }
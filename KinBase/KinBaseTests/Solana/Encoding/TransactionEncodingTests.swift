@@ -55,6 +55,103 @@ class TransactionEncodingTests: XCTestCase {
         XCTAssertEqual(Data(base64Encoded: rustGeneratedAdjusted)!.hexEncodedString(), signedTransaction.encode().hexEncodedString())
     }
     
+    func testTransaction_SigningAndEncodingCrossImpl() {
+        let signerData = Data(fromHexEncodedString: "3053020101300506032b657004220420ff6524187c17a71584cc9b05b93a794b")!
+        let keypair = KeyPair(seed: Seed(signerData)!)
+        
+        let programID = Key32([2, 2, 2, 4, 5, 6, 7, 8, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 8, 7, 6, 5, 4, 2, 2, 2])!
+        let to = Key32([1, 1, 1, 4, 5, 6, 7, 8, 9, 9, 9, 9,9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 8, 7, 6, 5, 4, 1, 1, 1])!
+        
+        let tx = Transaction(
+            payer: keypair.publicKey,
+            instructions: Instruction(
+                program: programID,
+                accounts: [
+                    AccountMeta.writable(publicKey: keypair.publicKey, signer: true, payer: false),
+                    AccountMeta.writable(publicKey: to, signer: false, payer: false),
+                ],
+                data: Data([1, 2, 3])
+            )
+        )
+        
+        let (signed, data) = try! tx.signingAndEncoding(using: [keypair])
+        
+        XCTAssertEqual(Data(base64Encoded: rustGeneratedAdjusted)!.hexEncodedString(), data.hexEncodedString())
+        XCTAssertEqual(signed.encode(), data)
+        
+        let signer = Signer(keyPair: keypair)!
+        XCTAssertEqual(try! tx.signingAndEncoding(using: [signer]).data, data)
+    }
+    
+    func testTransaction_SigningAndEncodingMatchesSigning() {
+        let keys = keyPairs(0..<4)
+        let tx = Transaction(
+            payer: keys[0].publicKey,
+            instructions: Instruction(
+                program: keys[3].publicKey,
+                accounts: [
+                    AccountMeta.writable(publicKey: keys[1].publicKey, signer: true, payer: false),
+                    AccountMeta.readonly(publicKey: keys[2].publicKey, signer: true, payer: false),
+                ],
+                data: Data([1, 2, 3])
+            )
+        )
+        .updatingBlockhash(keys[3].publicKey)
+        
+        let signed = try! tx.signing(using: keys[2], keys[0], keys[1])
+        let (fused, data) = try! tx.signingAndEncoding(using: [keys[2], keys[0], keys[1]])
+        
+        XCTAssertEqual(fused.signatures, signed.signatures)
+        XCTAssertEqual(data, signed.encode())
+        
+        // Slots without a signer are left zeroed
+        let partial = try! tx.signingAndEncoding(using: [keys[1]])
+        XCTAssertEqual(partial.transaction.signatures, try! tx.signing(using: keys[1]).signatures)
+        XCTAssertEqual(partial.transaction.signatures[0], Signature.zero)
+        XCTAssertEqual(partial.data, partial.transaction.encode())
+        
+        // Only accounts with a signature slot can sign
+        XCTAssertThrowsError(try tx.signingAndEncoding(using: [keys[3]]))
+        XCTAssertThrowsError(try tx.signingAndEncoding(using: keyPairs(0..<4)))
+    }
+    
+    func testTransactionTemplate() {
+        let keys = keyPairs(0..<5)
+        let instructions = [
+            Instruction(
+                program: keys[3].publicKey,
+                accounts: [
+                    AccountMeta.writable(publicKey: keys[1].publicKey, signer: true, payer: false),
+                    AccountMeta.readonly(publicKey: keys[2].publicKey, signer: false, payer: false),
+                ],
+                data: Data([1, 2, 3])
+            ),
+        ]
+        
+        let template = TransactionTemplate(payer: keys[0].publicKey, instructions: instructions)
+        XCTAssertTrue(template.matches(payer: keys[0].publicKey, instructions: instructions))
+        XCTAssertFalse(template.matches(payer: keys[1].publicKey, instructions: instructions))
+        XCTAssertFalse(template.matches(payer: keys[0].publicKey, instructions: []))
+        
+        // Every blockhash signs and encodes as if built from scratch
+        for blockhash in [keys[3].publicKey, keys[4].publicKey] {
+            let expected = try! Transaction(payer: keys[0].publicKey, instructions: instructions)
+                .updatingBlockhash(blockhash)
+                .signing(using: keys[0], keys[1])
+            
+            let (transaction, data) = try! template.signingAndEncoding(blockhash: blockhash, using: [keys[0], keys[1]])
+            
+            XCTAssertEqual(transaction.message, expected.message)
+            XCTAssertEqual(transaction.signatures, expected.signatures)
+            XCTAssertEqual(data, expected.encode())
+            XCTAssertEqual(Array(data[template.blockhashOffset..<template.blockhashOffset + Hash.length]), blockhash.bytes)
+        }
+        
+        // The template itself is left untouched
+        XCTAssertEqual(template.data, Transaction(message: template.message, signatures: [Signature.zero, Signature.zero]).encode())
+        XCTAssertThrowsError(try template.signingAndEncoding(blockhash: keys[3].publicKey, using: [keys[2]]))
+    }
+    
     func testTransaction_InvalidAccounts() {
         let keys = keyPairs(0..<2)
         var tx = Transaction(
@@ -287,6 +384,171 @@ class TransactionEncodingTests: XCTestCase {
         XCTAssertEqual([2, 5, 3, 4, 1, 6], tx.message.instructions[1].accountIndexes)
     }
     
+    func testTransaction_ManyInstructions() {
+        let payer = KeyPair.generate()!.publicKey
+        let owner = KeyPair.generate()!.publicKey
+        let programs = (0..<3).map { _ in KeyPair.generate()!.publicKey }
+        let destinations = (0..<60).map { _ in KeyPair.generate()!.publicKey }
+        
+        let instructions = (0..<80).map { index in
+            Instruction(
+                program: programs[index % programs.count],
+                accounts: [
+                    AccountMeta.writable(publicKey: destinations[(index * 7) % destinations.count]),
+                    AccountMeta.readonly(publicKey: owner, signer: true),
+                    AccountMeta.readonly(publicKey: destinations[index % destinations.count], signer: index % 20 == 0),
+                ],
+                data: Data([Byte(index)])
+            )
+        }
+        
+        let message = Transaction(payer: payer, instructions: instructions).message
+        
+        // Each key keeps the flags of every meta it appeared with, and is
+        // a program only if it was first seen as one.
+        var metas: [[Byte]: AccountMeta] = [payer.bytes: AccountMeta.writable(publicKey: payer, signer: true, payer: true)]
+        for instruction in instructions {
+            for meta in [AccountMeta.program(publicKey: instruction.program)] + instruction.accounts {
+                if var existing = metas[meta.publicKey.bytes] {
+                    existing.isSigner = existing.isSigner || meta.isSigner
+                    existing.isWritable = existing.isWritable || meta.isWritable
+                    metas[meta.publicKey.bytes] = existing
+                } else {
+                    metas[meta.publicKey.bytes] = meta
+                }
+            }
+        }
+        
+        let expected = metas.values.sorted()
+        
+        XCTAssertEqual(message.accounts, expected.map { $0.publicKey })
+        XCTAssertEqual(message.header.signatureCount, expected.filter { $0.isSigner }.count)
+        XCTAssertEqual(message.header.readOnlySignedCount, expected.filter { $0.isSigner && !$0.isWritable }.count)
+        XCTAssertEqual(message.header.readOnlyCount, expected.filter { !$0.isSigner && !$0.isWritable }.count)
+        XCTAssertEqual(message.instructions, instructions.map { $0.compile(using: message.accounts) })
+    }
+    
+    func testTransactionPacker_Size() {
+        let payer = KeyPair.generate()!.publicKey
+        let owner = KeyPair.generate()!.publicKey
+        let program = KeyPair.generate()!.publicKey
+        let destinations = (0..<12).map { _ in KeyPair.generate()!.publicKey }
+        let memo = MemoProgram.memoInsutruction(with: "1-test-packer".data(using: .utf8)!)
+        
+        let instructions = (0..<40).map { index in
+            Instruction(
+                program: index % 5 == 0 ? owner : program,
+                accounts: [
+                    AccountMeta.writable(publicKey: destinations[(index * 5) % destinations.count]),
+                    AccountMeta.readonly(publicKey: destinations[index % destinations.count], signer: index % 7 == 0),
+                    AccountMeta.writable(publicKey: owner, signer: true),
+                ],
+                data: Data(repeating: Byte(index), count: index * 3)
+            )
+        }
+        
+        let packer = TransactionPacker(payer: payer, sharedInstructions: [memo])
+        
+        for count in [0, 1, 2, 13, 40] {
+            let prefix = Array(instructions.prefix(count))
+            XCTAssertEqual(packer.size(of: prefix), TransactionTemplate(payer: payer, instructions: [memo] + prefix).data.count)
+        }
+    }
+    
+    func testTransactionPacker_Payments() {
+        let subsidizer = KeyPair.generate()!.publicKey
+        let owner = KeyPair.generate()!.publicKey
+        let source = KeyPair.generate()!.publicKey
+        let programKey = KeyPair.generate()!.publicKey
+        let memo = MemoProgram.memoInsutruction(with: try! KinBinaryMemo(typeId: KinBinaryMemo.TransferType.p2p.rawValue, appIdx: 0).encode().base64EncodedData())
+        
+        let transfers = (0..<100).map { index in
+            TokenProgram.transferInstruction(
+                source: source,
+                destination: KeyPair.generate()!.publicKey,
+                owner: owner,
+                amount: Kin(index + 1),
+                programKey: programKey
+            )
+        }
+        
+        let packer = TransactionPacker(payer: subsidizer, sharedInstructions: [memo])
+        let packs = try! packer.pack(transfers)
+        
+        XCTAssertEqual(packs.flatMap { $0 }.sorted(), Array(transfers.indices))
+        
+        for pack in packs {
+            let instructions = [memo] + pack.map { transfers[$0] }
+            XCTAssertLessThanOrEqual(TransactionTemplate(payer: subsidizer, instructions: instructions).data.count, TransactionPacker.transactionSizeLimit)
+        }
+        
+        // Every transfer adds the same bytes, so no fewer transactions fit them
+        let base = packer.size(of: [])
+        let perTransfer = packer.size(of: [transfers[0]]) - base
+        let perTransaction = (TransactionPacker.transactionSizeLimit - base) / perTransfer
+        
+        XCTAssertEqual(packs.count, (transfers.count + perTransaction - 1) / perTransaction)
+        XCTAssertTrue(packs.dropLast().allSatisfy { $0.count == perTransaction })
+    }
+    
+    func testTransactionPacker_Groups() {
+        let subsidizer = KeyPair.generate()!.publicKey
+        let owner = KeyPair.generate()!.publicKey
+        let source = KeyPair.generate()!.publicKey
+        let programKey = KeyPair.generate()!.publicKey
+        let mint = KeyPair.generate()!.publicKey
+        let memo = MemoProgram.memoInsutruction(with: "1-test-groups".data(using: .utf8)!)
+        
+        // Every third payment creates its destination first, as a retry would
+        let groups = (0..<60).map { index -> [Instruction] in
+            let destination = KeyPair.generate()!.publicKey
+            let transfer = TokenProgram.transferInstruction(
+                source: source,
+                destination: destination,
+                owner: owner,
+                amount: Kin(index + 1),
+                programKey: programKey
+            )
+            
+            guard index % 3 == 0 else {
+                return [transfer]
+            }
+            
+            return [
+                SystemProgram.createAccountInstruction(subsidizer: subsidizer, address: destination, owner: programKey, lamports: 0, size: TokenProgram.accountSize),
+                TokenProgram.initializeAccountInstruction(account: destination, mint: mint, owner: destination, programKey: programKey),
+                TokenProgram.setAuthority(account: destination, currentAuthority: destination, newAuthority: subsidizer, authorityType: .authorityCloseAccount, programKey: programKey),
+                transfer,
+            ]
+        }
+        
+        let packer = TransactionPacker(payer: subsidizer, sharedInstructions: [memo])
+        let packs = try! packer.pack(groups: groups)
+        
+        XCTAssertEqual(packs.flatMap { $0 }.sorted(), Array(groups.indices))
+        
+        for pack in packs {
+            let instructions = pack.flatMap { groups[$0] }
+            let size = TransactionTemplate(payer: subsidizer, instructions: [memo] + instructions).data.count
+            XCTAssertEqual(packer.size(of: instructions), size)
+            XCTAssertLessThanOrEqual(size, TransactionPacker.transactionSizeLimit)
+        }
+    }
+    
+    func testTransactionPacker_TooLarge() {
+        let payer = KeyPair.generate()!.publicKey
+        let program = KeyPair.generate()!.publicKey
+        
+        let instructions = [
+            Instruction(program: program, accounts: [], data: Data(repeating: 1, count: 100)),
+            Instruction(program: program, accounts: [], data: Data(repeating: 2, count: 2000)),
+        ]
+        
+        XCTAssertThrowsError(try TransactionPacker(payer: payer).pack(instructions)) { error in
+            XCTAssertEqual(error as? TransactionPacker.Errors, .instructionTooLarge(index: 1))
+        }
+    }
+    
     func testTransation_UpdateSignature() {
         let transaction = createTransaction()
         
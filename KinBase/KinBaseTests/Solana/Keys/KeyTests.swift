@@ -24,6 +24,125 @@ class KeyTests: XCTestCase {
             XCTAssertTrue(pair.publicKey.isOnCurve())
         }
     }
+    
+    func testBatchVerify() {
+        var batch = (0..<100).map { index -> (publicKey: PublicKey, signature: Signature, bytes: [Byte]) in
+            let pair = KeyPair.generate()!
+            let bytes = [Byte]((0..<index).map { Byte(truncatingIfNeeded: $0 &* 31) })
+            return (pair.publicKey, Signature(pair.sign(bytes))!, bytes)
+        }
+        
+        XCTAssertEqual(PublicKey.verify(batch: batch), [Bool](repeating: true, count: batch.count))
+        
+        // Corrupt a few signatures and messages
+        var signature = batch[7].signature.bytes
+        signature[3] ^= 0x01
+        batch[7].signature = Signature(signature)!
+        batch[42].bytes = [1, 2, 3]
+        batch[99].publicKey = batch[0].publicKey
+        
+        let expected = batch.map { $0.publicKey.verifyCofactored(signature: $0.signature, bytes: $0.bytes) }
+        XCTAssertEqual(expected.filter { !$0 }.count, 3)
+        XCTAssertEqual(PublicKey.verify(batch: batch), expected)
+        XCTAssertEqual(PublicKey.verify(batch: []), [])
+    }
+    
+    func testBatchVerify_TorsionedKey() {
+        // The key of seed 0x07..07 plus the point of order two, signed
+        // with that seed's private key over messages with odd challenges.
+        // The cofactorless check rejects them, the cofactored one doesn't.
+        let publicKey = PublicKey(Data(fromHexEncodedString: "03b5939c1d63adf5410aaf84ecd13a066ab889514141846dbde11596ebb92dd3")!.bytes)!
+        let signatures = [
+            "4b0822fbbdbc20654d1b7ffc0eaee5e963374492b83ac3a1a88a49ab83d27f2186e32365cea587ce31ef2dee80c043801976d4d8f9eb5bad6fa7ef00e6fd530f",
+            "c50e24bfff99c6ccd4eb04e37e0097f48539818c55efce30fedf8d69859ed3111955897f5ffe8175e3cff4ff7615fb516b6e5b9e7cf7da37325cbdcae295c80e",
+        ].map { Signature(Data(fromHexEncodedString: $0)!.bytes)! }
+        
+        let batch: [(publicKey: PublicKey, signature: Signature, bytes: [Byte])] = [
+            (publicKey, signatures[0], [0x00, 0x01]),
+            (publicKey, signatures[1], [0x01, 0x01]),
+        ]
+        
+        XCTAssertEqual(batch.map { $0.publicKey.verify(signature: $0.signature, bytes: $0.bytes) }, [false, false])
+        XCTAssertEqual(batch.map { $0.publicKey.verifyCofactored(signature: $0.signature, bytes: $0.bytes) }, [true, true])
+        XCTAssertEqual(PublicKey.verify(batch: batch), [true, true])
+        XCTAssertEqual(PublicKey.verify(batch: [(publicKey, signatures[0], [0x00, 0x02])]), [false])
+    }
+    
+    func testCreateKeyPairsBatch() {
+        let seeds = (0..<130).map { _ in Seed.generate()! }
+        let pairs = KeyPair.create(seeds: seeds)
+        
+        XCTAssertEqual(pairs, seeds.map { KeyPair(seed: $0) })
+        XCTAssertEqual(KeyPair.create(seeds: []), [])
+    }
+    
+    func testGenerateSeeds() {
+        let seeds = Seed.generate(count: 100)!
+        
+        XCTAssertEqual(seeds.count, 100)
+        XCTAssertEqual(Set(seeds.map { $0.bytes }).count, 100)
+        XCTAssertEqual(Seed.generate(count: 0)!, [])
+    }
+    
+    func testKeyDerivation() {
+        // SLIP-0010 test vector 1 for ed25519
+        let derivation = KeyDerivation(seed: (0..<16).map { Byte($0) })!
+        
+        let child = derivation.keyPair(path: "m/0'")!
+        XCTAssertEqual(child.seed?.bytes, [0x68, 0xe0, 0xfe, 0x46, 0xdf, 0xb6, 0x7e, 0x36, 0x8c, 0x75, 0x37, 0x9a, 0xce, 0xc5, 0x91, 0xda, 0xd1, 0x9d, 0xf3, 0xcd, 0xe2, 0x6e, 0x63, 0xb9, 0x3a, 0x8e, 0x70, 0x4f, 0x1d, 0xad, 0xe7, 0xa3])
+        XCTAssertEqual(child.publicKey.bytes, [0x8c, 0x8a, 0x13, 0xdf, 0x77, 0xa2, 0x8f, 0x34, 0x45, 0x21, 0x3a, 0x0f, 0x43, 0x2f, 0xde, 0x64, 0x4a, 0xca, 0xa2, 0x15, 0xfc, 0x72, 0xdc, 0xdf, 0x30, 0x0d, 0x5e, 0xfa, 0xa8, 0x5d, 0x35, 0x0c])
+        XCTAssertEqual(derivation.keyPair(path: "m/0H"), child)
+        
+        XCTAssertNil(derivation.keyPair(path: "m/0"))
+        XCTAssertNil(derivation.keyPair(path: "0'"))
+        
+        let publicKeys = derivation.publicKeys(path: "m/44'/501'", start: 3, count: 100, pool: SigningPool(threadCount: 2))!
+        XCTAssertEqual(publicKeys.count, 100)
+        XCTAssertEqual(publicKeys[0], derivation.keyPair(path: "m/44'/501'/3'")!.publicKey)
+        XCTAssertEqual(publicKeys[99], derivation.keyPair(path: "m/44'/501'/102'")!.publicKey)
+    }
+    
+    func testPublicKeyVerifier() {
+        let pair = KeyPair.generate()!
+        let verifier = PublicKeyVerifier(publicKey: pair.publicKey)!
+        
+        (0..<50).forEach { index in
+            let bytes = [Byte]((0..<index).map { Byte(truncatingIfNeeded: $0) })
+            let signature = Signature(pair.sign(bytes))!
+            XCTAssertTrue(verifier.verify(signature: signature, bytes: bytes))
+            XCTAssertFalse(verifier.verify(signature: signature, bytes: bytes + [0]))
+        }
+        
+        let other = KeyPair.generate()!
+        XCTAssertFalse(verifier.verify(signature: Signature(other.sign([1, 2, 3]))!, bytes: [1, 2, 3]))
+        XCTAssertNil(PublicKeyVerifier(publicKey: Key32.offCurveKeys()[0]))
+    }
+    
+    func testSigner() {
+        let pair = KeyPair.generate()!
+        let signer = Signer(keyPair: pair)!
+        
+        XCTAssertEqual(signer.publicKey, pair.publicKey)
+        
+        (0..<50).forEach { index in
+            let bytes = [Byte]((0..<index).map { Byte(truncatingIfNeeded: $0) })
+            XCTAssertEqual(signer.sign(bytes), pair.sign(bytes))
+            XCTAssertEqual(signer.sign(segments: [Array(bytes.prefix(index / 2)), Array(bytes.dropFirst(index / 2))]), pair.sign(bytes))
+        }
+    }
+    
+    func testSignerBatch() {
+        let pair = KeyPair.generate()!
+        let signer = Signer(keyPair: pair)!
+        let messages = (0..<100).map { index in
+            [Byte]((0..<index).map { Byte(truncatingIfNeeded: $0 * 7) })
+        }
+        
+        [SigningPool(), SigningPool(threadCount: 1), SigningPool(threadCount: 3)].forEach { pool in
+            XCTAssertEqual(signer.sign(messages: messages, pool: pool), messages.map { pair.sign($0) })
+            XCTAssertEqual(signer.sign(messages: [], pool: pool), [])
+        }
+    }
 }
 
 private extension Key32 {
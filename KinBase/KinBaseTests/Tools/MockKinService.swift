@@ -18,7 +18,10 @@ class MockKinService: KinServiceType {
     var stubCreateTokenAccountForDestinationResult: Promise<([Instruction], KeyPair)>?
     var stubGetTransactionResult: KinTransaction?
     var stubBuildAndSignTransactionResult: Promise<KinTransaction>?
+    var stubPackPaymentsResult: Promise<[[KinPaymentItem]]>?
     var stubSubmitTransactionResult: Promise<KinTransaction>?
+    /// Returned one per submission, ahead of `stubSubmitTransactionResult`.
+    var stubSubmitTransactionResults = [Promise<KinTransaction>]()
     var stubBuildSignAndSubmitTransactionResult: Promise<KinTransaction>?
     var stubStreamAccountObservable: Observable<KinAccount>?
     var stubStreamTransactionObservable: Observable<KinTransaction>?
@@ -78,7 +81,15 @@ class MockKinService: KinServiceType {
         return stubBuildAndSignTransactionResult!
     }
     
+    func packPayments(ownerKey: PublicKey, sourceKey: PublicKey, paymentItems: [KinPaymentItem], memo: KinMemo) -> Promise<[[KinPaymentItem]]> {
+        return stubPackPaymentsResult ?? .init([paymentItems])
+    }
+    
     func submitTransaction(transaction: KinTransaction) -> Promise<KinTransaction> {
+        if !stubSubmitTransactionResults.isEmpty {
+            return stubSubmitTransactionResults.removeFirst()
+        }
+        
         return stubSubmitTransactionResult!
     }
     
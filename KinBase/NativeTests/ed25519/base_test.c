@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "ge.h"
+
+/*
+    Checks ge_scalarmult_base, with whichever base table and select() the
+    build picked, against bB from ge_double_scalarmult_vartime, which uses
+    its own table of odd multiples instead.
+*/
+
+#define ROUNDS 2000
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        ++failures; \
+    } \
+} while (0)
+
+static uint64_t rng_state = 0xda3e39cb94b95bdb;
+
+static uint64_t next_random(void) {
+    uint64_t z = (rng_state += 0x9e3779b97f4a7c15);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+}
+
+static void random_bytes(unsigned char *out, size_t len) {
+    size_t i;
+
+    for (i = 0; i < len; ++i) {
+        out[i] = (unsigned char) next_random();
+    }
+}
+
+static const unsigned char group_order[32] = {
+    0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+};
+
+static void check_base(const unsigned char *a) {
+    static const unsigned char zero[32] = {0};
+    unsigned char expected[32];
+    unsigned char actual[32];
+    ge_p3 h;
+    ge_p2 r;
+
+    ge_scalarmult_base(&h, a);
+    ge_p3_tobytes(actual, &h);
+
+    /* A is only multiplied by zero */
+    ge_double_scalarmult_vartime(&r, zero, &h, a);
+    ge_tobytes(expected, &r);
+
+    CHECK(memcmp(actual, expected, 32) == 0);
+}
+
+/*
+    Bytes that make every signed digit, of 4 or 5 bits, its largest or
+    smallest, or that carry through all of them, and values around l.
+*/
+static const unsigned char patterns[] = { 0x00, 0x01, 0x07, 0x08, 0x0f, 0x10, 0x77, 0x78, 0x88, 0x80, 0xef, 0xf0, 0xff };
+
+static void check_edges(void) {
+    unsigned char a[32];
+    size_t i;
+    int k;
+
+    for (i = 0; i < sizeof(patterns); ++i) {
+        memset(a, patterns[i], 32);
+        a[31] &= 127;
+        check_base(a);
+
+        /* every 5 bits the same */
+        for (k = 0; k < 256; ++k) {
+            if ((patterns[i] >> (k % 5)) & 1) {
+                a[k / 8] |= (unsigned char) (1 << (k % 8));
+            } else {
+                a[k / 8] &= (unsigned char) ~(1 << (k % 8));
+            }
+        }
+
+        a[31] &= 127;
+        check_base(a);
+    }
+
+    for (k = -2; k <= 2; ++k) {
+        memcpy(a, group_order, 32);
+        a[0] = (unsigned char) (a[0] + k);
+        check_base(a);
+    }
+
+    /* single bits */
+    for (k = 0; k < 255; ++k) {
+        memset(a, 0, 32);
+        a[k / 8] = (unsigned char) (1 << (k % 8));
+        check_base(a);
+    }
+}
+
+static void check_batch_tobytes(void) {
+    unsigned char a[32];
+    unsigned char batch[9 * 32];
+    unsigned char single[32];
+    ge_p3 points[9];
+    size_t i;
+
+    for (i = 0; i < 9; ++i) {
+        random_bytes(a, 32);
+        a[31] &= 127;
+
+        if (i == 4) {
+            memset(a, 0, 32);
+        }
+
+        ge_scalarmult_base(&points[i], a);
+    }
+
+    ge_p3_batch_tobytes(batch, points, 9);
+
+    for (i = 0; i < 9; ++i) {
+        ge_p3_tobytes(single, &points[i]);
+        CHECK(memcmp(batch + 32 * i, single, 32) == 0);
+    }
+}
+
+int main(void) {
+    unsigned char a[32];
+    int i;
+
+    check_edges();
+
+    for (i = 0; i < ROUNDS; ++i) {
+        random_bytes(a, 32);
+        a[31] &= 127;
+        check_base(a);
+    }
+
+    check_batch_tobytes();
+
+    printf("base_test: %d failures\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,225 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "kined25519.h"
+#include "fe.h"
+#include "ge.h"
+#include "sc.h"
+#include "sha512.h"
+
+#define COUNT 12
+#define MESSAGE_LEN 2
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        ++failures; \
+    } \
+} while (0)
+
+typedef struct {
+    unsigned char signatures[COUNT][64];
+    unsigned char messages[COUNT][MESSAGE_LEN];
+    const unsigned char *signature_ptrs[COUNT];
+    const unsigned char *message_ptrs[COUNT];
+    const unsigned char *key_ptrs[COUNT];
+    size_t message_lens[COUNT];
+} batch;
+
+/* P + (0, -1) is (-x, -y): negate y and flip the sign of x */
+static void add_order_two(unsigned char *out, const unsigned char *in) {
+    fe y;
+
+    fe_frombytes(y, in);
+    fe_neg(y, y);
+    fe_tobytes(out, y);
+    out[31] |= (in[31] & 128) ^ 128;
+}
+
+static void challenge(unsigned char *h, const unsigned char *R, const unsigned char *A, const unsigned char *message) {
+    unsigned char hash[64];
+    sha512_context ctx;
+
+    sha512_init(&ctx);
+    sha512_update(&ctx, R, 32);
+    sha512_update(&ctx, A, 32);
+    sha512_update(&ctx, message, MESSAGE_LEN);
+    sha512_final(&ctx, hash);
+    sc_reduce(hash);
+    memcpy(h, hash, 32);
+}
+
+/* signs message[0] = tag with the first message[1] that gives an odd challenge */
+static void sign_odd(unsigned char *signature, unsigned char *message, unsigned char tag, const unsigned char *public_key, const unsigned char *private_key) {
+    unsigned char h[32];
+
+    message[0] = tag;
+    message[1] = 0;
+
+    do {
+        ++message[1];
+        ed25519_sign(signature, message, MESSAGE_LEN, public_key, private_key);
+        challenge(h, signature, public_key, message);
+    } while (!(h[0] & 1));
+}
+
+/* a signature whose R has an order two component: s = r + ha with h = H(R + T, A, M) */
+static void sign_torsioned_r(unsigned char *signature, const unsigned char *message, const unsigned char *public_key, const unsigned char *private_key, unsigned char tag) {
+    unsigned char r[64];
+    unsigned char R[32];
+    unsigned char h[32];
+    ge_p3 point;
+
+    memset(r, tag, sizeof(r));
+    sc_reduce(r);
+    ge_scalarmult_base(&point, r);
+    ge_p3_tobytes(R, &point);
+
+    add_order_two(signature, R);
+    challenge(h, signature, public_key, message);
+    sc_muladd(signature + 32, h, private_key, r);
+}
+
+static void fill(batch *b, size_t i, const unsigned char *key) {
+    b->signature_ptrs[i] = b->signatures[i];
+    b->message_ptrs[i] = b->messages[i];
+    b->key_ptrs[i] = key;
+    b->message_lens[i] = MESSAGE_LEN;
+}
+
+/*
+    Entries i with i % 4 == torsioned carry a small-order component, which
+    ed25519_verify rejects and the cofactored check accepts. The batch
+    agrees with the cofactored check, also once a signature is broken.
+*/
+static void check_matches_cofactored(batch *b, size_t count, size_t torsioned) {
+    int results[COUNT];
+    size_t i;
+
+    for (i = 0; i < count; ++i) {
+        CHECK(ed25519_verify(b->signature_ptrs[i], b->message_ptrs[i], MESSAGE_LEN, b->key_ptrs[i]) == (i % 4 != torsioned));
+        CHECK(ed25519_verify_cofactored(b->signature_ptrs[i], b->message_ptrs[i], MESSAGE_LEN, b->key_ptrs[i]) == 1);
+    }
+
+    CHECK(ed25519_verify_batch(count, b->signature_ptrs, b->message_ptrs, b->message_lens, b->key_ptrs, results) == 1);
+    CHECK(ed25519_verify_batch(count, b->signature_ptrs, b->message_ptrs, b->message_lens, b->key_ptrs, NULL) == 1);
+
+    for (i = 0; i < count; ++i) {
+        CHECK(results[i] == 1);
+    }
+
+    /* a torsioned entry and another one with a different s */
+    b->signatures[torsioned][40] ^= 1;
+    b->signatures[3][40] ^= 1;
+
+    CHECK(ed25519_verify_batch(count, b->signature_ptrs, b->message_ptrs, b->message_lens, b->key_ptrs, results) == 0);
+    CHECK(ed25519_verify_batch(count, b->signature_ptrs, b->message_ptrs, b->message_lens, b->key_ptrs, NULL) == 0);
+
+    for (i = 0; i < count; ++i) {
+        CHECK(ed25519_verify_cofactored(b->signature_ptrs[i], b->message_ptrs[i], MESSAGE_LEN, b->key_ptrs[i]) == results[i]);
+        CHECK(results[i] == (i != torsioned && i != 3));
+    }
+
+    b->signatures[torsioned][40] ^= 1;
+    b->signatures[3][40] ^= 1;
+}
+
+/*
+    With the key A' = A + T, signing as usual gives sB - hA' = R + hT, which
+    ed25519_verify rejects for odd h and the cofactored check accepts.
+*/
+
+static void test_torsioned_key(void) {
+    unsigned char seed[32], public_key[32], private_key[64], torsioned[32];
+    batch b;
+    size_t i;
+
+    memset(seed, 7, sizeof(seed));
+    ed25519_create_keypair(public_key, private_key, seed);
+    add_order_two(torsioned, public_key);
+
+    for (i = 0; i < COUNT; ++i) {
+        const unsigned char *key = i % 4 == 1 ? torsioned : public_key;
+
+        sign_odd(b.signatures[i], b.messages[i], (unsigned char) i, key, private_key);
+        fill(&b, i, key);
+    }
+
+    check_matches_cofactored(&b, COUNT, 1);
+
+    /* only the torsioned signatures, which are 4 apart */
+    for (i = 0; i < 2; ++i) {
+        fill(&b, i, torsioned);
+        memcpy(b.signatures[i], b.signatures[1 + 4 * i], 64);
+        memcpy(b.messages[i], b.messages[1 + 4 * i], MESSAGE_LEN);
+    }
+
+    CHECK(ed25519_verify_batch(2, b.signature_ptrs, b.message_ptrs, b.message_lens, b.key_ptrs, NULL) == 1);
+}
+
+/* the same with R + T, where sB - hA = R regardless of h */
+static void test_torsioned_r(void) {
+    unsigned char seed[32], public_key[32], private_key[64];
+    batch b;
+    size_t i;
+
+    memset(seed, 9, sizeof(seed));
+    ed25519_create_keypair(public_key, private_key, seed);
+
+    for (i = 0; i < COUNT; ++i) {
+        b.messages[i][0] = (unsigned char) i;
+        b.messages[i][1] = 0;
+
+        if (i % 4 == 2) {
+            sign_torsioned_r(b.signatures[i], b.messages[i], public_key, private_key, (unsigned char) (i + 1));
+        } else {
+            ed25519_sign(b.signatures[i], b.messages[i], MESSAGE_LEN, public_key, private_key);
+        }
+
+        fill(&b, i, public_key);
+    }
+
+    check_matches_cofactored(&b, COUNT, 2);
+}
+
+static void test_valid(void) {
+    unsigned char seeds[COUNT][32], public_keys[COUNT][32], private_keys[COUNT][64];
+    batch b;
+    int results[COUNT];
+    size_t i;
+
+    for (i = 0; i < COUNT; ++i) {
+        memset(seeds[i], (int) i + 1, 32);
+        ed25519_create_keypair(public_keys[i], private_keys[i], seeds[i]);
+
+        b.messages[i][0] = (unsigned char) i;
+        b.messages[i][1] = 0xaa;
+        ed25519_sign(b.signatures[i], b.messages[i], MESSAGE_LEN, public_keys[i], private_keys[i]);
+        fill(&b, i, public_keys[i]);
+    }
+
+    CHECK(ed25519_verify_batch(COUNT, b.signature_ptrs, b.message_ptrs, b.message_lens, b.key_ptrs, results) == 1);
+
+    for (i = 0; i < COUNT; ++i) {
+        CHECK(results[i] == 1);
+    }
+
+    b.signatures[5][40] ^= 1;
+    CHECK(ed25519_verify_batch(COUNT, b.signature_ptrs, b.message_ptrs, b.message_lens, b.key_ptrs, results) == 0);
+
+    for (i = 0; i < COUNT; ++i) {
+        CHECK(results[i] == (i != 5));
+    }
+}
+
+int main(void) {
+    test_valid();
+    test_torsioned_key();
+    test_torsioned_r();
+
+    printf("batch_verify_test: %d failures\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,395 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "fe.h"
+
+/*
+    Checks the field arithmetic of whichever backend fe.h selects against a
+    plain 256-bit reference mod p = 2^255 - 19, on random and edge values.
+    Inputs of additions feed multiplications without a reduction in
+    between, as the curve formulas do, to cover the limb bounds.
+*/
+
+#define ROUNDS 4000
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        ++failures; \
+    } \
+} while (0)
+
+/* little-endian 32-bit limbs */
+typedef struct {
+    uint32_t v[8];
+} ref;
+
+static uint64_t rng_state = 0x9e3779b97f4a7c15;
+
+static uint64_t next_random(void) {
+    uint64_t z = (rng_state += 0x9e3779b97f4a7c15);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+}
+
+static void random_bytes(unsigned char *out, size_t len) {
+    size_t i;
+
+    for (i = 0; i < len; ++i) {
+        out[i] = (unsigned char) next_random();
+    }
+}
+
+static const ref p = { { 0xffffffed, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x7fffffff } };
+
+static int ref_less(const ref *a, const ref *b) {
+    int i;
+
+    for (i = 7; i >= 0; --i) {
+        if (a->v[i] != b->v[i]) {
+            return a->v[i] < b->v[i];
+        }
+    }
+
+    return 0;
+}
+
+/* r = a - b for a >= b */
+static void ref_sub_raw(ref *r, const ref *a, const ref *b) {
+    int64_t borrow = 0;
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        int64_t t = (int64_t) a->v[i] - b->v[i] + borrow;
+        r->v[i] = (uint32_t) t;
+        borrow = t < 0 ? -1 : 0;
+    }
+}
+
+/* reduces carry * 2^256 + r below p, using 2^256 = 38 and 2^255 = 19 */
+static void ref_reduce(ref *r, uint64_t carry) {
+    uint64_t t;
+    int i;
+
+    while (carry != 0 || (r->v[7] >> 31) != 0) {
+        t = carry * 38 + (r->v[7] >> 31) * 19;
+        r->v[7] &= 0x7fffffff;
+        carry = 0;
+
+        for (i = 0; i < 8; ++i) {
+            t += r->v[i];
+            r->v[i] = (uint32_t) t;
+            t >>= 32;
+        }
+
+        carry = t;
+    }
+
+    while (!ref_less(r, &p)) {
+        ref_sub_raw(r, r, &p);
+    }
+}
+
+static void ref_frombytes(ref *r, const unsigned char *s) {
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        r->v[i] = (uint32_t) s[4 * i] | ((uint32_t) s[4 * i + 1] << 8) |
+                  ((uint32_t) s[4 * i + 2] << 16) | ((uint32_t) s[4 * i + 3] << 24);
+    }
+
+    r->v[7] &= 0x7fffffff; /* fe_frombytes ignores the top bit */
+    ref_reduce(r, 0);
+}
+
+static void ref_tobytes(unsigned char *s, const ref *a) {
+    int i;
+
+    for (i = 0; i < 32; ++i) {
+        s[i] = (unsigned char) (a->v[i / 4] >> (8 * (i % 4)));
+    }
+}
+
+static void ref_add(ref *r, const ref *a, const ref *b) {
+    uint64_t t = 0;
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        t += (uint64_t) a->v[i] + b->v[i];
+        r->v[i] = (uint32_t) t;
+        t >>= 32;
+    }
+
+    ref_reduce(r, t);
+}
+
+static void ref_sub(ref *r, const ref *a, const ref *b) {
+    ref t;
+
+    ref_sub_raw(&t, &p, b);
+    ref_add(r, a, &t);
+}
+
+static void ref_mul(ref *r, const ref *a, const ref *b) {
+    uint64_t wide[16] = {0};
+    uint64_t t;
+    int i;
+    int j;
+
+    for (i = 0; i < 8; ++i) {
+        t = 0;
+
+        for (j = 0; j < 8; ++j) {
+            t += wide[i + j] + (uint64_t) a->v[i] * b->v[j];
+            wide[i + j] = (uint32_t) t;
+            t >>= 32;
+        }
+
+        wide[i + 8] = t;
+    }
+
+    /* fold the high half in as 38 * high */
+    t = 0;
+
+    for (i = 0; i < 8; ++i) {
+        t += wide[i] + wide[i + 8] * 38;
+        r->v[i] = (uint32_t) t;
+        t >>= 32;
+    }
+
+    ref_reduce(r, t);
+}
+
+static void ref_small(ref *r, uint32_t v) {
+    memset(r, 0, sizeof(*r));
+    r->v[0] = v;
+}
+
+/* r = a^e for e given as little-endian bytes */
+static void ref_pow(ref *r, const ref *a, const unsigned char *e) {
+    ref result;
+    int i;
+
+    ref_small(&result, 1);
+
+    for (i = 255; i >= 0; --i) {
+        ref_mul(&result, &result, &result);
+
+        if ((e[i / 8] >> (i % 8)) & 1) {
+            ref_mul(&result, &result, a);
+        }
+    }
+
+    *r = result;
+}
+
+static int ref_iszero(const ref *a) {
+    ref zero;
+
+    ref_small(&zero, 0);
+    return memcmp(a, &zero, sizeof(zero)) == 0;
+}
+
+static int equals(const fe f, const ref *expected) {
+    unsigned char s[32];
+    unsigned char t[32];
+
+    fe_tobytes(s, f);
+    ref_tobytes(t, expected);
+    return memcmp(s, t, 32) == 0;
+}
+
+/* p - 2 and (p - 5) / 8, little endian */
+static unsigned char p_minus_2[32];
+static unsigned char p_minus_5_div_8[32];
+
+static void init_exponents(void) {
+    memset(p_minus_2, 0xff, 32);
+    p_minus_2[0] = 0xeb;
+    p_minus_2[31] = 0x7f;
+
+    memset(p_minus_5_div_8, 0xff, 32);
+    p_minus_5_div_8[0] = 0xfd;
+    p_minus_5_div_8[31] = 0x0f;
+}
+
+/* values around 0, p and 2^255, which is p + 19 */
+static void edge_value(unsigned char *s, int k) {
+    memset(s, 0, 32);
+
+    if (k < 24) {
+        s[0] = (unsigned char) k;
+    } else if (k < 48) {
+        memset(s, 0xff, 32);
+        s[31] = 0x7f;
+        s[0] = (unsigned char) (0xff - (k - 24));
+    } else {
+        memset(s, 0xff, 32);
+        s[0] = (unsigned char) (0xff - (k - 48));
+    }
+}
+
+static void check_pair(const unsigned char *sa, const unsigned char *sb) {
+    fe a, b, c, d, h;
+    ref ra, rb, rc, rd, expected;
+    unsigned char bytes[32];
+    unsigned int bit;
+
+    fe_frombytes(a, sa);
+    fe_frombytes(b, sb);
+    ref_frombytes(&ra, sa);
+    ref_frombytes(&rb, sb);
+
+    CHECK(equals(a, &ra));
+    CHECK(fe_isnonzero(a) == !ref_iszero(&ra));
+    ref_tobytes(bytes, &ra);
+    CHECK(fe_isnegative(a) == (bytes[0] & 1));
+
+    fe_add(h, a, b);
+    ref_add(&expected, &ra, &rb);
+    CHECK(equals(h, &expected));
+
+    fe_sub(h, a, b);
+    ref_sub(&expected, &ra, &rb);
+    CHECK(equals(h, &expected));
+
+    fe_neg(h, a);
+    ref_small(&rc, 0);
+    ref_sub(&expected, &rc, &ra);
+    CHECK(equals(h, &expected));
+
+    fe_mul(h, a, b);
+    ref_mul(&expected, &ra, &rb);
+    CHECK(equals(h, &expected));
+
+    fe_sq(h, a);
+    ref_mul(&expected, &ra, &ra);
+    CHECK(equals(h, &expected));
+
+    fe_sq2(h, a);
+    ref_add(&expected, &expected, &expected);
+    CHECK(equals(h, &expected));
+
+    /* (a + b)(a - b), (a + b)^2 and 2(a - b)^2 from unreduced sums */
+    fe_add(c, a, b);
+    fe_sub(d, a, b);
+    ref_add(&rc, &ra, &rb);
+    ref_sub(&rd, &ra, &rb);
+
+    fe_mul(h, c, d);
+    ref_mul(&expected, &rc, &rd);
+    CHECK(equals(h, &expected));
+
+    fe_sq(h, c);
+    ref_mul(&expected, &rc, &rc);
+    CHECK(equals(h, &expected));
+
+    fe_sq2(h, d);
+    ref_mul(&expected, &rd, &rd);
+    ref_add(&expected, &expected, &expected);
+    CHECK(equals(h, &expected));
+
+    fe_mul121666(h, d);
+    ref_small(&expected, 121666);
+    ref_mul(&expected, &expected, &rd);
+    CHECK(equals(h, &expected));
+
+    fe_invert(h, a);
+    ref_pow(&expected, &ra, p_minus_2);
+    CHECK(equals(h, &expected));
+
+    fe_pow22523(h, a);
+    ref_pow(&expected, &ra, p_minus_5_div_8);
+    CHECK(equals(h, &expected));
+
+    /* aliased outputs */
+    fe_copy(h, a);
+    fe_mul(h, h, h);
+    ref_mul(&expected, &ra, &ra);
+    CHECK(equals(h, &expected));
+
+    for (bit = 0; bit < 2; ++bit) {
+        fe_copy(c, a);
+        fe_copy(d, b);
+        fe_cswap(c, d, bit);
+        CHECK(equals(c, bit ? &rb : &ra));
+        CHECK(equals(d, bit ? &ra : &rb));
+
+        fe_copy(c, a);
+        fe_cmov(c, b, bit);
+        CHECK(equals(c, bit ? &rb : &ra));
+    }
+}
+
+static void check_batch_invert(void) {
+    unsigned char s[32];
+    fe in[9], out[9], scratch[9];
+    fe expected;
+    size_t count;
+    size_t i;
+
+    for (count = 1; count <= 9; ++count) {
+        for (i = 0; i < count; ++i) {
+            random_bytes(s, 32);
+            s[0] |= 1; /* nonzero, also mod p */
+            s[31] &= 0x3f;
+            fe_frombytes(in[i], s);
+        }
+
+        fe_batch_invert(out, in, count, scratch);
+
+        for (i = 0; i < count; ++i) {
+            fe_invert(expected, in[i]);
+            fe_sub(expected, expected, out[i]);
+            CHECK(!fe_isnonzero(expected));
+        }
+
+        /* in place */
+        fe_batch_invert(in, in, count, scratch);
+
+        for (i = 0; i < count; ++i) {
+            fe_sub(expected, in[i], out[i]);
+            CHECK(!fe_isnonzero(expected));
+        }
+    }
+}
+
+int main(void) {
+    unsigned char sa[32];
+    unsigned char sb[32];
+    int i;
+    int j;
+
+    init_exponents();
+
+    for (i = 0; i < 64; ++i) {
+        for (j = 0; j < 64; j += 7) {
+            edge_value(sa, i);
+            edge_value(sb, j);
+            check_pair(sa, sb);
+        }
+    }
+
+    for (i = 0; i < ROUNDS; ++i) {
+        random_bytes(sa, 32);
+        random_bytes(sb, 32);
+
+        /* also limbs of all ones and all zeros */
+        if (i % 8 == 1) {
+            memset(sa + 8 * (i % 4), 0xff, 8);
+        } else if (i % 8 == 2) {
+            memset(sb + 8 * (i % 4), 0, 8);
+        }
+
+        check_pair(sa, sb);
+    }
+
+    check_batch_invert();
+
+    printf("fe_test (%s): %d failures\n", fe_backend(), failures);
+    return failures != 0;
+}
@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "kined25519.h"
+
+/* more than one KEY_EXCHANGE_BATCH chunk */
+#define COUNT 70
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        ++failures; \
+    } \
+} while (0)
+
+/*
+    Encodings of the identity and of points of order 2, 4 and 8. The
+    identity (y = 1) has no Montgomery u, which makes the denominator of the
+    conversion zero.
+*/
+static const unsigned char small_order[][32] = {
+    { 0x01 },
+    { 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f },
+    { 0x00 },
+    { 0x26, 0xe8, 0x95, 0x8f, 0xc2, 0xb2, 0x27, 0xb0, 0x45, 0xc3, 0xf4, 0x89, 0xf2, 0xef, 0x98, 0xf0,
+      0xd5, 0xdf, 0xac, 0x05, 0xd3, 0xc6, 0x33, 0x39, 0xb1, 0x38, 0x02, 0x88, 0x6d, 0x53, 0xfc, 0x05 },
+    { 0xc7, 0x17, 0x6a, 0x70, 0x3d, 0x4d, 0xd8, 0x4f, 0xba, 0x3c, 0x0b, 0x76, 0x0d, 0x10, 0x67, 0x0f,
+      0x2a, 0x20, 0x53, 0xfa, 0x2c, 0x39, 0xcc, 0xc6, 0x4e, 0xc7, 0xfd, 0x77, 0x92, 0xac, 0x03, 0x7a },
+};
+
+#define SMALL_ORDER (sizeof(small_order) / sizeof(small_order[0]))
+
+static void check_matches_single(size_t count, const unsigned char *public_keys, const unsigned char *private_key) {
+    unsigned char secrets[COUNT * 32];
+    unsigned char expected[32];
+    size_t i;
+
+    memset(secrets, 0xa5, sizeof(secrets));
+    ed25519_key_exchange_batch(count, secrets, public_keys, private_key);
+
+    for (i = 0; i < count; ++i) {
+        ed25519_key_exchange(expected, public_keys + 32 * i, private_key);
+        CHECK(memcmp(secrets + 32 * i, expected, 32) == 0);
+    }
+}
+
+int main(void) {
+    unsigned char public_keys[COUNT * 32];
+    unsigned char private_keys[COUNT][64];
+    unsigned char seed[32];
+    size_t i;
+
+    for (i = 0; i < COUNT; ++i) {
+        memset(seed, (int) i + 1, sizeof(seed));
+        ed25519_create_keypair(public_keys + 32 * i, private_keys[i], seed);
+    }
+
+    check_matches_single(COUNT, public_keys, private_keys[0]);
+
+    /* small-order peers spread among normal keys, including across chunks */
+    for (i = 0; i < SMALL_ORDER; ++i) {
+        memcpy(public_keys + 32 * (3 + 15 * i), small_order[i], 32);
+    }
+
+    check_matches_single(COUNT, public_keys, private_keys[1]);
+    check_matches_single(1, public_keys + 32 * 3, private_keys[2]);
+    check_matches_single(0, public_keys, private_keys[2]);
+
+    /* every key in a chunk of small order */
+    for (i = 0; i < COUNT; ++i) {
+        memcpy(public_keys + 32 * i, small_order[i % SMALL_ORDER], 32);
+    }
+
+    check_matches_single(COUNT, public_keys, private_keys[3]);
+
+    printf("key_exchange_test: %d failures\n", failures);
+    return failures != 0;
+}
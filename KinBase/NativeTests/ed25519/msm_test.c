@@ -0,0 +1,209 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ge.h"
+#include "sc.h"
+
+/*
+    Checks ge_multiscalarmult_vartime with every Straus and Pippenger window
+    against the same sum computed from discrete logs: with points[i] = p_i B,
+    sum a_i points[i] is (sum a_i p_i mod l) B.
+*/
+
+#define MAX_POINTS 300
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        ++failures; \
+    } \
+} while (0)
+
+static uint64_t rng_state = 0x853c49e6748fea9b;
+
+static uint64_t next_random(void) {
+    uint64_t z = (rng_state += 0x9e3779b97f4a7c15);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+}
+
+static void random_bytes(unsigned char *out, size_t len) {
+    size_t i;
+
+    for (i = 0; i < len; ++i) {
+        out[i] = (unsigned char) next_random();
+    }
+}
+
+static const unsigned char group_order[32] = {
+    0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+};
+
+static unsigned char logs[MAX_POINTS][32];
+static unsigned char scalars[MAX_POINTS * 32];
+static ge_p3 points[MAX_POINTS];
+
+static void random_scalar(unsigned char *s) {
+    unsigned char wide[64];
+
+    random_bytes(wide, 64);
+    sc_reduce(wide);
+    memcpy(s, wide, 32);
+}
+
+/* random points with known logs, including the identity and repeats */
+static void make_points(void) {
+    size_t i;
+
+    for (i = 0; i < MAX_POINTS; ++i) {
+        if (i % 37 == 5) {
+            memset(logs[i], 0, 32);
+        } else if (i % 11 == 7) {
+            memcpy(logs[i], logs[i - 3], 32);
+        } else {
+            random_scalar(logs[i]);
+        }
+
+        ge_scalarmult_base(&points[i], logs[i]);
+    }
+}
+
+/* any scalar below 2^255, with zeros, l - 1, the largest allowed and repeats */
+static void make_scalars(size_t count, int pattern) {
+    unsigned char *s;
+    size_t i;
+
+    for (i = 0; i < count; ++i) {
+        s = scalars + 32 * i;
+        random_bytes(s, 32);
+        s[31] &= 127;
+
+        switch ((i + (size_t) pattern) % 13) {
+        case 0: memset(s, 0, 32); break;
+        case 1: memcpy(s, group_order, 32); s[0] -= 1; break;
+        case 2: memset(s, 0xff, 32); s[31] = 127; break;
+        case 3:
+            if (i > 0) {
+                memcpy(s, s - 32, 32);
+            }
+            break;
+        case 4: memset(s, 0, 32); s[0] = 1; break;
+        default: break;
+        }
+    }
+}
+
+static void expected_sum(unsigned char *out, size_t count) {
+    unsigned char sum[32] = {0};
+    ge_p3 r;
+    size_t i;
+
+    for (i = 0; i < count; ++i) {
+        sc_muladd(sum, scalars + 32 * i, logs[i], sum);
+    }
+
+    ge_scalarmult_base(&r, sum);
+    ge_p3_tobytes(out, &r);
+}
+
+static void check_msm(size_t count, const ge_msm_params *params) {
+    unsigned char expected[32];
+    unsigned char actual[32];
+    size_t size;
+    void *scratch;
+    ge_p3 r;
+
+    size = ge_multiscalarmult_scratch_size(count, params);
+    scratch = malloc(size);
+
+    if (scratch == NULL) {
+        ++failures;
+        return;
+    }
+
+    CHECK(ge_multiscalarmult_vartime(&r, scalars, points, count, scratch, size - 1, params) == -1);
+    CHECK(ge_multiscalarmult_vartime(&r, scalars, points, count, scratch, size, params) == 0);
+    ge_p3_tobytes(actual, &r);
+    expected_sum(expected, count);
+    CHECK(memcmp(actual, expected, 32) == 0);
+
+    free(scratch);
+}
+
+/* aA + bB, with A from the points and B the base point */
+static void check_double_scalarmult(void) {
+    static const unsigned char one[32] = {1};
+    unsigned char a[32], b[32], sum[32], expected[32], actual[32];
+    ge_p2 r;
+    ge_p3 p;
+    size_t i;
+
+    for (i = 0; i < 64; ++i) {
+        make_scalars(2, (int) i);
+        memcpy(a, scalars, 32);
+        memcpy(b, scalars + 32, 32);
+
+        sc_muladd(sum, a, logs[i], b);
+        ge_scalarmult_base(&p, sum);
+        ge_p3_tobytes(expected, &p);
+
+        ge_double_scalarmult_vartime(&r, a, &points[i], b);
+        ge_tobytes(actual, &r);
+        CHECK(memcmp(actual, expected, 32) == 0);
+    }
+
+    /* the identity, by l - 1 times B plus B */
+    memcpy(a, group_order, 32);
+    a[0] -= 1;
+    ge_scalarmult_base(&p, one);
+    ge_double_scalarmult_vartime(&r, a, &p, one);
+    ge_tobytes(actual, &r);
+    ge_p3_0(&p);
+    ge_p3_tobytes(expected, &p);
+    CHECK(memcmp(actual, expected, 32) == 0);
+}
+
+int main(void) {
+    static const size_t straus_counts[] = { 0, 1, 2, 3, 5, 17, 64 };
+    static const size_t pippenger_counts[] = { 2, 3, 17, 64, 150, MAX_POINTS };
+    ge_msm_params params;
+    size_t i;
+    int window;
+
+    make_points();
+
+    for (i = 0; i < sizeof(straus_counts) / sizeof(straus_counts[0]); ++i) {
+        make_scalars(straus_counts[i], (int) i);
+        check_msm(straus_counts[i], NULL);
+
+        for (window = 2; window <= 8; ++window) {
+            memset(&params, 0, sizeof(params));
+            params.straus_window = window;
+            params.straus_max_points = MAX_POINTS;
+            check_msm(straus_counts[i], &params);
+        }
+    }
+
+    for (i = 0; i < sizeof(pippenger_counts) / sizeof(pippenger_counts[0]); ++i) {
+        make_scalars(pippenger_counts[i], (int) i);
+        check_msm(pippenger_counts[i], NULL);
+
+        for (window = 2; window <= 16; ++window) {
+            memset(&params, 0, sizeof(params));
+            params.pippenger_window = window;
+            params.straus_max_points = 1;
+            check_msm(pippenger_counts[i], &params);
+        }
+    }
+
+    check_double_scalarmult();
+
+    printf("msm_test: %d failures\n", failures);
+    return failures != 0;
+}
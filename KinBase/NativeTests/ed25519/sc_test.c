@@ -0,0 +1,224 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "fixedint.h"
+#include "sc.h"
+
+/*
+    Checks sc_reduce, sc_reduce_n and sc_muladd of whichever implementation
+    sc.h selects against a bit-by-bit reduction mod
+    l = 2^252 + 27742317777372353535851937790883648493.
+*/
+
+#define ROUNDS 3000
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        ++failures; \
+    } \
+} while (0)
+
+static uint64_t rng_state = 0x2545f4914f6cdd1d;
+
+static uint64_t next_random(void) {
+    uint64_t z = (rng_state += 0x9e3779b97f4a7c15);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+}
+
+static void random_bytes(unsigned char *out, size_t len) {
+    size_t i;
+
+    for (i = 0; i < len; ++i) {
+        out[i] = (unsigned char) next_random();
+    }
+}
+
+static const unsigned char group_order[32] = {
+    0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+};
+
+/* r (33 bytes, little endian) >= l */
+static int at_least_order(const unsigned char *r) {
+    int i;
+
+    if (r[32] != 0) {
+        return 1;
+    }
+
+    for (i = 31; i >= 0; --i) {
+        if (r[i] != group_order[i]) {
+            return r[i] > group_order[i];
+        }
+    }
+
+    return 1;
+}
+
+/* out = in mod l for len little-endian bytes of in, shifting in one bit at a time */
+static void ref_reduce(unsigned char *out, const unsigned char *in, size_t len) {
+    unsigned char r[33] = {0};
+    int borrow;
+    int carry;
+    int bit;
+    int i;
+    size_t n;
+
+    for (n = len * 8; n-- > 0;) {
+        carry = (in[n / 8] >> (n % 8)) & 1;
+
+        for (i = 0; i < 33; ++i) {
+            bit = r[i] >> 7;
+            r[i] = (unsigned char) ((r[i] << 1) | carry);
+            carry = bit;
+        }
+
+        if (at_least_order(r)) {
+            borrow = 0;
+
+            for (i = 0; i < 33; ++i) {
+                int t = r[i] - (i < 32 ? group_order[i] : 0) - borrow;
+                r[i] = (unsigned char) t;
+                borrow = t < 0;
+            }
+        }
+    }
+
+    memcpy(out, r, 32);
+}
+
+/* out (64 bytes) = a * b + c */
+static void ref_muladd_wide(unsigned char *out, const unsigned char *a, const unsigned char *b, const unsigned char *c) {
+    uint32_t wide[64] = {0};
+    uint32_t carry;
+    int i;
+    int j;
+
+    for (i = 0; i < 32; ++i) {
+        for (j = 0; j < 32; ++j) {
+            wide[i + j] += (uint32_t) a[i] * b[j];
+        }
+
+        wide[i] += c[i];
+    }
+
+    carry = 0;
+
+    for (i = 0; i < 64; ++i) {
+        wide[i] += carry;
+        out[i] = (unsigned char) wide[i];
+        carry = wide[i] >> 8;
+    }
+}
+
+static void check_reduce(const unsigned char *in) {
+    unsigned char s[64];
+    unsigned char expected[32];
+
+    memcpy(s, in, 64);
+    sc_reduce(s);
+    ref_reduce(expected, in, 64);
+    CHECK(memcmp(s, expected, 32) == 0);
+}
+
+static void check_muladd(const unsigned char *a, const unsigned char *b, const unsigned char *c) {
+    unsigned char s[32];
+    unsigned char wide[64];
+    unsigned char expected[32];
+
+    sc_muladd(s, a, b, c);
+    ref_muladd_wide(wide, a, b, c);
+    ref_reduce(expected, wide, 64);
+    CHECK(memcmp(s, expected, 32) == 0);
+}
+
+/* l - 1, l, l + 1, 2^252 - 1, 0 and 2^253 - 1 */
+static void edge_scalar(unsigned char *s, int k) {
+    memcpy(s, group_order, 32);
+
+    switch (k % 6) {
+    case 0: s[0] -= 1; break;
+    case 1: break;
+    case 2: s[0] += 1; break;
+    case 3: memset(s, 0xff, 32); s[31] = 0x0f; break;
+    case 4: memset(s, 0, 32); break;
+    default: memset(s, 0xff, 32); s[31] = 0x1f; break;
+    }
+}
+
+int main(void) {
+    unsigned char wide[64];
+    unsigned char batch[5][64];
+    unsigned char inputs[5][64];
+    unsigned char expected[32];
+    unsigned char a[32], b[32], c[32];
+    int i;
+    int j;
+    int k;
+
+    /* all zeros, all ones, and multiples of l near 2^512 */
+    memset(wide, 0, sizeof(wide));
+    check_reduce(wide);
+    memset(wide, 0xff, sizeof(wide));
+    check_reduce(wide);
+    memset(c, 0, 32);
+
+    for (i = 0; i < 8; ++i) {
+        memcpy(a, group_order, 32);
+        memset(b, 0xff, 32);
+        b[0] = (unsigned char) (0xff - i);
+        b[31] = (unsigned char) (0xff >> (i % 4));
+        ref_muladd_wide(wide, a, b, c);
+        check_reduce(wide);
+    }
+
+    for (i = 0; i < 12; ++i) {
+        for (j = 0; j < 12; ++j) {
+            for (k = 0; k < 12; k += 5) {
+                edge_scalar(a, i);
+                edge_scalar(b, j);
+                edge_scalar(c, k);
+                check_muladd(a, b, c);
+            }
+        }
+    }
+
+    for (i = 0; i < ROUNDS; ++i) {
+        random_bytes(wide, 64);
+        check_reduce(wide);
+
+        /* sign.c feeds sc_muladd reduced scalars and clamped keys */
+        random_bytes(wide, 64);
+        ref_reduce(a, wide, 64);
+        random_bytes(b, 32);
+        b[0] &= 248;
+        b[31] &= 63;
+        b[31] |= 64;
+        random_bytes(wide, 64);
+        ref_reduce(c, wide, 64);
+        check_muladd(a, b, c);
+
+        random_bytes(a, 32);
+        random_bytes(b, 32);
+        random_bytes(c, 32);
+        check_muladd(a, b, c);
+    }
+
+    random_bytes(batch[0], sizeof(batch));
+    memcpy(inputs, batch, sizeof(batch));
+    sc_reduce_n(batch[0], 5);
+
+    for (i = 0; i < 5; ++i) {
+        ref_reduce(expected, inputs[i], 64);
+        CHECK(memcmp(batch[i], expected, 32) == 0);
+    }
+
+    printf("sc_test: %d failures\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,287 @@
+/*
+    Tests for the native Solana codec in Src/Solana/Native.
+
+        make test
+
+    The codec sits in the pod's sources, these tests don't: they build on
+    any machine with a C compiler and exit non-zero on failure.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "solana_codec.h"
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+/* signed by Rust, see testTransaction_CrossImpl in TransactionEncodingTests.swift */
+static const uint8_t rust_transaction[] = {
+    0x01, 0x33, 0x1f, 0x04, 0xc6, 0x7c, 0xa6, 0x11, 0xc4, 0x85, 0xe2, 0xe9, 0x87, 0xc2, 0xbd, 0x4c,
+    0x98, 0x51, 0x2a, 0x19, 0xc4, 0xe2, 0xa3, 0x59, 0xbd, 0x68, 0x97, 0x75, 0x47, 0x49, 0x46, 0x69,
+    0x53, 0x09, 0x1b, 0x10, 0x8d, 0x69, 0x96, 0xd8, 0x29, 0x10, 0x25, 0xe4, 0x47, 0x04, 0x27, 0x2c,
+    0xa8, 0x59, 0xb6, 0x83, 0x29, 0xe3, 0x2f, 0x8d, 0x0c, 0xf6, 0x64, 0xde, 0xd0, 0x3c, 0x69, 0xe1,
+    0x02, 0x01, 0x00, 0x01, 0x03, 0x7c, 0x4c, 0x9a, 0xeb, 0x09, 0xc2, 0xed, 0xfd, 0xc2, 0xbf, 0x9d,
+    0xea, 0x9c, 0xe1, 0x32, 0xc3, 0x02, 0x09, 0xf7, 0x6f, 0x2b, 0x21, 0xda, 0x80, 0x95, 0xf5, 0xd8,
+    0x23, 0x56, 0x9d, 0x5e, 0xba, 0x01, 0x01, 0x01, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x07, 0x06,
+    0x05, 0x04, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x08, 0x07, 0x06,
+    0x05, 0x04, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x03, 0x01, 0x02, 0x03,
+};
+
+static void test_short_vec(void) {
+    static const struct {
+        size_t value;
+        uint8_t encoded[3];
+        size_t len;
+    } vectors[] = {
+        { 0x0,    { 0x00 },             1 },
+        { 0x7f,   { 0x7f },             1 },
+        { 0x80,   { 0x80, 0x01 },       2 },
+        { 0xff,   { 0xff, 0x01 },       2 },
+        { 0x100,  { 0x80, 0x02 },       2 },
+        { 0x7fff, { 0xff, 0xff, 0x01 }, 3 },
+        { 0xffff, { 0xff, 0xff, 0x03 }, 3 },
+    };
+    static const uint8_t invalid[][4] = {
+        { 0x80, 0x00 },             /* redundant zero byte */
+        { 0x80, 0x80, 0x00 },
+        { 0xff, 0xff, 0x04 },       /* 0x10000 */
+        { 0x80, 0x80, 0x80, 0x01 }, /* four bytes */
+    };
+    uint8_t out[3];
+    size_t value;
+    size_t offset;
+    size_t i;
+
+    for (i = 0; i < sizeof(vectors) / sizeof(vectors[0]); ++i) {
+        CHECK(solana_short_vec_size(vectors[i].value) == vectors[i].len);
+        CHECK(solana_short_vec_encode(out, vectors[i].value) == vectors[i].len);
+        CHECK(memcmp(out, vectors[i].encoded, vectors[i].len) == 0);
+
+        offset = 0;
+        CHECK(solana_short_vec_decode(&value, vectors[i].encoded, vectors[i].len, &offset) == SOLANA_OK);
+        CHECK(value == vectors[i].value && offset == vectors[i].len);
+
+        offset = 0;
+        CHECK(solana_short_vec_decode(&value, vectors[i].encoded, vectors[i].len - 1, &offset) == SOLANA_ERROR_TRUNCATED);
+    }
+
+    for (i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+        offset = 0;
+        CHECK(solana_short_vec_decode(&value, invalid[i], sizeof(invalid[i]), &offset) == SOLANA_ERROR_SHORT_VEC);
+    }
+}
+
+static void test_decode(void) {
+    solana_transaction_view tx;
+    solana_instruction_view ix[2];
+    const solana_message_view *m = &tx.message;
+
+    CHECK(solana_transaction_decode(&tx, ix, 2, rust_transaction, sizeof(rust_transaction)) == SOLANA_OK);
+    CHECK(tx.length == sizeof(rust_transaction));
+    CHECK(tx.signature_count == 1 && tx.signatures_offset == 1);
+
+    CHECK(m->offset == 65 && m->length == sizeof(rust_transaction) - 65);
+    CHECK(m->signature_count == 1 && m->readonly_signed_count == 0 && m->readonly_count == 1);
+    CHECK(m->account_count == 3 && m->account_keys_offset == 69);
+    CHECK(m->blockhash_offset == 69 + 3 * 32);
+    CHECK(rust_transaction[m->blockhash_offset] == 0);
+    CHECK(m->instruction_count == 1);
+    CHECK(m->instructions.offset + m->instructions.length == sizeof(rust_transaction));
+
+    CHECK(ix[0].program_index == 2);
+    CHECK(ix[0].accounts.length == 2);
+    CHECK(rust_transaction[ix[0].accounts.offset] == 0 && rust_transaction[ix[0].accounts.offset + 1] == 1);
+    CHECK(ix[0].data.length == 3);
+    CHECK(memcmp(rust_transaction + ix[0].data.offset, "\x01\x02\x03", 3) == 0);
+
+    /* the message alone decodes to the same layout */
+    {
+        solana_message_view message;
+
+        CHECK(solana_message_decode(&message, NULL, 0, rust_transaction + 65, sizeof(rust_transaction) - 65) == SOLANA_OK);
+        CHECK(message.offset == 0 && message.length == m->length);
+        CHECK(message.account_keys_offset == m->account_keys_offset - 65);
+        CHECK(message.instruction_count == 1);
+    }
+}
+
+static void test_decode_invalid(void) {
+    uint8_t tx[sizeof(rust_transaction) + 1];
+    solana_transaction_view view;
+    size_t len;
+
+    /* every prefix is cut inside some field */
+    for (len = 0; len < sizeof(rust_transaction); ++len) {
+        CHECK(solana_transaction_decode(&view, NULL, 0, rust_transaction, len) == SOLANA_ERROR_TRUNCATED);
+    }
+
+    /* trailing bytes are not part of the transaction */
+    memcpy(tx, rust_transaction, sizeof(rust_transaction));
+    tx[sizeof(rust_transaction)] = 0xaa;
+    CHECK(solana_transaction_decode(&view, NULL, 0, tx, sizeof(tx)) == SOLANA_OK);
+    CHECK(view.length == sizeof(rust_transaction));
+
+    /* program index 3 with 3 account keys */
+    tx[view.message.instructions.offset] = 3;
+    CHECK(solana_transaction_decode(&view, NULL, 0, tx, sizeof(tx)) == SOLANA_ERROR_PROGRAM_INDEX);
+}
+
+static void test_encode(void) {
+    static const uint8_t zero_signature[SOLANA_SIGNATURE_LENGTH] = { 0 };
+    solana_transaction_view view;
+    solana_instruction_view ixv[1];
+    solana_instruction ix;
+    solana_message message;
+    uint8_t out[sizeof(rust_transaction)];
+    const uint8_t *p = rust_transaction;
+    const uint8_t *keys[3];
+    const uint8_t *signature;
+    const uint8_t *no_signature = NULL;
+    size_t i;
+
+    CHECK(solana_transaction_decode(&view, ixv, 1, p, sizeof(rust_transaction)) == SOLANA_OK);
+    CHECK(view.message.account_count == 3);
+
+    for (i = 0; i < 3; ++i) {
+        keys[i] = p + view.message.account_keys_offset + i * SOLANA_KEY_LENGTH;
+    }
+
+    signature = p + view.signatures_offset;
+
+    ix.program_index = ixv[0].program_index;
+    ix.accounts = p + ixv[0].accounts.offset;
+    ix.account_count = ixv[0].accounts.length;
+    ix.data = p + ixv[0].data.offset;
+    ix.data_len = ixv[0].data.length;
+
+    message.signature_count = view.message.signature_count;
+    message.readonly_signed_count = view.message.readonly_signed_count;
+    message.readonly_count = view.message.readonly_count;
+    message.account_keys = keys;
+    message.account_count = view.message.account_count;
+    message.blockhash = p + view.message.blockhash_offset;
+    message.instructions = &ix;
+    message.instruction_count = 1;
+
+    CHECK(solana_message_size(&message) == view.message.length);
+    CHECK(solana_transaction_size(1, &message) == sizeof(rust_transaction));
+
+    CHECK(solana_transaction_encode(out, sizeof(out), &signature, 1, &message) == sizeof(out));
+    CHECK(memcmp(out, rust_transaction, sizeof(out)) == 0);
+
+    CHECK(solana_message_encode(out, sizeof(out), &message) == view.message.length);
+    CHECK(memcmp(out, p + view.message.offset, view.message.length) == 0);
+
+    /* empty slots in front of the message, for signing in place */
+    memset(out, 0xff, sizeof(out));
+    CHECK(solana_transaction_encode(out, sizeof(out), NULL, 1, &message) == sizeof(out));
+    CHECK(solana_transaction_message_offset(1) == view.message.offset);
+    CHECK(solana_transaction_signature_offset(1, 0) == view.signatures_offset);
+    CHECK(out[0] == 1 && memcmp(out + 1, zero_signature, SOLANA_SIGNATURE_LENGTH) == 0);
+    CHECK(memcmp(out + view.message.offset, p + view.message.offset, view.message.length) == 0);
+
+    /* or a missing signature among the others */
+    memset(out, 0xff, sizeof(out));
+    CHECK(solana_transaction_encode(out, sizeof(out), &no_signature, 1, &message) == sizeof(out));
+    CHECK(memcmp(out + 1, zero_signature, SOLANA_SIGNATURE_LENGTH) == 0);
+    CHECK(solana_transaction_message_offset(200) == 2 + 200 * SOLANA_SIGNATURE_LENGTH);
+    CHECK(view.message.offset + solana_message_blockhash_offset(view.message.account_count) == view.message.blockhash_offset);
+
+    /* too small, or a list a short_vec can't count */
+    CHECK(solana_transaction_encode(out, sizeof(out) - 1, &signature, 1, &message) == 0);
+    CHECK(solana_message_encode(out, view.message.length - 1, &message) == 0);
+
+    ix.data_len = SOLANA_SHORT_VEC_MAX + 1;
+    CHECK(solana_message_size(&message) == 0);
+    CHECK(solana_message_encode(out, sizeof(out), &message) == 0);
+}
+
+static void test_round_trip(void) {
+    uint8_t keys[300 * SOLANA_KEY_LENGTH];
+    const uint8_t *key_list[300];
+    uint8_t hash[SOLANA_HASH_LENGTH];
+    uint8_t data[200];
+    uint8_t accounts[3] = { 1, 2, 0 };
+    solana_instruction ix[130];
+    solana_instruction_view view_ix[130];
+    solana_message_view view;
+    solana_message message;
+    uint8_t out[64 * 1024];
+    size_t size;
+    size_t i;
+
+    for (i = 0; i < sizeof(keys); ++i) {
+        keys[i] = (uint8_t) (i * 7);
+    }
+
+    for (i = 0; i < 300; ++i) {
+        key_list[i] = keys + i * SOLANA_KEY_LENGTH;
+    }
+
+    memset(hash, 0x5a, sizeof(hash));
+
+    for (i = 0; i < sizeof(data); ++i) {
+        data[i] = (uint8_t) i;
+    }
+
+    /* counts on both sides of the one and two byte short_vec boundaries */
+    for (i = 0; i < 130; ++i) {
+        ix[i].program_index = (uint8_t) (i % 200);
+        ix[i].accounts = accounts;
+        ix[i].account_count = i % 4;
+        ix[i].data = data;
+        ix[i].data_len = i + 70;
+    }
+
+    message.signature_count = 2;
+    message.readonly_signed_count = 1;
+    message.readonly_count = 3;
+    message.account_keys = key_list;
+    message.account_count = 300;
+    message.blockhash = hash;
+    message.instructions = ix;
+    message.instruction_count = 130;
+
+    size = solana_message_encode(out, sizeof(out), &message);
+    CHECK(size == solana_message_size(&message));
+
+    /* a short instruction array still validates them all */
+    CHECK(solana_message_decode(&view, view_ix, 4, out, size) == SOLANA_OK);
+    CHECK(view.instruction_count == 130);
+
+    CHECK(solana_message_decode(&view, view_ix, 130, out, size) == SOLANA_OK);
+    CHECK(view.length == size && view.account_count == 300);
+    CHECK(memcmp(out + view.account_keys_offset, keys, sizeof(keys)) == 0);
+    CHECK(memcmp(out + view.blockhash_offset, hash, sizeof(hash)) == 0);
+    CHECK(solana_message_blockhash_offset(300) == view.blockhash_offset);
+
+    for (i = 0; i < 130; ++i) {
+        CHECK(view_ix[i].program_index == ix[i].program_index);
+        CHECK(view_ix[i].accounts.length == ix[i].account_count);
+        CHECK(memcmp(out + view_ix[i].accounts.offset, accounts, ix[i].account_count) == 0);
+        CHECK(view_ix[i].data.length == ix[i].data_len);
+        CHECK(memcmp(out + view_ix[i].data.offset, data, ix[i].data_len) == 0);
+    }
+}
+
+int main(void) {
+    test_short_vec();
+    test_decode();
+    test_decode_invalid();
+    test_encode();
+    test_round_trip();
+
+    printf("codec_test: %d failures\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,231 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "solana_compiler.h"
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        ++failures; \
+    } \
+} while (0)
+
+static int compile(solana_message *message, uint8_t **arena, const uint8_t *payer, const solana_instruction_spec *instructions, size_t count) {
+    size_t size = solana_message_compile_arena_size(instructions, count);
+
+    *arena = (uint8_t *) malloc(size);
+    return solana_message_compile(message, *arena, size, payer, instructions, count);
+}
+
+static void fill(uint8_t *key, uint8_t first, uint8_t rest) {
+    key[0] = first;
+    memset(key + 1, rest, SOLANA_KEY_LENGTH - 1);
+}
+
+/*
+    Keys whose base58 order differs from their byte order:
+
+        00ff00.. 14tXMMgexG14Bgjk9YeN37BfMcgSW1Wg1f7391cpkgTR
+        200000.. 39v3grDhbkqr58rBH9XHeerKHK5fbQG1gksR7Evr4kA3
+        010000.. 4uQeVj5tqViQh7yWWGStvkEG1Zmhx6uasJtWCJziofM
+*/
+
+static void test_order(void) {
+    uint8_t payer[SOLANA_KEY_LENGTH], a[SOLANA_KEY_LENGTH], b[SOLANA_KEY_LENGTH], c[SOLANA_KEY_LENGTH], d[SOLANA_KEY_LENGTH], e[SOLANA_KEY_LENGTH];
+    const uint8_t *expected[6];
+    solana_account_meta first[4], second[2];
+    solana_instruction_spec spec[2];
+    solana_message message;
+    uint8_t data[3] = { 1, 2, 3 };
+    uint8_t *arena;
+    size_t i;
+
+    fill(payer, 0xf0, 0);
+    fill(a, 0x01, 0);
+    fill(b, 0x20, 0);
+    fill(c, 0x00, 0);
+    c[1] = 0xff;
+    fill(d, 0x01, 1);
+    fill(e, 0x20, 1);
+
+    first[0].key = a;
+    first[0].flags = SOLANA_ACCOUNT_WRITABLE;
+    first[1].key = b;
+    first[1].flags = SOLANA_ACCOUNT_WRITABLE;
+    first[2].key = c;
+    first[2].flags = SOLANA_ACCOUNT_WRITABLE;
+    first[3].key = d;
+    first[3].flags = SOLANA_ACCOUNT_SIGNER;
+
+    /* a was seen as an account first and e as a program, which sticks */
+    second[0].key = e;
+    second[0].flags = 0;
+    second[1].key = payer;
+    second[1].flags = 0;
+
+    spec[0].program = e;
+    spec[0].accounts = first;
+    spec[0].account_count = 4;
+    spec[0].data = data;
+    spec[0].data_len = sizeof(data);
+
+    spec[1].program = a;
+    spec[1].accounts = second;
+    spec[1].account_count = 2;
+    spec[1].data = NULL;
+    spec[1].data_len = 0;
+
+    CHECK(compile(&message, &arena, payer, spec, 2) == SOLANA_OK);
+
+    CHECK(message.signature_count == 2);
+    CHECK(message.readonly_signed_count == 1);
+    CHECK(message.readonly_count == 1);
+    CHECK(message.blockhash == NULL);
+
+    /* payer, signer, then writable by base58, then programs */
+    expected[0] = payer;
+    expected[1] = d;
+    expected[2] = c;
+    expected[3] = b;
+    expected[4] = a;
+    expected[5] = e;
+
+    CHECK(message.account_count == 6);
+
+    for (i = 0; i < 6; ++i) {
+        CHECK(memcmp(message.account_keys[i], expected[i], SOLANA_KEY_LENGTH) == 0);
+    }
+
+    CHECK(message.instruction_count == 2);
+    CHECK(message.instructions[0].program_index == 5);
+    CHECK(message.instructions[0].account_count == 4);
+    CHECK(memcmp(message.instructions[0].accounts, "\x04\x03\x02\x01", 4) == 0);
+    CHECK(message.instructions[0].data == data && message.instructions[0].data_len == 3);
+    CHECK(message.instructions[1].program_index == 4);
+    CHECK(message.instructions[1].account_count == 2);
+    CHECK(memcmp(message.instructions[1].accounts, "\x05\x00", 2) == 0);
+
+    free(arena);
+}
+
+static void test_limits(void) {
+    uint8_t keys[257 * SOLANA_KEY_LENGTH];
+    solana_account_meta metas[256];
+    solana_instruction_spec spec;
+    solana_message message;
+    uint8_t *arena;
+    size_t size;
+    size_t i;
+
+    for (i = 0; i < 257; ++i) {
+        fill(keys + i * SOLANA_KEY_LENGTH, (uint8_t) i, (uint8_t) (i >> 8) + 1);
+    }
+
+    for (i = 0; i < 256; ++i) {
+        metas[i].key = keys + (i + 1) * SOLANA_KEY_LENGTH;
+        metas[i].flags = SOLANA_ACCOUNT_WRITABLE;
+    }
+
+    /* the payer, the program and 254 accounts fill every index */
+    spec.program = keys + SOLANA_KEY_LENGTH;
+    spec.accounts = metas + 1;
+    spec.account_count = 254;
+    spec.data = NULL;
+    spec.data_len = 0;
+
+    CHECK(compile(&message, &arena, keys, &spec, 1) == SOLANA_OK);
+    CHECK(message.account_count == 256);
+    free(arena);
+
+    spec.account_count = 255;
+    CHECK(compile(&message, &arena, keys, &spec, 1) == SOLANA_ERROR_TOO_MANY_ACCOUNTS);
+    free(arena);
+
+    size = solana_message_compile_arena_size(&spec, 1);
+    arena = (uint8_t *) malloc(size);
+    CHECK(solana_message_compile(&message, arena, size - 1, keys, &spec, 1) == SOLANA_ERROR_ARENA);
+    free(arena);
+}
+
+/* the header agrees with the flags of every meta, and indices map back to their keys */
+static void test_many(void) {
+    enum { KEYS = 200, INSTRUCTIONS = 60, ACCOUNTS = 12 };
+    uint8_t keys[KEYS * SOLANA_KEY_LENGTH];
+    solana_account_meta metas[INSTRUCTIONS * ACCOUNTS];
+    solana_instruction_spec spec[INSTRUCTIONS];
+    solana_message message;
+    const solana_instruction *ix;
+    const solana_account_meta *meta;
+    uint8_t *arena;
+    size_t writable_signed, writable_end;
+    size_t index;
+    size_t i, j;
+
+    srand(7);
+
+    for (i = 0; i < sizeof(keys); ++i) {
+        keys[i] = (uint8_t) rand();
+    }
+
+    for (i = 0; i < INSTRUCTIONS; ++i) {
+        for (j = 0; j < ACCOUNTS; ++j) {
+            /* programs are keys 1 to 9, accounts the rest */
+            metas[i * ACCOUNTS + j].key = keys + (size_t) (rand() % (KEYS - 10) + 10) * SOLANA_KEY_LENGTH;
+            metas[i * ACCOUNTS + j].flags = (uint8_t) ((rand() % 8 == 0 ? SOLANA_ACCOUNT_SIGNER : 0) | (rand() % 2 ? SOLANA_ACCOUNT_WRITABLE : 0));
+        }
+
+        spec[i].program = keys + (size_t) (1 + i % 9) * SOLANA_KEY_LENGTH;
+        spec[i].accounts = metas + i * ACCOUNTS;
+        spec[i].account_count = ACCOUNTS - i % 3;
+        spec[i].data = keys;
+        spec[i].data_len = i;
+    }
+
+    CHECK(compile(&message, &arena, keys, spec, INSTRUCTIONS) == SOLANA_OK);
+    CHECK(memcmp(message.account_keys[0], keys, SOLANA_KEY_LENGTH) == 0);
+
+    for (i = 0; i < message.account_count; ++i) {
+        for (j = i + 1; j < message.account_count; ++j) {
+            CHECK(memcmp(message.account_keys[i], message.account_keys[j], SOLANA_KEY_LENGTH) != 0);
+        }
+    }
+
+    writable_signed = message.signature_count - message.readonly_signed_count;
+    writable_end = message.account_count - message.readonly_count;
+
+    for (i = 0; i < INSTRUCTIONS; ++i) {
+        ix = &message.instructions[i];
+
+        CHECK(memcmp(message.account_keys[ix->program_index], spec[i].program, SOLANA_KEY_LENGTH) == 0);
+        CHECK(ix->account_count == spec[i].account_count);
+        CHECK(ix->data_len == i);
+
+        for (j = 0; j < ix->account_count; ++j) {
+            meta = &spec[i].accounts[j];
+            index = ix->accounts[j];
+
+            CHECK(memcmp(message.account_keys[index], meta->key, SOLANA_KEY_LENGTH) == 0);
+
+            if (meta->flags & SOLANA_ACCOUNT_SIGNER) {
+                CHECK(index < message.signature_count);
+                CHECK(!(meta->flags & SOLANA_ACCOUNT_WRITABLE) || index < writable_signed);
+            } else if (meta->flags & SOLANA_ACCOUNT_WRITABLE) {
+                CHECK(index < writable_signed || (index >= message.signature_count && index < writable_end));
+            }
+        }
+    }
+
+    free(arena);
+}
+
+int main(void) {
+    test_order();
+    test_limits();
+    test_many();
+
+    printf("compiler_test: %d failures\n", failures);
+    return failures != 0;
+}